@@ -6007,6 +6007,27 @@ MIOPEN_EXPORT miopenStatus_t miopenGetSolverIdConvAlgorithm(uint64_t solverId,
 
 #ifdef MIOPEN_BETA_API
 
+/*! @brief Loads the databases used by a set of problems ahead of time.
+ *
+ * Intended to be called once with all the problems of a network when a model is loaded. The
+ * performance and find databases which are kept in memory are read and cached, so that subsequent
+ * calls to miopenFindSolutions do not pay for loading them. The SQLite performance database is
+ * queried for all the problems in batches, and the records of the installed one are kept for the
+ * later lookups. Problems which do not use the databases are ignored.
+ *
+ * @param handle      Handle to get the databases for
+ * @param numProblems Amount of problems
+ * @param problems    Pointer to the first problem. May be null if numProblems is 0
+ * @return            miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenPrefetchProblems(miopenHandle_t handle,
+                                                    size_t numProblems,
+                                                    const miopenProblem_t* problems);
+
+#endif // MIOPEN_BETA_API
+
+#ifdef MIOPEN_BETA_API
+
 /*! @brief Initializes a problem object describing an activation operation.
  * @note As of now there is no way to actually get any solution for this kind of problems.
  *
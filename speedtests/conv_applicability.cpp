@@ -0,0 +1,164 @@
+#include <miopen/config.h> // WORKAROUND_BOOST_ISSUE_392
+#include <miopen/conv/problem_description.hpp>
+#include <miopen/conv_solution.hpp>
+#include <miopen/convolution.hpp>
+#include <miopen/execution_context.hpp>
+#include <miopen/handle.hpp>
+#include <miopen/invoke_params.hpp>
+#include <miopen/mlo_internal.hpp>
+#include <miopen/tensor.hpp>
+#include <miopen/worker_pool.hpp>
+
+#include <driver.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <vector>
+
+namespace miopen {
+namespace conv_applicability_speedtest {
+
+struct Layer
+{
+    int c, h, w, k, y, x, pad, stride;
+};
+
+// Convolutions of ResNet-50, one entry per distinct shape.
+const std::vector<Layer>& ResNet50()
+{
+    static const auto layers = std::vector<Layer>{
+        {3, 224, 224, 64, 7, 7, 3, 2},
+        {64, 56, 56, 64, 1, 1, 0, 1},
+        {64, 56, 56, 64, 3, 3, 1, 1},
+        {64, 56, 56, 256, 1, 1, 0, 1},
+        {256, 56, 56, 64, 1, 1, 0, 1},
+        {256, 56, 56, 128, 1, 1, 0, 2},
+        {128, 28, 28, 128, 3, 3, 1, 1},
+        {128, 28, 28, 512, 1, 1, 0, 1},
+        {256, 56, 56, 512, 1, 1, 0, 2},
+        {512, 28, 28, 128, 1, 1, 0, 1},
+        {512, 28, 28, 256, 1, 1, 0, 2},
+        {256, 14, 14, 256, 3, 3, 1, 1},
+        {256, 14, 14, 1024, 1, 1, 0, 1},
+        {512, 28, 28, 1024, 1, 1, 0, 2},
+        {1024, 14, 14, 256, 1, 1, 0, 1},
+        {1024, 14, 14, 512, 1, 1, 0, 2},
+        {512, 7, 7, 512, 3, 3, 1, 1},
+        {512, 7, 7, 2048, 1, 1, 0, 1},
+        {1024, 14, 14, 2048, 1, 1, 0, 2},
+        {2048, 7, 7, 512, 1, 1, 0, 1},
+    };
+    return layers;
+}
+
+struct SpeedTestDriver : public test_driver
+{
+    SpeedTestDriver()
+    {
+        add(batch_size, "batch-size");
+        add(iterations, "iterations");
+    }
+
+    void run()
+    {
+        auto problems = std::vector<conv::ProblemDescription>{};
+        for(const auto& l : ResNet50())
+        {
+            const auto desc = ConvolutionDescriptor{{l.pad, l.pad}, {l.stride, l.stride}, {1, 1}};
+            const auto in   = TensorDescriptor{miopenFloat, {batch_size, l.c, l.h, l.w}};
+            const auto wei  = TensorDescriptor{miopenFloat, {l.k, l.c, l.y, l.x}};
+            const auto out  = desc.GetForwardOutputTensor(in, wei);
+            for(const auto dir : {conv::Direction::Forward,
+                                  conv::Direction::BackwardData,
+                                  conv::Direction::BackwardWeights})
+            {
+                problems.emplace_back(dir == conv::Direction::Forward ? in : out,
+                                      wei,
+                                      dir == conv::Direction::Forward ? out : in,
+                                      desc,
+                                      dir);
+            }
+        }
+
+        std::cout << "Problems: " << problems.size()
+                  << ", worker threads: " << GetWorkerPool().GetThreadCount() << std::endl;
+
+        auto handle = Handle{};
+        auto ctx    = ExecutionContext{&handle};
+
+        // The first pass warms up the perf db, so both modes are measured on the same state.
+        for(const auto parallel : {false, false, true})
+        {
+            ctx.parallel_applicability = parallel;
+
+            const auto start = std::chrono::steady_clock::now();
+            auto n_solutions = std::size_t{0};
+            for(auto i = 0; i < iterations; ++i)
+            {
+                for(const auto& problem : problems)
+                    n_solutions += Find(ctx, problem);
+            }
+            const auto time = std::chrono::duration_cast<std::chrono::microseconds>(
+                                  std::chrono::steady_clock::now() - start)
+                                  .count() *
+                              .001;
+
+            std::cout << "Parallel applicability: " << parallel << ", solutions: " << n_solutions
+                      << ", time: " << time << " ms, per problem: "
+                      << time / (iterations * problems.size()) << " ms" << std::endl;
+        }
+    }
+
+    void show_help()
+    {
+        test_driver::show_help();
+        std::cout << "Measures host-side latency of finding the applicable convolution solvers "
+                     "and their workspace sizes for ResNet-50 layers, with the solvers checked "
+                     "sequentially and on the worker pool."
+                  << std::endl;
+    }
+
+private:
+    // The solutions are not benchmarked, so empty invoke parameters are enough.
+    static std::size_t Find(const ExecutionContext& ctx, const conv::ProblemDescription& problem)
+    {
+        const auto invoke_ctx = AnyInvokeParams{};
+        auto n                = std::size_t{0};
+
+        if(problem.GetDirection() == conv::Direction::BackwardWeights)
+        {
+            n += FindWinogradWrWWorkspaceSizes(ctx, problem).size();
+            n += FindImplicitGemmWrWWorkspaceSizes(ctx, problem).size();
+            n += AllDirectBwdWrW2DWorkspaceSize(ctx, problem).size();
+            n += FindWinogradWrWAllSolutions(ctx, problem, invoke_ctx).size();
+            n += FindImplicitGemmWrWAllSolutions(ctx, problem, invoke_ctx).size();
+            n += FindAllBwdWrW2DSolutions(ctx, problem, invoke_ctx).size();
+        }
+        else
+        {
+            n += AllDirectForwardBackwardDataWorkspaceSize(ctx, problem).size();
+            n += FindAllImplicitGemmWorkspaceSizes(ctx, problem).size();
+            n += FindAllWinogradWorkspaceSizes(ctx, problem).size();
+            n += FindAllDirectSolutions(ctx, problem, invoke_ctx).size();
+            n += FindAllImplicitGemmSolutions(ctx, problem, invoke_ctx).size();
+            n += FindAllWinogradSolutions(ctx, problem, invoke_ctx).size();
+        }
+
+        n += AllGemmWorkspaceSize(ctx, problem).size();
+        n += FindAllGemmSolutions(ctx, problem, invoke_ctx).size();
+        return n;
+    }
+
+    int batch_size = 32;
+    int iterations = 5;
+};
+
+} // namespace conv_applicability_speedtest
+} // namespace miopen
+
+int main(int argc, const char* argv[])
+{
+    test_drive<miopen::conv_applicability_speedtest::SpeedTestDriver>(argc, argv);
+    return 0;
+}
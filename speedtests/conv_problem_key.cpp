@@ -0,0 +1,126 @@
+#include <miopen/config.h> // WORKAROUND_BOOST_ISSUE_392
+#include <miopen/conv/problem_description.hpp>
+#include <miopen/conv/problem_key.hpp>
+#include <miopen/convolution.hpp>
+#include <miopen/execution_context.hpp>
+#include <miopen/handle.hpp>
+#include <miopen/invoker_cache.hpp>
+#include <miopen/tensor.hpp>
+
+#include <driver.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace miopen {
+namespace conv_problem_key_speedtest {
+
+struct SpeedTestDriver : public test_driver
+{
+    SpeedTestDriver()
+    {
+        add(batch_size, "batch-size");
+        add(iterations, "iterations");
+        add(solution_iterations, "solution-iterations");
+    }
+
+    void run()
+    {
+        auto problems = std::vector<conv::ProblemDescription>{};
+        for(const auto c : {64, 128, 256, 512})
+        {
+            for(const auto hw : {7, 14, 28, 56})
+            {
+                for(const auto yx : {1, 3})
+                {
+                    const auto desc = ConvolutionDescriptor{{yx / 2, yx / 2}, {1, 1}, {1, 1}};
+                    const auto in   = TensorDescriptor{miopenFloat, {batch_size, c, hw, hw}};
+                    const auto wei  = TensorDescriptor{miopenFloat, {c, c, yx, yx}};
+                    const auto out  = desc.GetForwardOutputTensor(in, wei);
+                    problems.emplace_back(in, wei, out, desc, conv::Direction::Forward);
+                }
+            }
+        }
+
+        std::cout << "Problems: " << problems.size() << std::endl;
+
+        // Same lookups as ConvolutionForward() does after Find.
+        auto cache = InvokerCache{};
+        for(const auto& problem : problems)
+        {
+            const auto config = problem.MakeNetworkConfig().ToString();
+            cache.Register({config, "solver"}, [](auto&&, auto&&) {});
+            cache.SetAsFound1_0(config, "algorithm", "solver");
+        }
+
+        auto found = std::size_t{0};
+        Measure("Network config", problems, iterations, [&](const auto& problem) {
+            found += problem.MakeNetworkConfig().ToString().size();
+        });
+        Measure("Problem key", problems, iterations, [&](const auto& problem) {
+            found += problem.MakeKey().hash & 1;
+        });
+        Measure("Invoker by network config", problems, iterations, [&](const auto& problem) {
+            found += cache.GetFound1_0(problem.MakeNetworkConfig().ToString(), "algorithm") ? 1 : 0;
+        });
+        Measure("Invoker by problem key", problems, iterations, [&](const auto& problem) {
+            found += cache.GetFound1_0(problem.MakeKey(), "algorithm") ? 1 : 0;
+        });
+
+        auto handle = Handle{};
+        auto ctx    = ExecutionContext{&handle};
+        // Includes the find-db lookup, so it is much slower and runs fewer iterations.
+        Measure("GetSolution", problems, solution_iterations, [&](const auto& problem) {
+            auto fallback = false;
+            found += problem.GetConv().GetSolutions(ctx, problem, 1, &fallback).size();
+        });
+
+        // Keeps the results alive, so the loops are not optimized out.
+        std::cout << "Checksum: " << found << std::endl;
+    }
+
+    void show_help()
+    {
+        test_driver::show_help();
+        std::cout << "Measures host-side per-call overhead of building the convolution problem "
+                     "keys, of looking up invokers by them, and of immediate mode GetSolution."
+                  << std::endl;
+    }
+
+private:
+    template <class F>
+    static void Measure(const char* name,
+                        const std::vector<conv::ProblemDescription>& problems,
+                        int n_iterations,
+                        F&& f)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        for(auto i = 0; i < n_iterations; ++i)
+        {
+            for(const auto& problem : problems)
+                f(problem);
+        }
+        const auto time = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                              std::chrono::steady_clock::now() - start)
+                              .count();
+
+        std::cout << name << ": " << static_cast<double>(time) / (n_iterations * problems.size())
+                  << " ns per call" << std::endl;
+    }
+
+    int batch_size          = 32;
+    int iterations          = 10000;
+    int solution_iterations = 100;
+};
+
+} // namespace conv_problem_key_speedtest
+} // namespace miopen
+
+int main(int argc, const char* argv[])
+{
+    test_drive<miopen::conv_problem_key_speedtest::SpeedTestDriver>(argc, argv);
+    return 0;
+}
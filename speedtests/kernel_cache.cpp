@@ -0,0 +1,76 @@
+#include <miopen/config.h> // WORKAROUND_BOOST_ISSUE_392
+#include <miopen/binary_cache.hpp>
+#include <miopen/handle.hpp>
+#if MIOPEN_ENABLE_SQLITE_KERN_CACHE
+#include <miopen/sqlite_db.hpp>
+#endif
+
+#include <driver.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace miopen {
+namespace kernel_cache_speedtest {
+
+struct SpeedTestDriver : public test_driver
+{
+    SpeedTestDriver() { add(iterations, "iterations"); }
+
+    void run()
+    {
+#if MIOPEN_ENABLE_SQLITE_KERN_CACHE
+        auto handle        = Handle{};
+        const auto& target = handle.GetTargetProperties();
+        const auto num_cu  = handle.GetMaxComputeUnits();
+        const auto name    = std::string{"kernel_cache_speedtest.cl"};
+        const auto args    = std::string{"-DSPEEDTEST=1"};
+        const auto binary  = std::vector<char>(64 * 1024, 'x');
+
+        SaveBinary(binary, target, num_cu, name, args);
+
+        for(auto i = 0; i < 2; ++i)
+        {
+            const auto before = SQLite::GetStatementStats();
+            EXPECT(LoadBinary(target, num_cu, name, args) == binary);
+            const auto after = SQLite::GetStatementStats();
+            std::cout << "LoadBinary #" << i << ": prepared statements: "
+                      << after.prepared - before.prepared
+                      << ", reused statements: " << after.reused - before.reused << std::endl;
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        for(auto i = 0; i < iterations; ++i)
+            LoadBinary(target, num_cu, name, args);
+        const auto time = std::chrono::duration_cast<std::chrono::microseconds>(
+                              std::chrono::steady_clock::now() - start)
+                              .count();
+        std::cout << "LoadBinary: " << static_cast<double>(time) / iterations << " us per call"
+                  << std::endl;
+#else
+        std::cout << "The SQLite kernel cache is disabled in this build." << std::endl;
+#endif
+    }
+
+    void show_help()
+    {
+        test_driver::show_help();
+        std::cout << "Measures host-side latency of loading a binary from the user kernel cache "
+                     "and counts the SQLite statements compiled for it."
+                  << std::endl;
+    }
+
+private:
+    int iterations = 1000;
+};
+
+} // namespace kernel_cache_speedtest
+} // namespace miopen
+
+int main(int argc, const char* argv[])
+{
+    test_drive<miopen::kernel_cache_speedtest::SpeedTestDriver>(argc, argv);
+    return 0;
+}
@@ -0,0 +1,121 @@
+#include <miopen/config.h> // WORKAROUND_BOOST_ISSUE_392
+#include <miopen/ramdb.hpp>
+#include <miopen/tmp_dir.hpp>
+
+#include <driver.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace miopen {
+namespace ramdb_speedtest {
+
+struct TestValue
+{
+    int value = 0;
+
+    void Serialize(std::ostream& stream) const { stream << value; }
+
+    bool Deserialize(const std::string& str)
+    {
+        value = std::stoi(str);
+        return true;
+    }
+};
+
+struct SpeedTestDriver : public test_driver
+{
+    SpeedTestDriver()
+    {
+        add(iterations, "iterations");
+        add(records, "records");
+        add(max_threads, "threads");
+        add(wait_for_settle, "settle");
+    }
+
+    void run()
+    {
+        const auto dir = TmpDir{"ramdb_speedtest"};
+        auto db        = RamDb{DbKinds::PerfDb, dir / "speedtest.udb.txt"};
+
+        for(auto i = 0; i < records; ++i)
+            db.Update(std::to_string(i), "id", TestValue{i});
+
+        // Lookups bypass the file lock only once the last write is old enough for its
+        // timestamp to be trusted.
+        if(wait_for_settle)
+            std::this_thread::sleep_for(std::chrono::seconds{4});
+
+        for(auto threads = 1; threads <= max_threads; threads *= 2)
+            Measure(db, threads);
+    }
+
+    void show_help()
+    {
+        test_driver::show_help();
+        std::cout << "Measures FindRecord throughput of a RamDb shared by 1, 2, 4... threads."
+                  << std::endl;
+    }
+
+private:
+    int iterations       = 100000;
+    int records          = 1000;
+    int max_threads      = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    bool wait_for_settle = true;
+
+    void Measure(RamDb& db, int threads) const
+    {
+        auto found   = std::atomic<int>{0};
+        auto workers = std::vector<std::thread>{};
+        workers.reserve(threads);
+
+        const auto start = std::chrono::steady_clock::now();
+
+        for(auto t = 0; t < threads; ++t)
+        {
+            workers.emplace_back([&, t]() {
+                auto local_found = 0;
+                for(auto i = 0; i < iterations; ++i)
+                {
+                    const auto key = std::to_string((i * 7919 + t) % records);
+                    if(db.FindRecord(key))
+                        ++local_found;
+                }
+                found += local_found;
+            });
+        }
+
+        for(auto& worker : workers)
+            worker.join();
+
+        const auto time = std::chrono::duration_cast<std::chrono::microseconds>(
+                              std::chrono::steady_clock::now() - start)
+                              .count() *
+                          .001 * .001;
+
+        const auto lookups = static_cast<double>(iterations) * threads;
+
+        std::cout << "Threads: " << threads << ", time: " << time << " seconds, "
+                  << "lookups per second: " << lookups / time << std::endl;
+
+        if(found != iterations * threads)
+        {
+            std::cerr << "Missing records: " << iterations * threads - found << std::endl;
+            std::exit(-1); // NOLINT (concurrency-mt-unsafe)
+        }
+    }
+};
+
+} // namespace ramdb_speedtest
+} // namespace miopen
+
+int main(int argc, const char* argv[])
+{
+    test_drive<miopen::ramdb_speedtest::SpeedTestDriver>(argc, argv);
+    return 0;
+}
@@ -0,0 +1,151 @@
+#include <miopen/config.h> // WORKAROUND_BOOST_ISSUE_392
+#include <miopen/conv/problem_description.hpp>
+#include <miopen/convolution.hpp>
+#include <miopen/handle.hpp>
+#include <miopen/miopen.h>
+#include <miopen/tensor.hpp>
+
+#include <driver.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <vector>
+
+namespace miopen {
+namespace tensor_descriptor_speedtest {
+
+struct SpeedTestDriver : public test_driver
+{
+    SpeedTestDriver()
+    {
+        add(iterations, "iterations");
+        add(conv_iterations, "conv-iterations");
+    }
+
+    void run()
+    {
+        const auto lens    = std::vector<std::size_t>{32, 64, 56, 56};
+        const auto strides = std::vector<std::size_t>{64 * 56 * 56, 1, 56 * 64, 64};
+
+        auto checksum = std::size_t{0};
+        Measure("Create", iterations, [&]() {
+            const auto desc = TensorDescriptor{miopenFloat, lens, strides};
+            checksum += desc.GetNumDims();
+        });
+
+        const auto desc = TensorDescriptor{miopenFloat, lens, strides};
+        checksum += desc.GetLayout_str().size();
+        Measure("Copy", iterations, [&]() {
+            const auto copy = desc; // NOLINT (performance-unnecessary-copy-initialization)
+            checksum += copy.GetNumDims();
+        });
+
+        auto conv          = ConvolutionDescriptor{{1, 1}, {1, 1}, {1, 1}};
+        auto x             = TensorDescriptor{miopenFloat, {32, 64, 56, 56}};
+        auto w             = TensorDescriptor{miopenFloat, {64, 64, 3, 3}};
+        auto y             = conv.GetForwardOutputTensor(x, w);
+        const auto problem = conv::ProblemDescription{x, w, y, conv, conv::Direction::Forward};
+        Measure("Problem copy", iterations, [&]() {
+            const auto copy = problem; // NOLINT (performance-unnecessary-copy-initialization)
+            checksum += copy.GetSpatialDims();
+        });
+
+        ConvolutionForward(conv, x, w, y);
+
+        std::cout << "Checksum: " << checksum << std::endl;
+    }
+
+    void show_help()
+    {
+        test_driver::show_help();
+        std::cout << "Measures host-side cost of creating and copying tensor descriptors and "
+                     "host-side overhead of miopenConvolutionForward()."
+                  << std::endl;
+    }
+
+private:
+    template <class F>
+    static void Measure(const char* name, int n_iterations, F&& f)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        for(auto i = 0; i < n_iterations; ++i)
+            f();
+        const auto time = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                              std::chrono::steady_clock::now() - start)
+                              .count();
+        std::cout << name << ": " << static_cast<double>(time) / n_iterations << " ns per call"
+                  << std::endl;
+    }
+
+    void ConvolutionForward(ConvolutionDescriptor& conv,
+                            TensorDescriptor& x,
+                            TensorDescriptor& w,
+                            TensorDescriptor& y) const
+    {
+        auto handle       = Handle{};
+        const auto x_data = handle.Create(x.GetNumBytes());
+        const auto w_data = handle.Create(w.GetNumBytes());
+        const auto y_data = handle.Create(y.GetNumBytes());
+
+        auto workspace_size = std::size_t{0};
+        EXPECT(miopenConvolutionForwardGetWorkSpaceSize(
+                   &handle, &w, &x, &conv, &y, &workspace_size) == miopenStatusSuccess);
+        const auto workspace = handle.Create(std::max<std::size_t>(workspace_size, 1));
+
+        auto perf    = miopenConvAlgoPerf_t{};
+        auto n_found = 0;
+        EXPECT(miopenFindConvolutionForwardAlgorithm(&handle,
+                                                     &x,
+                                                     x_data.get(),
+                                                     &w,
+                                                     w_data.get(),
+                                                     &conv,
+                                                     &y,
+                                                     y_data.get(),
+                                                     1,
+                                                     &n_found,
+                                                     &perf,
+                                                     workspace.get(),
+                                                     workspace_size,
+                                                     false) == miopenStatusSuccess);
+
+        const auto alpha = 1.f;
+        const auto beta  = 0.f;
+        const auto call  = [&]() {
+            EXPECT(miopenConvolutionForward(&handle,
+                                            &alpha,
+                                            &x,
+                                            x_data.get(),
+                                            &w,
+                                            w_data.get(),
+                                            &conv,
+                                            perf.fwd_algo,
+                                            &beta,
+                                            &y,
+                                            y_data.get(),
+                                            workspace.get(),
+                                            perf.memory) == miopenStatusSuccess);
+        };
+
+        // The kernels run asynchronously, so the time of the calls is mostly the host overhead
+        // while the queue is not full.
+        call();
+        handle.Finish();
+        Measure("miopenConvolutionForward", conv_iterations, call);
+        handle.Finish();
+    }
+
+    int iterations      = 1000000;
+    int conv_iterations = 100;
+};
+
+} // namespace tensor_descriptor_speedtest
+} // namespace miopen
+
+int main(int argc, const char* argv[])
+{
+    test_drive<miopen::tensor_descriptor_speedtest::SpeedTestDriver>(argc, argv);
+    return 0;
+}
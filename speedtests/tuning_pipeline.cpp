@@ -0,0 +1,140 @@
+#include <miopen/config.h> // WORKAROUND_BOOST_ISSUE_392
+#include <miopen/mt_queue.hpp>
+
+#include <driver.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+namespace miopen {
+namespace tuning_pipeline_speedtest {
+
+/// Stands for a compiled program which stays loaded until measured.
+struct Program
+{
+    static std::atomic<int> n_alive;
+    static std::atomic<int> n_alive_max;
+
+    std::vector<char> binary;
+
+    explicit Program(std::size_t size) : binary(size, 1)
+    {
+        const auto alive = ++n_alive;
+        auto prev        = n_alive_max.load();
+        while(alive > prev && !n_alive_max.compare_exchange_weak(prev, alive)) {}
+    }
+    Program(const Program&) = delete;
+    Program& operator=(const Program&) = delete;
+    ~Program() { --n_alive; }
+};
+
+std::atomic<int> Program::n_alive{0};
+std::atomic<int> Program::n_alive_max{0};
+
+// Move-only, so that nothing is copied on the way through the queue.
+using Item = std::tuple<std::unique_ptr<Program>, bool>;
+
+struct SpeedTestDriver : public test_driver
+{
+    SpeedTestDriver()
+    {
+        add(items, "items");
+        add(threads, "threads");
+        add(capacity, "capacity");
+        add(compile_us, "compile-us");
+        add(measure_us, "measure-us");
+        add(program_kb, "program-kb");
+    }
+
+    void run()
+    {
+        Program::n_alive_max = 0;
+
+        ThreadSafeQueue<Item> queue{capacity > 0 ? static_cast<std::size_t>(capacity)
+                                                 : std::numeric_limits<std::size_t>::max()};
+        auto next    = std::atomic<int>{0};
+        auto workers = std::vector<std::thread>{};
+        workers.reserve(threads);
+
+        const auto start = std::chrono::steady_clock::now();
+
+        for(auto t = 0; t < threads; ++t)
+        {
+            workers.emplace_back([&]() {
+                while(next++ < items)
+                {
+                    std::this_thread::sleep_for(std::chrono::microseconds{compile_us});
+                    auto program = std::make_unique<Program>(program_kb * 1024);
+                    if(!queue.push(Item{std::move(program), false}))
+                        return;
+                }
+                std::ignore = queue.push(Item{nullptr, true});
+            });
+        }
+
+        auto n_measured = 0;
+        for(auto remaining = threads; remaining > 0;)
+        {
+            const auto item = queue.pop();
+            if(std::get<1>(item))
+            {
+                --remaining;
+                continue;
+            }
+            std::this_thread::sleep_for(std::chrono::microseconds{measure_us});
+            ++n_measured;
+        }
+
+        for(auto& worker : workers)
+            worker.join();
+
+        const auto time = std::chrono::duration_cast<std::chrono::microseconds>(
+                              std::chrono::steady_clock::now() - start)
+                              .count() *
+                          .001 * .001;
+
+        std::cout << "Threads: " << threads << ", capacity: " << capacity << ", time: " << time
+                  << " seconds, items per second: " << n_measured / time
+                  << ", max programs in memory: " << Program::n_alive_max << " ("
+                  << Program::n_alive_max * program_kb / 1024.0 << " MiB)" << std::endl;
+
+        if(n_measured != items)
+        {
+            std::cerr << "Missing items: " << items - n_measured << std::endl;
+            std::exit(-1); // NOLINT (concurrency-mt-unsafe)
+        }
+    }
+
+    void show_help()
+    {
+        test_driver::show_help();
+        std::cout << "Measures throughput and peak memory of compile threads feeding a single "
+                     "measurement thread through a ThreadSafeQueue. Capacity 0 means unbounded."
+                  << std::endl;
+    }
+
+private:
+    int items      = 2000;
+    int threads    = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    int capacity   = 0;
+    int compile_us = 2000;
+    int measure_us = 500;
+    int program_kb = 256;
+};
+
+} // namespace tuning_pipeline_speedtest
+} // namespace miopen
+
+int main(int argc, const char* argv[])
+{
+    test_drive<miopen::tuning_pipeline_speedtest::SpeedTestDriver>(argc, argv);
+    return 0;
+}
@@ -304,6 +304,30 @@ miopenStatus_t miopenFindSolutions(miopenHandle_t handle,
     });
 }
 
+miopenStatus_t miopenPrefetchProblems(miopenHandle_t handle,
+                                      size_t numProblems,
+                                      const miopenProblem_t* problems)
+{
+    MIOPEN_LOG_FUNCTION(handle, numProblems, problems);
+
+    return miopen::try_([&] {
+        auto& handle_deref  = miopen::deref(handle);
+        auto problems_deref = std::vector<miopen::Problem>{};
+        problems_deref.reserve(numProblems);
+
+        for(std::size_t i = 0; i < numProblems; ++i)
+        {
+            const auto& problem_deref = miopen::deref(problems[i]).item;
+
+            // Prefetching is not supported for fused problems yet.
+            if(const auto problem = std::get_if<miopen::Problem>(&problem_deref))
+                problems_deref.push_back(*problem);
+        }
+
+        miopen::Problem::PrefetchDbs(handle_deref, problems_deref);
+    });
+}
+
 inline std::ostream& operator<<(std::ostream& stream, const miopenTensorArgument_t& tensor)
 {
     switch(tensor.id)
@@ -41,14 +41,94 @@
 #include <miopen/db_path.hpp>
 #include <miopen/target_properties.hpp>
 #include <miopen/filesystem.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <ctime>
 #include <fstream>
 #include <iostream>
+#include <vector>
 
 MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DISABLE_CACHE)
 MIOPEN_DECLARE_ENV_VAR_STR(MIOPEN_CUSTOM_CACHE_DIR)
+MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_CACHE_SIZE_LIMIT_MB, 0)
 
 namespace miopen {
 
+namespace {
+
+struct CacheCounters
+{
+    std::atomic<std::uint64_t> hits{0};
+    std::atomic<std::uint64_t> misses{0};
+    std::atomic<std::uint64_t> loaded_bytes{0};
+    std::atomic<std::uint64_t> stores{0};
+    std::atomic<std::uint64_t> stored_bytes{0};
+    std::atomic<std::uint64_t> evictions{0};
+    std::atomic<std::uint64_t> evicted_bytes{0};
+};
+
+CacheCounters& GetCacheCounters()
+{
+    // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+    static CacheCounters counters;
+    return counters;
+}
+
+void CountLoad(std::uint64_t bytes)
+{
+    auto& counters = GetCacheCounters();
+    ++counters.hits;
+    counters.loaded_bytes += bytes;
+}
+
+void CountStore(std::uint64_t bytes)
+{
+    auto& counters = GetCacheCounters();
+    ++counters.stores;
+    counters.stored_bytes += bytes;
+}
+
+void CountEvictions(std::uint64_t records, std::uint64_t bytes)
+{
+    auto& counters = GetCacheCounters();
+    counters.evictions += records;
+    counters.evicted_bytes += bytes;
+}
+
+std::uint64_t GetCacheQuota()
+{
+    return env::value(MIOPEN_CACHE_SIZE_LIMIT_MB) * 1024 * 1024;
+}
+
+} // namespace
+
+KernelCacheStats GetKernelCacheStats()
+{
+    const auto& counters = GetCacheCounters();
+    auto stats           = KernelCacheStats{};
+    stats.hits           = counters.hits;
+    stats.misses         = counters.misses;
+    stats.loaded_bytes   = counters.loaded_bytes;
+    stats.stores         = counters.stores;
+    stats.stored_bytes   = counters.stored_bytes;
+    stats.evictions      = counters.evictions;
+    stats.evicted_bytes  = counters.evicted_bytes;
+    return stats;
+}
+
+void ResetKernelCacheStats()
+{
+    auto& counters = GetCacheCounters();
+    counters.hits          = 0;
+    counters.misses        = 0;
+    counters.loaded_bytes  = 0;
+    counters.stores        = 0;
+    counters.stored_bytes  = 0;
+    counters.evictions     = 0;
+    counters.evicted_bytes = 0;
+}
+
 static fs::path ComputeSysCachePath()
 {
     auto p = miopen::ExpandUser(GetSystemDbPath());
@@ -124,15 +204,20 @@ bool IsCacheDisabled()
 }
 
 #if MIOPEN_ENABLE_SQLITE_KERN_CACHE
-using KDb = DbTimer<MultiFileDb<KernDb, KernDb, false>>;
-KDb GetDb(const TargetProperties& target, size_t num_cu)
+static fs::path GetUserKernDbPath(const TargetProperties& target, size_t num_cu)
 {
     static const auto user_dir = ComputeUserCachePath();
-    static const auto sys_dir  = ComputeSysCachePath();
-    fs::path user_path         = user_dir / (Handle::GetDbBasename(target, num_cu) + ".ukdb");
-    fs::path sys_path          = sys_dir / (Handle::GetDbBasename(target, num_cu) + ".kdb");
     if(user_dir.empty())
-        user_path = user_dir;
+        return user_dir;
+    return user_dir / (Handle::GetDbBasename(target, num_cu) + ".ukdb");
+}
+
+using KDb = DbTimer<MultiFileDb<KernDb, KernDb, false>>;
+KDb GetDb(const TargetProperties& target, size_t num_cu)
+{
+    static const auto sys_dir = ComputeSysCachePath();
+    const auto user_path      = GetUserKernDbPath(target, num_cu);
+    fs::path sys_path         = sys_dir / (Handle::GetDbBasename(target, num_cu) + ".kdb");
     if(!fs::exists(sys_path))
         sys_path = sys_dir / (target.DbId() + ".kdb");
 #if !MIOPEN_EMBED_DB
@@ -168,11 +253,13 @@ std::vector<char> LoadBinary(const TargetProperties& target,
     if(record)
     {
         MIOPEN_LOG_I2("Successfully loaded binary for: " << filename << "; args: " << args);
+        CountLoad(record->size());
         return *record;
     }
     else
     {
         MIOPEN_LOG_I2("Unable to load binary for: " << filename << "; args: " << args);
+        ++GetCacheCounters().misses;
         return {};
     }
 }
@@ -193,6 +280,23 @@ void SaveBinary(const std::vector<char>& hsaco,
 
     MIOPEN_LOG_I2("Saving binary for: " << filename << "; args: " << args);
     db.StoreRecord(cfg);
+    CountStore(hsaco.size());
+
+    const auto quota = GetCacheQuota();
+    if(quota == 0 || DisableUserDbFileIO)
+        return;
+
+    try
+    {
+        auto& user_db =
+            KernDb::GetCached(DbKinds::KernelDb, GetUserKernDbPath(target, num_cu), false);
+        const auto stats = user_db.Evict(quota);
+        CountEvictions(stats.records, stats.bytes);
+    }
+    catch(const Exception& ex)
+    {
+        MIOPEN_LOG_W("Unable to enforce the kernel cache size limit: " << ex.what());
+    }
 }
 #else
 fs::path LoadBinary(const TargetProperties& target,
@@ -207,14 +311,91 @@ fs::path LoadBinary(const TargetProperties& target,
     auto f = GetCacheFile(target.DbId(), name, args);
     if(fs::exists(f))
     {
+        CountLoad(fs::file_size(f));
+        // The modification time serves as the last access time for eviction.
+        if(GetCacheQuota() != 0)
+        {
+#if MIOPEN_WORKAROUND_USE_BOOST_FILESYSTEM
+            boost::system::error_code ec;
+            fs::last_write_time(f, std::time(nullptr), ec);
+#else
+            std::error_code ec;
+            fs::last_write_time(f, fs::file_time_type::clock::now(), ec);
+#endif
+        }
         return f;
     }
     else
     {
+        ++GetCacheCounters().misses;
         return {};
     }
 }
 
+/// Removes the least recently used binaries until the cache takes no more than 90% of the quota.
+static void EvictCacheFiles(std::uint64_t quota)
+{
+    struct CacheFile
+    {
+        fs::path path;
+        std::uint64_t size;
+        decltype(fs::last_write_time(std::declval<fs::path>())) time;
+    };
+
+    const auto root = GetCachePath(false);
+    auto files      = std::vector<CacheFile>{};
+    auto total      = std::uint64_t{0};
+
+    if(root.empty() || !fs::is_directory(root))
+        return;
+
+    // Binaries are stored as <root>/<md5 of the build parameters>/<name>.o
+    for(const auto& dir : fs::directory_iterator{root})
+    {
+        if(!fs::is_directory(dir.path()))
+            continue;
+        for(const auto& file : fs::directory_iterator{dir.path()})
+        {
+            if(!fs::is_regular_file(file.path()))
+                continue;
+            const auto size = static_cast<std::uint64_t>(fs::file_size(file.path()));
+            files.push_back({file.path(), size, fs::last_write_time(file.path())});
+            total += size;
+        }
+    }
+
+    if(total <= quota)
+        return;
+
+    std::sort(files.begin(), files.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.time < rhs.time;
+    });
+
+    const auto target = quota / 10 * 9;
+    auto records      = std::uint64_t{0};
+    auto bytes        = std::uint64_t{0};
+
+    for(const auto& file : files)
+    {
+        if(total - bytes <= target)
+            break;
+#if MIOPEN_WORKAROUND_USE_BOOST_FILESYSTEM
+        boost::system::error_code ec;
+#else
+        std::error_code ec;
+#endif
+        if(!fs::remove(file.path, ec))
+            continue;
+        fs::remove(file.path.parent_path(), ec); // Only succeeds once the directory is empty.
+        ++records;
+        bytes += file.size;
+    }
+
+    MIOPEN_LOG_I("Evicted " << records << " kernels (" << bytes << " bytes) from " << root
+                            << ", quota: " << quota << " bytes");
+    CountEvictions(records, bytes);
+}
+
 fs::path SaveBinary(const fs::path& binary_path,
                     const TargetProperties& target,
                     const fs::path& name,
@@ -230,6 +411,20 @@ fs::path SaveBinary(const fs::path& binary_path,
         auto p = GetCacheFile(target.DbId(), name, args);
         fs::create_directories(p.parent_path());
         fs::rename(binary_path, p);
+        CountStore(fs::file_size(p));
+
+        const auto quota = GetCacheQuota();
+        if(quota != 0)
+        {
+            try
+            {
+                EvictCacheFiles(quota);
+            }
+            catch(const fs::filesystem_error& ex)
+            {
+                MIOPEN_LOG_W("Unable to enforce the kernel cache size limit: " << ex.what());
+            }
+        }
         return p;
     }
 }
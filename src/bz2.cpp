@@ -25,9 +25,11 @@
  *******************************************************************************/
 
 #include <miopen/bz2.hpp>
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <stdexcept>
+#include <streambuf>
 #include <bzlib.h>
 
 namespace miopen {
@@ -92,4 +94,133 @@ std::vector<char> decompress(const std::vector<char>& v, unsigned int size)
     return result;
 }
 
+class Bz2InputStream::Buffer : public std::streambuf
+{
+public:
+    explicit Buffer(std::istream& source_) : source(source_), input(BufferSize), output(BufferSize)
+    {
+        Init();
+    }
+
+    Buffer(const Buffer&) = delete;
+    Buffer& operator=(const Buffer&) = delete;
+
+    ~Buffer() override
+    {
+        if(initialized)
+            BZ2_bzDecompressEnd(&stream);
+    }
+
+protected:
+    int_type underflow() override
+    {
+        if(gptr() < egptr())
+            return traits_type::to_int_type(*gptr());
+
+        output_offset += egptr() - eback();
+        setg(output.data(), output.data(), output.data());
+
+        while(!finished)
+        {
+            if(stream.avail_in == 0)
+            {
+                source.read(input.data(), static_cast<std::streamsize>(input.size()));
+                stream.next_in  = input.data();
+                stream.avail_in = static_cast<unsigned int>(source.gcount());
+
+                if(stream.avail_in == 0)
+                    check_bz2_error(BZ_UNEXPECTED_EOF, "BZ2_bzDecompress");
+            }
+
+            stream.next_out  = output.data();
+            stream.avail_out = static_cast<unsigned int>(output.size());
+
+            const auto e        = BZ2_bzDecompress(&stream);
+            const auto produced = output.size() - stream.avail_out;
+
+            if(e == BZ_STREAM_END)
+                OnStreamEnd();
+            else
+                check_bz2_error(e, "BZ2_bzDecompress");
+
+            if(produced > 0)
+            {
+                setg(output.data(), output.data(), output.data() + produced);
+                return traits_type::to_int_type(*gptr());
+            }
+        }
+
+        return traits_type::eof();
+    }
+
+    pos_type
+    seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override
+    {
+        const auto current = static_cast<off_type>(output_offset + (gptr() - eback()));
+
+        if(dir == std::ios_base::cur)
+            return seekpos(current + off, which);
+        if(dir == std::ios_base::beg)
+            return seekpos(off, which);
+        return pos_type(off_type(-1));
+    }
+
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which) override
+    {
+        const auto offset = static_cast<std::int64_t>(pos);
+
+        if((which & std::ios_base::in) == 0 || offset < output_offset ||
+           offset > output_offset + (egptr() - eback()))
+            return pos_type(off_type(-1));
+
+        setg(eback(), eback() + (offset - output_offset), egptr());
+        return pos;
+    }
+
+private:
+    static constexpr std::size_t BufferSize = 64 * 1024;
+
+    std::istream& source;
+    bz_stream stream{};
+    bool initialized = false;
+    bool finished    = false;
+    std::vector<char> input;
+    std::vector<char> output;
+    std::int64_t output_offset = 0;
+
+    void Init()
+    {
+        // Keeps the input which is left over from the previous stream.
+        const auto next_in  = stream.next_in;
+        const auto avail_in = stream.avail_in;
+        stream              = bz_stream{};
+        check_bz2_error(BZ2_bzDecompressInit(&stream, 0, 0), "BZ2_bzDecompressInit");
+        initialized     = true;
+        stream.next_in  = next_in;
+        stream.avail_in = avail_in;
+    }
+
+    void OnStreamEnd()
+    {
+        BZ2_bzDecompressEnd(&stream);
+        initialized = false;
+
+        if(stream.avail_in == 0 && source.peek() == std::istream::traits_type::eof())
+        {
+            finished = true;
+            return;
+        }
+
+        Init();
+    }
+};
+
+Bz2InputStream::Bz2InputStream(std::istream& source)
+    : std::istream(nullptr), buffer(std::make_unique<Buffer>(source))
+{
+    rdbuf(buffer.get());
+}
+
+Bz2InputStream::~Bz2InputStream() = default;
+
 } // namespace miopen
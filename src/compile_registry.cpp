@@ -0,0 +1,119 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/compile_registry.hpp>
+
+#include <miopen/logger.hpp>
+#include <miopen/target_properties.hpp>
+
+#include <exception>
+
+namespace miopen {
+
+CompileRegistry::Binary
+CompileRegistry::GetOrBuild(const std::string& key, const Builder& builder, const Lookup& lookup)
+{
+    auto promise = std::promise<Binary>{};
+    auto future  = std::shared_future<Binary>{};
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        const auto it = in_flight.find(key);
+        if(it != in_flight.end())
+        {
+            ++stats.saved_compilations;
+            future = it->second;
+        }
+        else
+        {
+            ++stats.compilations;
+            in_flight.emplace(key, promise.get_future().share());
+        }
+    }
+
+    if(future.valid())
+    {
+        MIOPEN_LOG_I2("Waiting for a concurrent build of " << key);
+        return future.get();
+    }
+
+    auto binary = Binary{};
+    auto found  = false;
+    try
+    {
+        if(lookup)
+        {
+            binary = lookup();
+            found  = !binary.empty();
+        }
+        if(found)
+            MIOPEN_LOG_I2("Found a finished build of " << key);
+        else
+            binary = builder();
+        promise.set_value(binary);
+    }
+    catch(...)
+    {
+        promise.set_exception(std::current_exception());
+        std::lock_guard<std::mutex> lock(mutex);
+        in_flight.erase(key);
+        throw;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if(found)
+    {
+        --stats.compilations;
+        ++stats.saved_compilations;
+    }
+    in_flight.erase(key);
+    return binary;
+}
+
+CompileRegistryStats CompileRegistry::GetStats() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return stats;
+}
+
+std::string CompileRegistry::MakeKey(const fs::path& program_name,
+                                     const std::string& params,
+                                     const TargetProperties& target,
+                                     const std::string& kernel_src)
+{
+    auto key = target.DbId() + '|' + program_name.string() + '|' + params;
+    // Kernels built from a string may share the name, so the source is a part of the key.
+    if(!kernel_src.empty())
+        key += '|' + std::to_string(std::hash<std::string>{}(kernel_src));
+    return key;
+}
+
+CompileRegistry& GetCompileRegistry()
+{
+    static CompileRegistry registry;
+    return registry;
+}
+
+} // namespace miopen
@@ -28,6 +28,8 @@
 #if MIOPEN_ENABLE_AI_IMMED_MODE_FALLBACK || MIOPEN_ENABLE_AI_KERNEL_TUNING
 #include <fdeep/fdeep.hpp>
 #include <miopen/filesystem.hpp>
+#include <mutex>
+#include <optional>
 
 namespace miopen {
 namespace ai {
@@ -159,8 +161,28 @@ public:
     {
         std::vector<float> features       = ToFeatures(problem);
         std::vector<fdeep::tensor> output = model.predict({fdeep::tensor(input_shape, features)});
-        std::vector<float> output_vector  = output.front().to_vector();
-        std::vector<float> res(output_vector.begin() + offset, output_vector.end());
+        return ToProbabilities(output);
+    }
+    /** Forward a batch of problems through TunaNet
+     *
+     * Same as the single problem version, but the features of all the problems are passed to
+     * TunaNet at once, and it spreads the evaluation of the rows over the available CPUs.
+     *
+     * @param problems Problems
+     */
+    std::vector<std::vector<float>>
+    Forward(const std::vector<const conv::ProblemDescription*>& problems) const
+    {
+        fdeep::tensors_vec inputs;
+        inputs.reserve(problems.size());
+        for(const auto* problem : problems)
+            inputs.push_back({fdeep::tensor(input_shape, ToFeatures(*problem))});
+
+        const fdeep::tensors_vec outputs = model.predict_multi(inputs, true);
+        std::vector<std::vector<float>> res;
+        res.reserve(outputs.size());
+        for(const auto& output : outputs)
+            res.push_back(ToProbabilities(output));
         return res;
     }
 
@@ -170,6 +192,11 @@ protected:
     const size_t offset; // Some TunaNet models output some "fluff" before they output kernel
                          // probabilites. This offset tells how many indexes of fluff need to
                          // be skipped in order to get to kernel probabilities.
+    std::vector<float> ToProbabilities(const fdeep::tensors& output) const
+    {
+        std::vector<float> output_vector = output.front().to_vector();
+        return {output_vector.begin() + offset, output_vector.end()};
+    }
     /** Path to model file for given GPU
      *
      * The model files for each GPU are identified by the GPU architecture. This function takes
@@ -493,51 +520,73 @@ protected:
     }
 };
 
-std::unique_ptr<Model> GetModel(const std::string& device)
+std::unique_ptr<Model> MakeModel(const std::string& arch)
 {
-    if(device == "gfx942")
+    if(arch == "gfx942")
         return std::make_unique<Gfx942Model>();
-    if(device == "gfx90a")
+    if(arch == "gfx90a")
         return std::make_unique<Gfx90aModel>();
-    return std::make_unique<Gfx908Model>(); // default model if GPU-specific model is not available
+    return std::make_unique<Gfx908Model>();
 }
 
-std::vector<uint64_t> PredictSolver(const conv::ProblemDescription& problem,
-                                    const ExecutionContext& ctx,
-                                    const std::string& device)
+/** Return the TunaNet model for given device
+ *
+ * The models are loaded once per architecture and shared by all the handles and threads, so a
+ * process which uses several kinds of GPUs gets the right model for each of them.
+ *
+ * @param device Device name
+ */
+const Model& GetModel(const std::string& device)
 {
-    const static std::unique_ptr<Model> model = GetModel(device);
-    if(!model || !model->IsProblemSupported(problem, ctx))
-        return {};
+    // default model if GPU-specific model is not available
+    const auto arch = (device == "gfx942" || device == "gfx90a") ? device : std::string{"gfx908"};
 
-    std::string est_name = ":memory:" + device;
-    auto& db             = AnyRamDb::GetCached(est_name);
-    auto db_res          = db.FindRecord(problem);
-    if(db_res)
+    static std::mutex mutex;
+    static std::unordered_map<std::string, std::unique_ptr<Model>> models;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = models.find(arch);
+    if(it == models.end())
+        it = models.emplace(arch, MakeModel(arch)).first;
+    return *it->second;
+}
+
+const Metadata& GetModelMetadata(const std::string& device) { return GetModel(device).metadata; }
+
+std::optional<std::vector<uint64_t>> FindCachedSolvers(AnyRamDb& db,
+                                                       const conv::ProblemDescription& problem)
+{
+    auto db_res = db.FindRecord(problem);
+    if(!db_res)
+        return std::nullopt;
+
+    MIOPEN_LOG_I2("Cached heuristic (TunaNet) result found");
+    std::vector<uint64_t> db_sol(db_res->size());
+    // cast returned record to solver ids
+    std::transform(db_res->begin(), db_res->end(), db_sol.begin(), [](boost::any id) {
+        return boost::any_cast<uint64_t>(id);
+    });
+    if(miopen::IsLogging(LoggingLevel::Info2))
     {
-        MIOPEN_LOG_I2("Cached heuristic (TunaNet) result found");
-        std::vector<uint64_t> db_sol(db_res->size());
-        // cast returned record to solver ids
-        std::transform(db_res->begin(), db_res->end(), db_sol.begin(), [](boost::any id) {
-            return boost::any_cast<uint64_t>(id);
-        });
-        if(miopen::IsLogging(LoggingLevel::Info2))
-        {
-            std::stringstream ss;
-            for(auto& id : db_sol)
-                ss << solver::Id{id}.ToString() << " ID:" << id << ", ";
-            MIOPEN_LOG_I2("Cached solvers: " << ss.str());
-        }
-        return db_sol;
+        std::stringstream ss;
+        for(auto& id : db_sol)
+            ss << solver::Id{id}.ToString() << " ID:" << id << ", ";
+        MIOPEN_LOG_I2("Cached solvers: " << ss.str());
     }
+    return db_sol;
+}
 
-    MIOPEN_LOG_I2("Evaluating TunaNet");
-    std::vector<float> res = model->Forward(problem); // res[i] gives the probability that the
-                                                      // i-th solver is the fastest for given
-                                                      // problem. ( The exact name of the i-th
-                                                      // solver may be obtained as follows:
-                                                      // model->metadata.solver_map.at(i) )
-
+/** Order the solvers by the probabilities predicted by TunaNet and cache the result
+ *
+ * @param res res[i] gives the probability that the i-th solver is the fastest for given problem.
+ *            (The exact name of the i-th solver may be obtained as follows:
+ *            model.metadata.solver_map.at(i))
+ */
+std::vector<uint64_t> RankSolvers(const Model& model,
+                                  AnyRamDb& db,
+                                  const conv::ProblemDescription& problem,
+                                  const std::vector<float>& res)
+{
     // sort solvers in order of their probabilities
     std::vector<std::pair<int, float>> sort_res(res.size());
     for(auto idx = 0; idx < res.size(); idx++)
@@ -553,10 +602,10 @@ std::vector<uint64_t> PredictSolver(const conv::ProblemDescription& problem,
     for(const auto& kinder : sort_res)
     {
         const auto id     = kinder.first; // index of solver in probability vector
-        const auto sol_id = solver::Id{model->metadata.solver_map.at(id)};
+        const auto sol_id = solver::Id{model.metadata.solver_map.at(id)};
         if(!sol_id.IsValid())
         {
-            MIOPEN_LOG_I2("Invalid solver " << model->metadata.solver_map.at(id) << " removed");
+            MIOPEN_LOG_I2("Invalid solver " << model.metadata.solver_map.at(id) << " removed");
             continue;
         }
         sol.push_back(sol_id.Value());
@@ -572,6 +621,59 @@ std::vector<uint64_t> PredictSolver(const conv::ProblemDescription& problem,
     }
     return sol;
 }
+
+std::vector<uint64_t> PredictSolver(const conv::ProblemDescription& problem,
+                                    const ExecutionContext& ctx,
+                                    const std::string& device)
+{
+    const auto& model = GetModel(device);
+    if(!model.IsProblemSupported(problem, ctx))
+        return {};
+
+    std::string est_name = ":memory:" + device;
+    auto& db             = AnyRamDb::GetCached(est_name);
+    if(auto db_sol = FindCachedSolvers(db, problem))
+        return *db_sol;
+
+    MIOPEN_LOG_I2("Evaluating TunaNet");
+    return RankSolvers(model, db, problem, model.Forward(problem));
+}
+
+std::vector<std::vector<uint64_t>>
+PredictSolvers(const std::vector<conv::ProblemDescription>& problems,
+               const ExecutionContext& ctx,
+               const std::string& device)
+{
+    const auto& model = GetModel(device);
+
+    std::string est_name = ":memory:" + device;
+    auto& db             = AnyRamDb::GetCached(est_name);
+
+    std::vector<std::vector<uint64_t>> sols(problems.size());
+    std::vector<std::size_t> pending;
+    for(auto i = std::size_t{0}; i < problems.size(); ++i)
+    {
+        if(!model.IsProblemSupported(problems[i], ctx))
+            continue;
+        if(auto db_sol = FindCachedSolvers(db, problems[i]))
+            sols[i] = std::move(*db_sol);
+        else
+            pending.push_back(i);
+    }
+    if(pending.empty())
+        return sols;
+
+    MIOPEN_LOG_I2("Evaluating TunaNet for " << pending.size() << " problems");
+    std::vector<const conv::ProblemDescription*> batch;
+    batch.reserve(pending.size());
+    for(const auto i : pending)
+        batch.push_back(&problems[i]);
+
+    const auto res = model.Forward(batch);
+    for(auto j = std::size_t{0}; j < pending.size(); ++j)
+        sols[pending[j]] = RankSolvers(model, db, problems[pending[j]], res[j]);
+    return sols;
+}
 } // namespace immed_mode
 #endif // MIOPEN_ENABLE_AI_IMMED_MODE_FALLBACK
 
@@ -665,19 +767,24 @@ private:
  * KernelTuningNet models are specific to each solver and are fine-tuned for each
  * GPU skew. This function constructs the KernelTuningNet model for the given
  * architecture and solver and stores it in a static map, so that the next time
- * the same model is required it doesn't have to be constructed anew.
+ * the same model is required it doesn't have to be constructed anew. The map is keyed by
+ * both architecture and solver, so each device of a process gets its own models.
  *
  * @param arch GPU Architecture
  * @param solver Solver
  */
 std::shared_ptr<Model> GetModel(const std::string& arch, const std::string& solver)
 {
+    static std::mutex mutex;
     static std::map<std::string, std::shared_ptr<Model>> models;
-    auto it = models.find(solver);
+
+    const auto key = arch + "_" + solver;
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = models.find(key);
     if(it == models.end())
     {
         std::shared_ptr<Model> model = std::make_shared<Model>(arch, solver);
-        models[solver]               = model;
+        models[key]                  = model;
         return model;
     }
     else
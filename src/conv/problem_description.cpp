@@ -32,8 +32,6 @@
 #include <miopen/execution_context.hpp>
 #include <miopen/tensor_layout.hpp>
 
-#include <sstream>
-
 namespace miopen {
 
 std::string
@@ -45,25 +43,6 @@ EncodeDataTypesForKey(miopenDataType_t in, miopenDataType_t weights, miopenDataT
 }
 
 namespace conv {
-namespace {
-
-std::function<void(std::ostream&)>
-PrintDHW(char sep, unsigned spatial_dims, int64_t depth, int64_t height, int64_t width)
-{
-    return [=](std::ostream& stream) {
-        if(spatial_dims > 2)
-            stream << depth << sep;
-        stream << height << sep << width;
-    };
-}
-
-std::ostream& operator<<(std::ostream& stream, std::function<void(std::ostream&)>&& manipulator)
-{
-    manipulator(stream);
-    return stream;
-}
-
-} // namespace
 
 miopenAlphaBetaCase_t ClassifyAlphaBeta(const Scalar& alpha, const Scalar& beta)
 {
@@ -137,106 +116,57 @@ void ProblemDescription::HeuristicUpdateLayouts()
     // If we did not find consistent layout, leave them as-is
 }
 
-void ProblemDescription::MakeNetworkConfig(std::string& conf_key) const
-{
-    std::ostringstream ss;
-
-    ss << GetInChannels();
-    ss << 'x' << PrintDHW('x', GetSpatialDims(), GetInDepth(), GetInHeight(), GetInWidth());
-    ss << 'x'
-       << PrintDHW('x', GetSpatialDims(), GetWeightsDepth(), GetWeightsHeight(), GetWeightsWidth());
-    ss << 'x' << GetOutChannels();
-    ss << 'x' << PrintDHW('x', GetSpatialDims(), GetOutDepth(), GetOutHeight(), GetOutWidth());
-    ss << 'x' << GetInBatchSize();
-    if((GetInLayout() == "NCHW" && GetWeightsLayout() == "NCHW" && GetOutLayout() == "NCHW") ||
-       (GetInLayout() == "NCDHW" && GetWeightsLayout() == "NCDHW" && GetOutLayout() == "NCDHW"))
-    {
-        ss << 'x' << GetInLayout();
-    }
-    else
-    {
-        ss << 'x' << GetInLayout();
-        ss << 'x' << GetWeightsLayout();
-        ss << 'x' << GetOutLayout();
-    }
-    ss << 'x' << EncodeDataTypesForKey(GetInDataType(), GetWeightsDataType(), GetOutDataType());
-
-    std::ostringstream optional;
-    if(const auto ct = GetInCastType())
-        optional << "ci" << GetDataTypeName(*ct);
-    if(const auto ct = GetWeightsCastType())
-        optional << "cw" << GetDataTypeName(*ct);
-    if(const auto ct = GetOutCastType())
-        optional << "co" << GetDataTypeName(*ct);
-    if(!optional.str().empty())
-    {
-        ss << 'x' << optional.str();
-    }
+ProblemKey ProblemDescription::MakeKey() const
+{
+    auto key = ProblemKey{};
+
+    key.in_channels    = GetInChannels();
+    key.in_depth       = GetInDepth();
+    key.in_height      = GetInHeight();
+    key.in_width       = GetInWidth();
+    key.weights_depth  = GetWeightsDepth();
+    key.weights_height = GetWeightsHeight();
+    key.weights_width  = GetWeightsWidth();
+    key.out_channels   = GetOutChannels();
+    key.out_depth      = GetOutDepth();
+    key.out_height     = GetOutHeight();
+    key.out_width      = GetOutWidth();
+    key.batch_size     = GetInBatchSize();
+
+    key.pads        = {GetPadD(), GetPadH(), GetPadW()};
+    key.strides     = {GetKernelStrideD(), GetKernelStrideH(), GetKernelStrideW()};
+    key.dilations   = {GetDilationD(), GetDilationH(), GetDilationW()};
+    key.group_count = GetGroupCount();
+    key.bias        = GetBias();
+    key.data_types  = {static_cast<std::int32_t>(GetInDataType()),
+                      static_cast<std::int32_t>(GetWeightsDataType()),
+                      static_cast<std::int32_t>(GetOutDataType())};
+
+    const auto cast_type = [](const std::optional<miopenDataType_t>& type) {
+        return type ? static_cast<std::int32_t>(*type) : ProblemKey::no_cast_type;
+    };
+    key.cast_types = {
+        cast_type(GetInCastType()), cast_type(GetWeightsCastType()), cast_type(GetOutCastType())};
 
-    ss << 'x' << PrintDHW('x', GetSpatialDims(), GetPadD(), GetPadH(), GetPadW());
-    ss << 'x'
-       << PrintDHW(
-              'x', GetSpatialDims(), GetKernelStrideD(), GetKernelStrideH(), GetKernelStrideW());
-    ss << 'x' << PrintDHW('x', GetSpatialDims(), GetDilationD(), GetDilationH(), GetDilationW());
-    ss << 'x' << GetGroupCount();
-    ss << 'x' << GetDirectionStr();
-    ss << 'x' << GetAlphaBetaCaseStr();
+    key.in_layout      = ProblemKey::MakeLayout(in_layout);
+    key.weights_layout = ProblemKey::MakeLayout(weights_layout);
+    key.out_layout     = ProblemKey::MakeLayout(out_layout);
 
-    conf_key = ss.str();
+    key.spatial_dims    = static_cast<std::uint8_t>(GetSpatialDims());
+    key.direction       = static_cast<std::uint8_t>(direction);
+    key.alpha_beta_case = static_cast<std::uint8_t>(alpha_beta_case);
+
+    key.Seal();
+    return key;
 }
 
-void ProblemDescription::Serialize(std::ostream& stream) const
+void ProblemDescription::MakeNetworkConfig(std::string& conf_key) const
 {
-    const auto sep = '-';
-    // Problem description with default layout
-    // 576-4-4-1x1-192-4-4-8-1x1-2x2-3x3-0-NCHW-FP32-F
-    // Problem description with non-default layout
-    // 576-4-4-1x1-192-4-4-8-1x1-2x2-3x3-0-NHWC-NCHW-NCHW-FP32-F
-    // clang-format off
-    stream << GetInChannels();
-    stream << sep << PrintDHW(sep, GetSpatialDims(), GetInDepth(), GetInHeight(), GetInWidth());
-    stream << sep << PrintDHW('x', GetSpatialDims(), GetWeightsDepth(), GetWeightsHeight(), GetWeightsWidth());
-    stream << sep << GetOutChannels();
-    stream << sep << PrintDHW(sep, GetSpatialDims(), GetOutDepth(), GetOutHeight(), GetOutWidth());
-    stream << sep << GetInBatchSize();
-    stream << sep << PrintDHW('x', GetSpatialDims(), GetPadD(), GetPadH(), GetPadW());
-    stream << sep << PrintDHW('x', GetSpatialDims(), GetKernelStrideD(), GetKernelStrideH(), GetKernelStrideW());
-    stream << sep << PrintDHW('x', GetSpatialDims(), GetDilationD(), GetDilationH(), GetDilationW());
-    stream << sep << GetBias();
-    if ((GetInLayout() == "NCHW" && GetWeightsLayout() == "NCHW" && GetOutLayout() == "NCHW")
-        || (GetInLayout() == "NCDHW" && GetWeightsLayout() == "NCDHW" && GetOutLayout() == "NCDHW"))
-    {
-        stream << sep << GetInLayout();
-    } else {
-        stream << sep << GetInLayout();
-        stream << sep << GetWeightsLayout();
-        stream << sep << GetOutLayout();
-    }
-    stream << sep << EncodeDataTypesForKey(GetInDataType(), GetWeightsDataType(), GetOutDataType());
-    stream << sep << GetDirectionStr();
-
-    // clang-format on
-    // New performance config entries shall come into variable/optional part of db key.
-    // This is to support backward compatibility with previous versions of databases.
-    std::ostringstream optional;
-    {
-        // Group count > 1 identifies Group/Depthwise modes.
-        if(GetGroupCount() != 1)
-            optional << "_g" << GetGroupCount();
-
-        if(const auto ct = GetInCastType())
-            optional << "_ci" << GetDataTypeName(*ct);
-        if(const auto ct = GetWeightsCastType())
-            optional << "_cw" << GetDataTypeName(*ct);
-        if(const auto ct = GetOutCastType())
-            optional << "_co" << GetDataTypeName(*ct);
-    }
-    if(!optional.str().empty())
-    {
-        stream << optional.str();
-    }
+    conf_key = MakeKey().ToString();
 }
 
+void ProblemDescription::Serialize(std::ostream& stream) const { stream << MakeKey().ToDbKey(); }
+
 bool ProblemDescription::IsLayoutDefault() const
 {
     if(GetSpatialDims() == 2)
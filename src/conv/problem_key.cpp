@@ -0,0 +1,265 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/conv/problem_key.hpp>
+
+#include <miopen/conv/problem_description.hpp>
+#include <miopen/errors.hpp>
+
+#include <algorithm>
+#include <charconv>
+
+namespace miopen {
+namespace conv {
+namespace {
+
+void Append(std::string& str, std::int64_t value)
+{
+    char buffer[24];
+    const auto end = std::to_chars(std::begin(buffer), std::end(buffer), value).ptr;
+    str.append(buffer, end);
+}
+
+void AppendDHW(std::string& str,
+               char sep,
+               unsigned spatial_dims,
+               std::int64_t depth,
+               std::int64_t height,
+               std::int64_t width)
+{
+    if(spatial_dims > 2)
+    {
+        Append(str, depth);
+        str += sep;
+    }
+    Append(str, height);
+    str += sep;
+    Append(str, width);
+}
+
+void AppendDHW(std::string& str,
+               char sep,
+               unsigned spatial_dims,
+               const std::array<std::int32_t, 3>& values)
+{
+    AppendDHW(str, sep, spatial_dims, values[0], values[1], values[2]);
+}
+
+void AppendLayouts(std::string& str, char sep, const ProblemKey& key)
+{
+    const auto in      = ProblemKey::GetLayout(key.in_layout);
+    const auto weights = ProblemKey::GetLayout(key.weights_layout);
+    const auto out     = ProblemKey::GetLayout(key.out_layout);
+
+    str += in;
+    if((in == "NCHW" && weights == "NCHW" && out == "NCHW") ||
+       (in == "NCDHW" && weights == "NCDHW" && out == "NCDHW"))
+        return;
+    str += sep;
+    str += weights;
+    str += sep;
+    str += out;
+}
+
+void AppendDataTypes(std::string& str, const ProblemKey& key)
+{
+    str += EncodeDataTypesForKey(static_cast<miopenDataType_t>(key.data_types[0]),
+                                 static_cast<miopenDataType_t>(key.data_types[1]),
+                                 static_cast<miopenDataType_t>(key.data_types[2]));
+}
+
+void AppendCastTypes(std::string& str, const char* prefix, const ProblemKey& key)
+{
+    static const char* const names[] = {"ci", "cw", "co"};
+    for(auto i = 0; i < 3; ++i)
+    {
+        if(key.cast_types[i] == ProblemKey::no_cast_type)
+            continue;
+        str += prefix;
+        str += names[i];
+        str += GetDataTypeName(static_cast<miopenDataType_t>(key.cast_types[i]));
+    }
+}
+
+bool HasCastTypes(const ProblemKey& key)
+{
+    return std::any_of(key.cast_types.begin(), key.cast_types.end(), [](auto type) {
+        return type != ProblemKey::no_cast_type;
+    });
+}
+
+const char* GetDirectionStr(const ProblemKey& key)
+{
+    switch(key.GetDirection())
+    {
+    case Direction::Forward: return "F";
+    case Direction::BackwardData: return "B";
+    case Direction::BackwardWeights: return "W";
+    }
+    return "";
+}
+
+const char* GetAlphaBetaCaseStr(const ProblemKey& key)
+{
+    switch(static_cast<miopenAlphaBetaCase_t>(key.alpha_beta_case))
+    {
+    case BILINEAR: return "Bilinear";
+    case SCALE: return "Scale";
+    case DEFAULT: return "Default";
+    default: MIOPEN_THROW(miopenStatusInvalidValue, "Alpha Beta Case in ERROR_STATE");
+    }
+}
+
+} // namespace
+
+ProblemKey::Layout ProblemKey::MakeLayout(std::string_view layout)
+{
+    auto ret = Layout{};
+    if(layout.size() > ret.size())
+        MIOPEN_THROW(miopenStatusInternalError, "Layout is too long: " + std::string{layout});
+    std::copy(layout.begin(), layout.end(), ret.begin());
+    return ret;
+}
+
+std::string_view ProblemKey::GetLayout(const Layout& layout)
+{
+    const auto end = std::find(layout.begin(), layout.end(), '\0');
+    return {layout.data(), static_cast<std::size_t>(end - layout.begin())};
+}
+
+void ProblemKey::Seal()
+{
+    // FNV-1a over 64-bit words followed by the murmur3 finalizer, so that close problems do
+    // not end up in close buckets.
+    constexpr auto n_words = offsetof(ProblemKey, hash) / sizeof(std::uint64_t);
+    static_assert(offsetof(ProblemKey, hash) % sizeof(std::uint64_t) == 0);
+
+    const auto* bytes = reinterpret_cast<const char*>(this);
+    auto h            = std::uint64_t{0xcbf29ce484222325};
+    for(auto i = std::size_t{0}; i < n_words; ++i)
+    {
+        std::uint64_t word;
+        std::memcpy(&word, bytes + i * sizeof(word), sizeof(word));
+        h = (h ^ word) * 0x100000001b3;
+    }
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccd;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53;
+    h ^= h >> 33;
+    hash = h;
+}
+
+std::string ProblemKey::ToString() const
+{
+    std::string ret;
+    ret.reserve(128);
+
+    Append(ret, in_channels);
+    ret += 'x';
+    AppendDHW(ret, 'x', spatial_dims, in_depth, in_height, in_width);
+    ret += 'x';
+    AppendDHW(ret, 'x', spatial_dims, weights_depth, weights_height, weights_width);
+    ret += 'x';
+    Append(ret, out_channels);
+    ret += 'x';
+    AppendDHW(ret, 'x', spatial_dims, out_depth, out_height, out_width);
+    ret += 'x';
+    Append(ret, batch_size);
+    ret += 'x';
+    AppendLayouts(ret, 'x', *this);
+    ret += 'x';
+    AppendDataTypes(ret, *this);
+    if(HasCastTypes(*this))
+    {
+        ret += 'x';
+        AppendCastTypes(ret, "", *this);
+    }
+    ret += 'x';
+    AppendDHW(ret, 'x', spatial_dims, pads);
+    ret += 'x';
+    AppendDHW(ret, 'x', spatial_dims, strides);
+    ret += 'x';
+    AppendDHW(ret, 'x', spatial_dims, dilations);
+    ret += 'x';
+    Append(ret, group_count);
+    ret += 'x';
+    ret += GetDirectionStr(*this);
+    ret += 'x';
+    ret += GetAlphaBetaCaseStr(*this);
+    return ret;
+}
+
+std::string ProblemKey::ToDbKey() const
+{
+    const auto sep = '-';
+    std::string ret;
+    ret.reserve(128);
+
+    // Problem description with default layout
+    // 576-4-4-1x1-192-4-4-8-1x1-2x2-3x3-0-NCHW-FP32-F
+    // Problem description with non-default layout
+    // 576-4-4-1x1-192-4-4-8-1x1-2x2-3x3-0-NHWC-NCHW-NCHW-FP32-F
+    Append(ret, in_channels);
+    ret += sep;
+    AppendDHW(ret, sep, spatial_dims, in_depth, in_height, in_width);
+    ret += sep;
+    AppendDHW(ret, 'x', spatial_dims, weights_depth, weights_height, weights_width);
+    ret += sep;
+    Append(ret, out_channels);
+    ret += sep;
+    AppendDHW(ret, sep, spatial_dims, out_depth, out_height, out_width);
+    ret += sep;
+    Append(ret, batch_size);
+    ret += sep;
+    AppendDHW(ret, 'x', spatial_dims, pads);
+    ret += sep;
+    AppendDHW(ret, 'x', spatial_dims, strides);
+    ret += sep;
+    AppendDHW(ret, 'x', spatial_dims, dilations);
+    ret += sep;
+    Append(ret, bias);
+    ret += sep;
+    AppendLayouts(ret, sep, *this);
+    ret += sep;
+    AppendDataTypes(ret, *this);
+    ret += sep;
+    ret += GetDirectionStr(*this);
+
+    // New performance config entries shall come into variable/optional part of db key.
+    // This is to support backward compatibility with previous versions of databases.
+    // Group count > 1 identifies Group/Depthwise modes.
+    if(group_count != 1)
+    {
+        ret += "_g";
+        Append(ret, group_count);
+    }
+    AppendCastTypes(ret, "_", *this);
+    return ret;
+}
+
+} // namespace conv
+} // namespace miopen
@@ -0,0 +1,172 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/conv/tuning_work.hpp>
+
+#include <miopen/any_solver.hpp>
+#include <miopen/conv/problem_description.hpp>
+#include <miopen/conv/solver_finders.hpp>
+#include <miopen/datatype.hpp>
+#include <miopen/db_record.hpp>
+#include <miopen/errors.hpp>
+#include <miopen/execution_context.hpp>
+#include <miopen/handle.hpp>
+#include <miopen/logger.hpp>
+#include <miopen/mlo_internal.hpp>
+#include <miopen/problem.hpp>
+#include <miopen/solver_id.hpp>
+
+#include <nlohmann/json.hpp>
+
+#include <memory>
+#include <tuple>
+
+namespace miopen {
+namespace conv {
+namespace {
+
+const ConvolutionDescriptor& GetConvolution(const Problem& problem)
+{
+    const auto conv_desc = std::get_if<ConvolutionDescriptor>(&problem.GetOperatorDescriptor());
+    if(conv_desc == nullptr)
+        MIOPEN_THROW(miopenStatusNotImplemented, "Only convolution problems can be tuned");
+    return *conv_desc;
+}
+
+/// The problem which is actually solved, see Problem::FindSolutions().
+Problem GetSolvedProblem(const Problem& problem)
+{
+    return GetConvolution(problem).mode == miopenTranspose ? problem.MakeTransposed() : problem;
+}
+
+} // namespace
+
+std::string SerializeTuningProblem(const Problem& problem)
+{
+    std::ignore = GetConvolution(problem);
+    return nlohmann::json(problem).dump();
+}
+
+Problem DeserializeTuningProblem(const std::string& str)
+{
+    auto problem = Problem{};
+    try
+    {
+        nlohmann::json::parse(str).get_to(problem);
+    }
+    catch(const nlohmann::json::exception& ex)
+    {
+        MIOPEN_THROW(miopenStatusInvalidValue, "Invalid tuning problem: " + std::string{ex.what()});
+    }
+    std::ignore = GetConvolution(problem);
+    return problem;
+}
+
+std::vector<solver::TuningWorkItem>
+MakeTuningWork(Handle& handle, const Problem& problem, std::size_t n_shards)
+{
+    const auto conv_problem = GetSolvedProblem(problem).AsConvolution();
+    auto ctx                = ExecutionContext{&handle};
+    conv_problem.SetupFloats(ctx);
+
+    auto item    = solver::TuningWorkItem{};
+    item.key     = DbRecord{DbKinds::PerfDb, conv_problem}.GetKey();
+    item.problem = SerializeTuningProblem(problem);
+
+    auto items = std::vector<solver::TuningWorkItem>{};
+    for(const auto& id : solver::GetSolversByPrimitive(solver::Primitive::Convolution))
+    {
+        if(IsAlgorithmDisabled(id.GetAlgo()))
+            continue;
+        const auto s = id.GetSolver();
+        if(s.IsEmpty() || !s.IsTunable() || !s.IsApplicable(ctx, conv_problem))
+            continue;
+
+        item.solver       = s.GetSolverDbId();
+        const auto shards = solver::ShardTuningWork(item, n_shards);
+        items.insert(items.end(), shards.begin(), shards.end());
+    }
+
+    MIOPEN_LOG_I(item.key << ": " << items.size() << " tuning items");
+    return items;
+}
+
+std::optional<solver::TuningResult> Tune(Handle& handle, const solver::TuningWorkItem& item)
+{
+    const auto id = solver::Id{item.solver};
+    const auto s  = id.IsValid() ? id.GetSolver() : solver::AnySolver{};
+    if(s.IsEmpty())
+        MIOPEN_THROW(miopenStatusInvalidValue, "Unknown solver: " + item.solver);
+
+    const auto problem      = GetSolvedProblem(DeserializeTuningProblem(item.problem));
+    const auto conv_problem = problem.AsConvolution();
+
+    auto ctx = ExecutionContext{&handle};
+    conv_problem.SetupFloats(ctx);
+    // Searches even if the perf-db has a record already.
+    ctx.do_search           = true;
+    ctx.db_update           = true;
+    ctx.tuning_shard        = std::make_shared<solver::TuningShard>();
+    ctx.tuning_shard->index = item.shard;
+    ctx.tuning_shard->count = item.n_shards;
+
+    // The search runs the kernels on these buffers, their contents do not matter.
+    const auto& x_desc =
+        problem.GetTensorDescriptorChecked(miopenTensorConvolutionX, "miopenTensorConvolutionX");
+    const auto& w_desc =
+        problem.GetTensorDescriptorChecked(miopenTensorConvolutionW, "miopenTensorConvolutionW");
+    const auto& y_desc =
+        problem.GetTensorDescriptorChecked(miopenTensorConvolutionY, "miopenTensorConvolutionY");
+    const auto allocate = [&](const TensorDescriptor& desc) {
+        return handle.Create(desc.GetElementSpace() * get_data_size(desc.GetType()));
+    };
+    const auto x = allocate(x_desc);
+    const auto w = allocate(w_desc);
+    const auto y = allocate(y_desc);
+
+    const auto workspace_size = s.GetWorkspaceSize(ctx, conv_problem);
+    const auto workspace      = workspace_size != 0 ? handle.Create(workspace_size) : nullptr;
+
+    const auto invoke_ctx = problem.MakeConvInvokeParams(
+        x_desc, x.get(), w_desc, w.get(), y_desc, y.get(), workspace.get(), workspace_size);
+
+    auto db = GetDb(ctx);
+    // A failed search is logged, and there is no result then.
+    std::ignore = s.FindSolution(ctx, conv_problem, db, invoke_ctx);
+    return ctx.tuning_shard->result;
+}
+
+std::size_t MergeTuningResults(Handle& handle, const solver::TuningQueue& queue)
+{
+    const auto ctx = ExecutionContext{&handle};
+    auto db        = GetDb(ctx);
+    return solver::MergeTuningResults(queue, db, [](const solver::TuningWorkItem& item) {
+        return GetSolvedProblem(DeserializeTuningProblem(item.problem)).AsConvolution();
+    });
+}
+
+} // namespace conv
+} // namespace miopen
@@ -24,6 +24,7 @@
  *
  *******************************************************************************/
 #include <miopen/db.hpp>
+#include <miopen/db_binary.hpp>
 #include <miopen/db_record.hpp>
 #include <miopen/errors.hpp>
 #include <miopen/lock_file.hpp>
@@ -43,10 +44,20 @@
 #include <mutex>
 #include <shared_mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace miopen {
 
+/// User dbs are searched line by line and edited in place, which the binary format doesn't allow.
+static bool IsBinaryUserDb(std::istream& file, const fs::path& filename)
+{
+    if(!DbBinary::IsBinary(file))
+        return false;
+    MIOPEN_LOG_E("Binary dbs are only supported as system dbs: " << filename);
+    return true;
+}
+
 PlainTextDb::PlainTextDb(DbKinds db_kind_, const fs::path& filename_, bool is_system)
     : db_kind(db_kind_),
       filename(filename_),
@@ -93,6 +104,84 @@ boost::optional<DbRecord> PlainTextDb::FindRecord(const std::string& key)
     return FindRecordUnsafe(key, nullptr);
 }
 
+std::vector<boost::optional<DbRecord>>
+PlainTextDb::FindRecords(const std::vector<std::string>& keys)
+{
+    auto records = std::vector<boost::optional<DbRecord>>(keys.size());
+    if(DisableUserDbFileIO || keys.empty())
+        return records;
+
+    const auto lock = shared_lock(lock_file, GetLockTimeout());
+    MIOPEN_VALIDATE_LOCK(lock);
+
+    MIOPEN_LOG_I2("Looking for " << keys.size() << " keys in file " << filename);
+
+    std::ifstream file(filename, std::ios::binary);
+
+    if(!file)
+    {
+        const auto log_level = IsWarningIfUnreadable() && !MIOPEN_DISABLE_SYSDB
+                                   ? LoggingLevel::Warning
+                                   : LoggingLevel::Info2;
+        MIOPEN_LOG(log_level, "File is unreadable: " << filename);
+        return records;
+    }
+
+    if(IsBinaryUserDb(file, filename))
+        return records;
+
+    auto pending = std::unordered_map<std::string, std::vector<std::size_t>>{};
+    for(std::size_t i = 0; i < keys.size(); ++i)
+        pending[keys[i]].push_back(i);
+
+    int n_line = 0;
+    std::string line;
+    while(!pending.empty() && std::getline(file, line))
+    {
+        ++n_line;
+
+        const auto key_size = line.find('=');
+        const bool is_key   = (key_size != std::string::npos && key_size != 0);
+        if(!is_key)
+        {
+            if(!line.empty()) // Do not blame empty lines.
+            {
+                MIOPEN_LOG_E("Ill-formed record: key not found: " << filename << "#" << n_line);
+            }
+            continue;
+        }
+
+        const auto it = pending.find(line.substr(0, key_size));
+        if(it == pending.end())
+            continue;
+
+        const auto contents = line.substr(key_size + 1);
+
+        if(contents.empty())
+        {
+            MIOPEN_LOG_E("None contents under the key: " << it->first << " form file " << filename
+                                                         << "#" << n_line);
+            continue;
+        }
+
+        DbRecord record(it->first);
+
+        if(!record.ParseContents(contents))
+        {
+            MIOPEN_LOG_E("Error parsing payload under the key: " << it->first << " form file "
+                                                                 << filename << "#" << n_line);
+            MIOPEN_LOG_E("Contents: " << contents);
+        }
+
+        // The first record with a matching key wins, as with FindRecord().
+        for(const auto i : it->second)
+            records[i] = record;
+        pending.erase(it);
+    }
+
+    return records;
+}
+
 bool PlainTextDb::StoreRecord(const DbRecord& record)
 {
     if(DisableUserDbFileIO)
@@ -157,6 +246,9 @@ boost::optional<DbRecord> PlainTextDb::FindRecordUnsafe(const std::string& key,
         return boost::none;
     }
 
+    if(IsBinaryUserDb(file, filename))
+        return boost::none;
+
     int n_line = 0;
     while(true)
     {
@@ -236,6 +328,12 @@ bool PlainTextDb::FlushUnsafe(const DbRecord& record, const RecordPositions* pos
 {
     assert(pos);
 
+    {
+        auto existing = std::ifstream{filename, std::ios::binary};
+        if(existing && IsBinaryUserDb(existing, filename))
+            return false;
+    }
+
     if(pos->begin < 0 || pos->end < 0)
     {
         {
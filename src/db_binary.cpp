@@ -0,0 +1,479 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/db_binary.hpp>
+#include <miopen/db_path.hpp>
+#include <miopen/logger.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <optional>
+#include <random>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+namespace miopen {
+
+namespace {
+
+constexpr char BinaryMagic[8] = {'M', 'I', 'O', 'D', 'B', 'B', 'I', 'N'};
+
+enum class FieldKind : std::uint64_t
+{
+    Integer         = 0,
+    NegativeInteger = 1,
+    TableString     = 2,
+    InlineString    = 3,
+};
+
+constexpr auto FieldKindBits = 2;
+
+void WriteVarint(std::ostream& stream, std::uint64_t value)
+{
+    while(value >= 0x80)
+    {
+        stream.put(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    stream.put(static_cast<char>(value));
+}
+
+bool ReadVarint(std::istream& stream, std::uint64_t& value)
+{
+    value = 0;
+    for(auto shift = 0; shift < 64; shift += 7)
+    {
+        const auto c = stream.get();
+        if(c == std::istream::traits_type::eof())
+            return false;
+        value |= static_cast<std::uint64_t>(c & 0x7F) << shift;
+        if((c & 0x80) == 0)
+            return true;
+    }
+    return false;
+}
+
+void WriteString(std::ostream& stream, std::string_view str)
+{
+    WriteVarint(stream, str.size());
+    stream.write(str.data(), static_cast<std::streamsize>(str.size()));
+}
+
+bool ReadBytes(std::istream& stream, std::uint64_t size, std::string& str)
+{
+    // Grows with the data actually read, so a corrupt size can't trigger a huge allocation.
+    str.clear();
+    constexpr auto chunk = std::uint64_t{4096};
+    while(size > 0)
+    {
+        const auto n   = std::min(size, chunk);
+        const auto pos = str.size();
+        str.resize(pos + n);
+        if(!stream.read(&str[pos], static_cast<std::streamsize>(n)))
+            return false;
+        size -= n;
+    }
+    return true;
+}
+
+bool ReadString(std::istream& stream, std::string& str)
+{
+    auto size = std::uint64_t{};
+    return ReadVarint(stream, size) && ReadBytes(stream, size, str);
+}
+
+/// Returns the value if the field is an integer which prints back exactly the same.
+std::optional<std::pair<FieldKind, std::uint64_t>> ParseInteger(std::string_view field)
+{
+    const auto negative = !field.empty() && field.front() == '-';
+    const auto digits   = negative ? field.substr(1) : field;
+
+    // Up to 18 digits, so the value shifted by the kind bits fits 64 bits.
+    if(digits.empty() || digits.size() > 18 || (digits.front() == '0' && digits.size() > 1) ||
+       (negative && digits == "0"))
+        return std::nullopt;
+
+    auto value = std::uint64_t{0};
+    for(const auto c : digits)
+    {
+        if(c < '0' || c > '9')
+            return std::nullopt;
+        value = value * 10 + static_cast<std::uint64_t>(c - '0');
+    }
+
+    return std::make_pair(negative ? FieldKind::NegativeInteger : FieldKind::Integer, value);
+}
+
+template <class TFunc>
+void ForEachSplit(std::string_view str, char separator, TFunc&& func)
+{
+    while(true)
+    {
+        const auto pos = str.find(separator);
+        func(str.substr(0, pos));
+        if(pos == std::string_view::npos)
+            return;
+        str.remove_prefix(pos + 1);
+    }
+}
+
+struct Entry
+{
+    std::string_view id;
+    std::vector<std::string_view> fields;
+};
+
+/// Returns false if the contents can't be restored exactly from entries, i.e. there are empty or
+/// ill-formed entries. Such contents are stored as is.
+bool ParseEntries(std::string_view content, std::vector<Entry>& entries)
+{
+    entries.clear();
+    if(content.empty())
+        return false;
+
+    auto ok = true;
+    ForEachSplit(content, ';', [&](std::string_view item) {
+        const auto colon = item.find(':');
+        if(colon == std::string_view::npos || colon == 0)
+        {
+            ok = false;
+            return;
+        }
+
+        auto entry        = Entry{item.substr(0, colon), {}};
+        const auto values = item.substr(colon + 1);
+
+        if(!values.empty())
+        {
+            ForEachSplit(
+                values, ',', [&](std::string_view field) { entry.fields.push_back(field); });
+        }
+
+        entries.push_back(std::move(entry));
+    });
+
+    return ok;
+}
+
+} // namespace
+
+bool DbBinary::IsBinary(std::istream& stream)
+{
+    const auto pos = stream.tellg();
+    char magic[sizeof(BinaryMagic)];
+    const auto is_binary = stream.read(magic, sizeof(magic)) &&
+                           std::memcmp(magic, BinaryMagic, sizeof(BinaryMagic)) == 0;
+    stream.clear();
+    stream.seekg(pos);
+    return is_binary;
+}
+
+bool DbBinary::IsBinary(const fs::path& path)
+{
+    auto file = std::ifstream{path, std::ios::binary};
+    return file && IsBinary(file);
+}
+
+bool DbBinary::Write(std::ostream& stream, const std::vector<Record>& records)
+{
+    auto parsed   = std::vector<std::vector<Entry>>(records.size());
+    auto is_entry = std::vector<bool>(records.size());
+    auto counts   = std::unordered_map<std::string_view, std::size_t>{};
+    auto ids      = std::unordered_set<std::string_view>{};
+
+    for(std::size_t i = 0; i < records.size(); ++i)
+    {
+        is_entry[i] = ParseEntries(records[i].content, parsed[i]);
+        if(!is_entry[i])
+            continue;
+
+        for(const auto& entry : parsed[i])
+        {
+            ++counts[entry.id];
+            ids.insert(entry.id);
+            for(const auto field : entry.fields)
+                if(!ParseInteger(field))
+                    ++counts[field];
+        }
+    }
+
+    // Ids are always in the table, other strings only if they repeat.
+    auto table = std::vector<std::pair<std::string_view, std::size_t>>{};
+    for(const auto& count : counts)
+        if(count.second > 1 || ids.count(count.first) != 0)
+            table.push_back(count);
+
+    // The most frequent strings get the shortest indices.
+    std::sort(table.begin(), table.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.second != rhs.second ? lhs.second > rhs.second : lhs.first < rhs.first;
+    });
+
+    auto indices = std::unordered_map<std::string_view, std::uint64_t>{};
+    for(std::size_t i = 0; i < table.size(); ++i)
+        indices.emplace(table[i].first, i);
+
+    const auto version = Version;
+    stream.write(BinaryMagic, sizeof(BinaryMagic));
+    for(auto i = 0; i < 4; ++i)
+        stream.put(static_cast<char>((version >> (8 * i)) & 0xFF));
+
+    WriteVarint(stream, table.size());
+    for(const auto& item : table)
+        WriteString(stream, item.first);
+
+    WriteVarint(stream, records.size());
+    for(std::size_t i = 0; i < records.size(); ++i)
+    {
+        WriteString(stream, records[i].key);
+
+        if(!is_entry[i])
+        {
+            WriteVarint(stream, 0);
+            WriteString(stream, records[i].content);
+            continue;
+        }
+
+        WriteVarint(stream, parsed[i].size());
+        for(const auto& entry : parsed[i])
+        {
+            WriteVarint(stream, indices.at(entry.id));
+            WriteVarint(stream, entry.fields.size());
+
+            for(const auto field : entry.fields)
+            {
+                const auto write_tag = [&](FieldKind kind, std::uint64_t value) {
+                    WriteVarint(stream,
+                                (value << FieldKindBits) | static_cast<std::uint64_t>(kind));
+                };
+
+                if(const auto integer = ParseInteger(field))
+                {
+                    write_tag(integer->first, integer->second);
+                }
+                else if(const auto index = indices.find(field); index != indices.end())
+                {
+                    write_tag(FieldKind::TableString, index->second);
+                }
+                else
+                {
+                    write_tag(FieldKind::InlineString, field.size());
+                    stream.write(field.data(), static_cast<std::streamsize>(field.size()));
+                }
+            }
+        }
+    }
+
+    return static_cast<bool>(stream);
+}
+
+bool DbBinary::Read(std::istream& stream,
+                    const std::function<void(std::string&& key, std::string&& content)>& func)
+{
+    char magic[sizeof(BinaryMagic)];
+    unsigned char version_bytes[4];
+
+    if(!stream.read(magic, sizeof(magic)) ||
+       std::memcmp(magic, BinaryMagic, sizeof(BinaryMagic)) != 0 ||
+       !stream.read(reinterpret_cast<char*>(version_bytes), sizeof(version_bytes)))
+        return false;
+
+    auto version = std::uint32_t{0};
+    for(auto i = 0; i < 4; ++i)
+        version |= static_cast<std::uint32_t>(version_bytes[i]) << (8 * i);
+
+    if(version != Version)
+    {
+        MIOPEN_LOG_W("Unsupported binary db version: " << version);
+        return false;
+    }
+
+    auto table_size = std::uint64_t{};
+    if(!ReadVarint(stream, table_size))
+        return false;
+
+    auto table = std::vector<std::string>{};
+    for(std::uint64_t i = 0; i < table_size; ++i)
+    {
+        auto str = std::string{};
+        if(!ReadString(stream, str))
+            return false;
+        table.push_back(std::move(str));
+    }
+
+    auto num_records = std::uint64_t{};
+    if(!ReadVarint(stream, num_records))
+        return false;
+
+    auto key     = std::string{};
+    auto content = std::string{};
+    auto field   = std::string{};
+
+    for(std::uint64_t i = 0; i < num_records; ++i)
+    {
+        auto num_entries = std::uint64_t{};
+        if(!ReadString(stream, key) || !ReadVarint(stream, num_entries))
+            return false;
+
+        if(num_entries == 0)
+        {
+            if(!ReadString(stream, content))
+                return false;
+            func(std::move(key), std::move(content));
+            continue;
+        }
+
+        content.clear();
+
+        for(std::uint64_t e = 0; e < num_entries; ++e)
+        {
+            auto id         = std::uint64_t{};
+            auto num_fields = std::uint64_t{};
+            if(!ReadVarint(stream, id) || id >= table.size() || !ReadVarint(stream, num_fields))
+                return false;
+
+            if(e != 0)
+                content += ';';
+            content.append(table[id]).append(1, ':');
+
+            for(std::uint64_t f = 0; f < num_fields; ++f)
+            {
+                auto tag = std::uint64_t{};
+                if(!ReadVarint(stream, tag))
+                    return false;
+
+                if(f != 0)
+                    content += ',';
+
+                const auto value = tag >> FieldKindBits;
+                switch(static_cast<FieldKind>(tag & ((1 << FieldKindBits) - 1)))
+                {
+                case FieldKind::Integer: content.append(std::to_string(value)); break;
+                case FieldKind::NegativeInteger:
+                    content.append(1, '-').append(std::to_string(value));
+                    break;
+                case FieldKind::TableString:
+                    if(value >= table.size())
+                        return false;
+                    content.append(table[value]);
+                    break;
+                case FieldKind::InlineString:
+                    if(!ReadBytes(stream, value, field))
+                        return false;
+                    content.append(field);
+                    break;
+                }
+            }
+        }
+
+        func(std::move(key), std::move(content));
+    }
+
+    return true;
+}
+
+std::vector<DbBinary::Record> DbBinary::ParseText(std::istream& stream,
+                                                  const fs::path& source_path)
+{
+    auto records = std::vector<Record>{};
+    auto keys    = std::unordered_set<std::string>{};
+    auto line    = std::string{};
+    auto n_line  = 0;
+
+    while(std::getline(stream, line))
+    {
+        ++n_line;
+
+        if(line.empty())
+            continue;
+
+        const auto key_size = line.find('=');
+        const bool is_key   = (key_size != std::string::npos && key_size != 0);
+
+        if(!is_key)
+        {
+            MIOPEN_LOG_E("Ill-formed record: key not found: " << source_path << "#" << n_line);
+            continue;
+        }
+
+        auto key = line.substr(0, key_size);
+        if(!keys.insert(key).second)
+            continue;
+
+        records.push_back({std::move(key), line.substr(key_size + 1)});
+    }
+
+    return records;
+}
+
+bool DbBinary::Convert(const fs::path& text_path, const fs::path& binary_path)
+{
+    auto text = std::ifstream{text_path};
+    if(!text)
+    {
+        MIOPEN_LOG_E("File is unreadable: " << text_path);
+        return false;
+    }
+
+    const auto records = ParseText(text, text_path);
+    text.close();
+
+    const auto temp_path = binary_path + ".temp" + std::to_string(std::random_device{}());
+
+    {
+        auto file = std::ofstream{temp_path, std::ios::binary};
+
+        if(!file || !Write(file, records))
+        {
+            MIOPEN_LOG_E("Failed to write binary db: " << temp_path);
+            file.close();
+            fs::remove(temp_path);
+            return false;
+        }
+    }
+
+#if MIOPEN_WORKAROUND_USE_BOOST_FILESYSTEM
+    boost::system::error_code ec;
+#else
+    std::error_code ec;
+#endif
+    fs::rename(temp_path, binary_path, ec);
+    if(ec)
+    {
+        MIOPEN_LOG_E("Failed to rename binary db " << temp_path << ": " << ec.message());
+        fs::remove(temp_path, ec);
+        return false;
+    }
+    fs::permissions(binary_path, FS_ENUM_PERMS_ALL, ec);
+
+    MIOPEN_LOG_I("Converted " << text_path << " to binary db " << binary_path
+                              << ", records: " << records.size());
+    return true;
+}
+
+} // namespace miopen
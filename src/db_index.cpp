@@ -0,0 +1,419 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/bz2.hpp>
+#include <miopen/db_binary.hpp>
+#include <miopen/db_index.hpp>
+#include <miopen/db_path.hpp>
+#include <miopen/logger.hpp>
+
+#include <boost/interprocess/exceptions.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <optional>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace miopen {
+
+namespace {
+
+constexpr char IndexMagic[8]           = {'M', 'I', 'O', 'D', 'B', 'I', 'D', 'X'};
+constexpr std::uint32_t IndexVersion   = 1;
+constexpr std::uint32_t IndexByteOrder = 0x01020304;
+
+struct Header
+{
+    char magic[sizeof(IndexMagic)];
+    std::uint32_t version;
+    std::uint32_t byte_order;
+    std::uint64_t source_size;
+    std::int64_t source_mtime;
+    std::uint64_t num_entries;
+    std::uint64_t entries_offset;
+    std::uint64_t blob_offset;
+    std::uint64_t blob_size;
+};
+
+struct Entry
+{
+    std::uint64_t hash;
+    std::uint64_t key_offset;
+    std::uint64_t content_offset;
+    std::uint32_t key_size;
+    std::uint32_t content_size;
+    std::int32_t line;
+    std::uint32_t reserved;
+};
+
+/// FNV-1a. Must be stable across builds as it is stored in the index file.
+std::uint64_t HashKey(std::string_view key)
+{
+    auto hash = std::uint64_t{14695981039346656037ULL};
+    for(const auto c : key)
+    {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+std::int64_t GetWriteTime(const fs::path& path)
+{
+#if MIOPEN_WORKAROUND_USE_BOOST_FILESYSTEM
+    return static_cast<std::int64_t>(fs::last_write_time(path));
+#else
+    return static_cast<std::int64_t>(fs::last_write_time(path).time_since_epoch().count());
+#endif
+}
+
+struct SourceRecord
+{
+    std::uint64_t hash;
+    std::string key;
+    std::string content;
+    int line;
+};
+
+/// Sorts the records by hash and writes them under a temporary name, then renames the file.
+bool WriteIndex(std::vector<SourceRecord>& records,
+                const DbIndex::SourceStamp& stamp,
+                const fs::path& source_path,
+                const fs::path& index_path)
+{
+    // The first record wins in case of duplicate keys, as with the text db.
+    std::stable_sort(records.begin(), records.end(), [](const auto& lhs, const auto& rhs) {
+        return std::tie(lhs.hash, lhs.key) < std::tie(rhs.hash, rhs.key);
+    });
+    records.erase(std::unique(records.begin(),
+                              records.end(),
+                              [](const auto& lhs, const auto& rhs) { return lhs.key == rhs.key; }),
+                  records.end());
+
+    auto header = Header{};
+    std::memcpy(header.magic, IndexMagic, sizeof(IndexMagic));
+    header.version        = IndexVersion;
+    header.byte_order     = IndexByteOrder;
+    header.source_size    = stamp.size;
+    header.source_mtime   = stamp.mtime;
+    header.num_entries    = records.size();
+    header.entries_offset = sizeof(Header);
+    header.blob_offset    = header.entries_offset + records.size() * sizeof(Entry);
+
+    auto entries     = std::vector<Entry>{};
+    auto blob_offset = std::uint64_t{0};
+    entries.reserve(records.size());
+
+    for(const auto& record : records)
+    {
+        auto entry           = Entry{};
+        entry.hash           = record.hash;
+        entry.key_offset     = blob_offset;
+        entry.key_size       = record.key.size();
+        entry.content_offset = blob_offset + record.key.size();
+        entry.content_size   = record.content.size();
+        entry.line           = record.line;
+        blob_offset += record.key.size() + record.content.size();
+        entries.push_back(entry);
+    }
+
+    header.blob_size = blob_offset;
+
+    const auto directory = index_path.parent_path();
+    if(!directory.empty() && !fs::exists(directory))
+    {
+        if(!fs::create_directories(directory))
+        {
+            MIOPEN_LOG_W("Unable to create a directory: " << directory);
+            return false;
+        }
+        fs::permissions(directory, FS_ENUM_PERMS_ALL);
+    }
+
+    const auto temp_path = index_path + ".temp" + std::to_string(std::random_device{}());
+
+    {
+        auto file = std::ofstream{temp_path, std::ios::binary};
+
+        if(!file)
+        {
+            MIOPEN_LOG_W("Db index is unwritable: " << temp_path);
+            return false;
+        }
+
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(entries.data()),
+                   static_cast<std::streamsize>(entries.size() * sizeof(Entry)));
+        for(const auto& record : records)
+        {
+            file.write(record.key.data(), static_cast<std::streamsize>(record.key.size()));
+            file.write(record.content.data(), static_cast<std::streamsize>(record.content.size()));
+        }
+
+        if(!file)
+        {
+            MIOPEN_LOG_W("Failed to write db index: " << temp_path);
+            file.close();
+            fs::remove(temp_path);
+            return false;
+        }
+    }
+
+#if MIOPEN_WORKAROUND_USE_BOOST_FILESYSTEM
+    boost::system::error_code ec;
+#else
+    std::error_code ec;
+#endif
+    fs::rename(temp_path, index_path, ec);
+    if(ec)
+    {
+        MIOPEN_LOG_W("Failed to rename db index " << temp_path << ": " << ec.message());
+        fs::remove(temp_path, ec);
+        return false;
+    }
+    fs::permissions(index_path, FS_ENUM_PERMS_ALL, ec);
+
+    MIOPEN_LOG_I("Built db index " << index_path << " from " << source_path
+                                   << ", entries: " << records.size());
+    return true;
+}
+
+} // namespace
+
+std::optional<DbIndex::SourceStamp> DbIndex::SourceStamp::Get(const fs::path& source_path)
+{
+    try
+    {
+        if(!fs::exists(source_path))
+            return std::nullopt;
+        return SourceStamp{static_cast<std::uint64_t>(fs::file_size(source_path)),
+                           GetWriteTime(source_path)};
+    }
+    catch(const fs::filesystem_error& ex)
+    {
+        MIOPEN_LOG_I2("Unable to stat " << source_path << ": " << ex.what());
+        return std::nullopt;
+    }
+}
+
+DbIndex::DbIndex(const fs::path& index_path)
+    : file(index_path.string().c_str(), boost::interprocess::read_only),
+      region(file, boost::interprocess::read_only)
+{
+}
+
+std::unique_ptr<DbIndex> DbIndex::Open(const fs::path& index_path,
+                                       const std::optional<SourceStamp>& source)
+{
+    if(!fs::exists(index_path))
+        return nullptr;
+
+    std::unique_ptr<DbIndex> index;
+
+    try
+    {
+        index.reset(new DbIndex(index_path));
+    }
+    catch(const boost::interprocess::interprocess_exception& ex)
+    {
+        MIOPEN_LOG_W("Unable to map db index " << index_path << ": " << ex.what());
+        return nullptr;
+    }
+
+    if(!index->Validate(source))
+    {
+        MIOPEN_LOG_I("Db index is outdated or corrupt: " << index_path);
+        return nullptr;
+    }
+
+    MIOPEN_LOG_I2("Mapped db index " << index_path << ", entries: " << index->Size());
+    return index;
+}
+
+bool DbIndex::Validate(const std::optional<SourceStamp>& source) const
+{
+    const auto size = region.get_size();
+
+    if(size < sizeof(Header))
+        return false;
+
+    const auto& header = *static_cast<const Header*>(region.get_address());
+
+    if(std::memcmp(header.magic, IndexMagic, sizeof(IndexMagic)) != 0 ||
+       header.version != IndexVersion || header.byte_order != IndexByteOrder)
+        return false;
+
+    if(source && !(*source == SourceStamp{header.source_size, header.source_mtime}))
+        return false;
+
+    // The sizes are checked by subtraction so that huge values from a corrupt file cannot
+    // overflow the checks.
+    if(header.entries_offset < sizeof(Header) || header.entries_offset % alignof(Entry) != 0 ||
+       header.blob_offset < header.entries_offset || header.blob_offset > size ||
+       header.blob_size > size - header.blob_offset ||
+       header.num_entries > (header.blob_offset - header.entries_offset) / sizeof(Entry))
+        return false;
+
+    // Lookups read the blob through the entries without any checks, so each of them is checked
+    // here once, as well as the order the binary search relies on.
+    const auto entries =
+        reinterpret_cast<const Entry*>(static_cast<const char*>(region.get_address()) +
+                                       header.entries_offset);
+    for(std::uint64_t i = 0; i < header.num_entries; ++i)
+    {
+        const auto& entry = entries[i];
+        if(entry.key_offset > header.blob_size ||
+           entry.key_size > header.blob_size - entry.key_offset ||
+           entry.content_offset > header.blob_size ||
+           entry.content_size > header.blob_size - entry.content_offset ||
+           (i > 0 && entries[i - 1].hash > entry.hash))
+            return false;
+    }
+
+    return true;
+}
+
+std::size_t DbIndex::Size() const
+{
+    return static_cast<const Header*>(region.get_address())->num_entries;
+}
+
+DbIndex::Item DbIndex::GetItem(std::size_t i) const
+{
+    const auto base    = static_cast<const char*>(region.get_address());
+    const auto& header = *reinterpret_cast<const Header*>(base);
+    const auto entries = reinterpret_cast<const Entry*>(base + header.entries_offset);
+    const auto blob    = base + header.blob_offset;
+    const auto& entry  = entries[i];
+
+    return {{blob + entry.key_offset, entry.key_size},
+            {blob + entry.content_offset, entry.content_size},
+            entry.line};
+}
+
+std::optional<DbIndex::Item> DbIndex::Find(std::string_view key) const
+{
+    const auto base    = static_cast<const char*>(region.get_address());
+    const auto& header = *reinterpret_cast<const Header*>(base);
+    const auto entries = reinterpret_cast<const Entry*>(base + header.entries_offset);
+    const auto hash    = HashKey(key);
+
+    const auto end   = entries + header.num_entries;
+    const auto first = std::lower_bound(
+        entries, end, hash, [](const Entry& entry, std::uint64_t h) { return entry.hash < h; });
+
+    for(auto it = first; it != end && it->hash == hash; ++it)
+    {
+        const auto item = GetItem(it - entries);
+        if(item.key == key)
+            return item;
+    }
+
+    return std::nullopt;
+}
+
+fs::path DbIndex::GetIndexPath(const fs::path& source_path)
+{
+    return GetUserDbPath() / (source_path.filename() + ".idx");
+}
+
+bool DbIndex::Build(std::istream& source,
+                    const SourceStamp& stamp,
+                    const fs::path& source_path,
+                    const fs::path& index_path)
+{
+    auto records = std::vector<SourceRecord>{};
+    auto line    = std::string{};
+    auto n_line  = 0;
+
+    while(std::getline(source, line))
+    {
+        ++n_line;
+
+        if(line.empty())
+            continue;
+
+        const auto key_size = line.find('=');
+        const bool is_key   = (key_size != std::string::npos && key_size != 0);
+
+        if(!is_key)
+        {
+            MIOPEN_LOG_E("Ill-formed record: key not found: " << source_path << "#" << n_line);
+            continue;
+        }
+
+        auto key = line.substr(0, key_size);
+        records.push_back({HashKey(key), std::move(key), line.substr(key_size + 1), n_line});
+    }
+
+    if(source.bad())
+    {
+        MIOPEN_LOG_E("Failed to read " << source_path);
+        return false;
+    }
+
+    return WriteIndex(records, stamp, source_path, index_path);
+}
+
+bool DbIndex::Build(const fs::path& source_path, const fs::path& index_path)
+{
+    const auto stamp = SourceStamp::Get(source_path);
+    if(!stamp)
+        return false;
+
+    auto file = std::ifstream{source_path, std::ios::binary};
+    if(!file)
+        return false;
+
+    auto decompressed = std::optional<Bz2InputStream>{};
+    if(source_path.extension() == ".bz2")
+        decompressed.emplace(file);
+    auto& stream = decompressed ? static_cast<std::istream&>(*decompressed) : file;
+
+    if(DbBinary::IsBinary(stream))
+    {
+        // Records are taken over as they are decoded. The line is the ordinal of the record.
+        auto records = std::vector<SourceRecord>{};
+        if(!DbBinary::Read(stream, [&](std::string&& key, std::string&& content) {
+               const auto hash = HashKey(key);
+               const auto line = static_cast<int>(records.size() + 1);
+               records.push_back({hash, std::move(key), std::move(content), line});
+           }))
+        {
+            MIOPEN_LOG_E("Malformed binary db: " << source_path);
+            return false;
+        }
+        return WriteIndex(records, *stamp, source_path, index_path);
+    }
+
+    return Build(stream, *stamp, source_path, index_path);
+}
+
+} // namespace miopen
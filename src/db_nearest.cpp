@@ -0,0 +1,223 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/db_nearest.hpp>
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+
+namespace miopen {
+
+namespace {
+
+constexpr char separator     = 'x';
+constexpr char numeric_field = '#';
+
+/// Splits the key into the fields and calls func for each of them until it returns false.
+/// Returns false if stopped.
+template <class TFunc>
+bool ForEachField(std::string_view key, TFunc&& func)
+{
+    while(true)
+    {
+        const auto end = key.find(separator);
+        if(!func(key.substr(0, end)))
+            return false;
+        if(end == std::string_view::npos)
+            return true;
+        key.remove_prefix(end + 1);
+    }
+}
+
+std::optional<float> ParseFeature(std::string_view field)
+{
+    auto value      = std::int64_t{};
+    const auto last = field.data() + field.size();
+    const auto res  = std::from_chars(field.data(), last, value);
+    if(field.empty() || res.ec != std::errc{} || res.ptr != last)
+        return std::nullopt;
+
+    const auto magnitude = std::log2(1.f + std::abs(static_cast<float>(value)));
+    return value < 0 ? -magnitude : magnitude;
+}
+
+} // namespace
+
+ProblemKeyFeatures::ProblemKeyFeatures(std::string_view key)
+{
+    signature.reserve(key.size());
+    auto is_first = true;
+    ForEachField(key, [&](std::string_view field) {
+        if(!is_first)
+            signature += separator;
+        is_first = false;
+        if(const auto value = ParseFeature(field))
+        {
+            signature += numeric_field;
+            values.push_back(*value);
+        }
+        else
+        {
+            signature.append(field);
+        }
+        return true;
+    });
+}
+
+std::optional<float> ProblemKeyFeatures::Distance(std::string_view other_key) const
+{
+    auto distance = 0.f;
+    auto rest     = std::string_view{signature};
+    auto n_values = std::size_t{0};
+    auto is_last  = false;
+
+    const auto comparable = ForEachField(other_key, [&](std::string_view field) {
+        if(is_last)
+            return false;
+        const auto end  = rest.find(separator);
+        const auto mine = rest.substr(0, end);
+        is_last         = end == std::string_view::npos;
+        if(!is_last)
+            rest.remove_prefix(end + 1);
+
+        const auto value = ParseFeature(field);
+        if(mine.size() != 1 || mine.front() != numeric_field)
+            return !value && mine == field;
+        if(!value)
+            return false;
+        distance += std::abs(values[n_values++] - *value);
+        return true;
+    });
+
+    if(!comparable || !is_last)
+        return std::nullopt;
+    return distance;
+}
+
+void NearestIndex::Add(const DbRecordView& record)
+{
+    const auto features = ProblemKeyFeatures{record.GetKey()};
+    const auto problem  = problems.size();
+    auto added          = false;
+
+    record.ForEach([&](std::string_view id, std::string_view values) {
+        auto solver = entries.find(id);
+        if(solver == entries.end())
+            solver = entries.emplace(std::string{id}, decltype(solver->second){}).first;
+
+        auto& group = solver->second[features.GetSignature()];
+        // The first values of a solver win, as in DbRecordView::GetValues().
+        if(!group.empty() && group.back().problem == problem)
+            return;
+        group.push_back({problem, std::string{values}});
+        added = true;
+    });
+
+    if(added)
+        problems.push_back({std::string{record.GetKey()}, features.GetValues()});
+}
+
+void NearestIndex::Clear()
+{
+    problems.clear();
+    entries.clear();
+}
+
+NearestRecords::NearestRecords(std::string_view key_, std::string_view solver_id_, std::size_t k_)
+    : key(key_), features(key_), solver_id(solver_id_), k(k_)
+{
+    nearest.reserve(k + 1);
+}
+
+void NearestRecords::Visit(const DbRecordView& record)
+{
+    if(k == 0 || record.GetKey() == key)
+        return;
+
+    // Most of the records have nothing for the solver, and checking it is cheaper.
+    const auto values = record.GetValues(solver_id);
+    if(!values)
+        return;
+
+    const auto distance = features.Distance(record.GetKey());
+    if(distance)
+        Insert(*distance, *values);
+}
+
+void NearestRecords::Visit(const NearestIndex& index)
+{
+    if(k == 0)
+        return;
+
+    const auto solver = index.entries.find(solver_id);
+    if(solver == index.entries.end())
+        return;
+    const auto group = solver->second.find(features.GetSignature());
+    if(group == solver->second.end())
+        return;
+
+    const auto& mine = features.GetValues();
+    for(const auto& entry : group->second)
+    {
+        const auto& problem = index.problems[entry.problem];
+        if(problem.key == key)
+            continue;
+
+        auto distance = 0.f;
+        for(std::size_t i = 0; i < mine.size(); ++i)
+            distance += std::abs(mine[i] - problem.values[i]);
+        Insert(distance, entry.values);
+    }
+}
+
+void NearestRecords::Insert(float distance, std::string_view values)
+{
+    if(nearest.size() == k && distance >= nearest.back().first)
+        return;
+
+    const auto pos = std::upper_bound(
+        nearest.begin(), nearest.end(), distance, [](float lhs, const auto& rhs) {
+            return lhs < rhs.first;
+        });
+    nearest.emplace(pos, distance, std::string{values});
+    if(nearest.size() > k)
+        nearest.pop_back();
+}
+
+std::vector<std::string> NearestRecords::GetValues() const
+{
+    auto values = std::vector<std::string>{};
+    values.reserve(nearest.size());
+    for(const auto& item : nearest)
+    {
+        if(std::find(values.begin(), values.end(), item.second) == values.end())
+            values.push_back(item.second);
+    }
+    return values;
+}
+
+} // namespace miopen
@@ -118,26 +118,26 @@ static bool TransformFindDbItem10to20(std::string& id, std::string& values)
 }
 #endif
 
-bool DbRecord::ParseContents(std::istream& contents)
+bool DbRecord::ParseContents(std::string_view contents)
 {
-    std::string id_and_values;
     int found = 0;
 
     map.clear();
 
-    while(std::getline(contents, id_and_values, ';'))
+    while(!contents.empty())
     {
-        const auto id_size = id_and_values.find(':');
+        const auto id_and_values = DbRecordView::NextItem(contents);
+        const auto id_size       = id_and_values.find(':');
 
         // Empty VALUES is ok, empty ID is not:
-        if(id_size == std::string::npos)
+        if(id_size == std::string_view::npos)
         {
             MIOPEN_LOG_E("Ill-formed file: ID not found; skipped; key: " << key);
             continue;
         }
 
-        auto id     = id_and_values.substr(0, id_size);
-        auto values = id_and_values.substr(id_size + 1);
+        auto id     = std::string{id_and_values.substr(0, id_size)};
+        auto values = std::string{id_and_values.substr(id_size + 1)};
 
 #if WORKAROUND_ISSUE_1987
         // Detect legacy find-db item (v.1.0 ID:VALUES) and transform it to the current format.
@@ -159,7 +159,7 @@ bool DbRecord::ParseContents(std::istream& contents)
             continue;
         }
 
-        map.emplace(id, values);
+        map.emplace(std::move(id), std::move(values));
         ++found;
     }
 
@@ -189,6 +189,27 @@ void DbRecord::WriteIdsAndValues(std::ostream& stream) const
     stream << std::accumulate(map.begin(), map.end(), std::string(), pairsJoiner) << std::endl;
 }
 
+std::optional<std::string_view> DbRecordView::GetValues(std::string_view id) const
+{
+    auto rest = contents;
+
+    while(!rest.empty())
+    {
+        const auto id_and_values = NextItem(rest);
+
+        if(id_and_values.size() > id.size() && id_and_values[id.size()] == ':' &&
+           id_and_values.compare(0, id.size(), id) == 0)
+        {
+            const auto values = id_and_values.substr(id.size() + 1);
+            MIOPEN_LOG_I2(key << '=' << id << ':' << values);
+            return values;
+        }
+    }
+
+    MIOPEN_LOG_I2(key << '=' << id << ':' << "<values not found>");
+    return std::nullopt;
+}
+
 void DbRecord::Merge(const DbRecord& that)
 {
     if(key != that.key)
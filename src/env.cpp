@@ -31,6 +31,8 @@
 #include <cstdlib>
 #endif
 
+#include <atomic>
+#include <cstdint>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -42,6 +44,17 @@
 
 namespace miopen::env {
 
+namespace {
+
+std::atomic<std::uint64_t>& EnvironmentGeneration()
+{
+    // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+    static std::atomic<std::uint64_t> generation{0};
+    return generation;
+}
+
+} // namespace
+
 void setEnvironmentVariable(std::string_view name, std::string_view value)
 {
 #ifdef _WIN32
@@ -51,6 +64,7 @@ void setEnvironmentVariable(std::string_view name, std::string_view value)
     if(setenv(name.data(), value.data(), 1) != 0)
 #endif
         MIOPEN_THROW("Setting environment variable failed: " + std::string{name});
+    ++EnvironmentGeneration();
 }
 
 void clearEnvironmentVariable(std::string_view name)
@@ -62,8 +76,11 @@ void clearEnvironmentVariable(std::string_view name)
     if(unsetenv(name.data()) != 0)
 #endif
         MIOPEN_THROW("Removing environment variable failed: " + std::string{name});
+    ++EnvironmentGeneration();
 }
 
+std::uint64_t getEnvironmentGeneration() { return EnvironmentGeneration(); }
+
 std::optional<std::string> getEnvironmentVariable(std::string_view name)
 {
 #ifdef _WIN32
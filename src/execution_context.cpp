@@ -41,6 +41,7 @@ MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_GCN_ASM_KERNELS)
 MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_HIP_KERNELS)
 MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_DEBUG_AMD_ROCM_METADATA_ENFORCE)
 MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_AMD_ROCM_METADATA_PREFER_OLDER)
+MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_PARALLEL_APPLICABILITY)
 
 namespace miopen {
 namespace debug {
@@ -218,6 +219,7 @@ void ExecutionContext::DetectRocm()
     use_hip_kernels         = IsHipKernelsEnabled();
     use_opencl_convolutions = !env::disabled(MIOPEN_DEBUG_OPENCL_CONVOLUTIONS);
     rmv                     = rocm_meta_version::Default;
+    parallel_applicability  = env::enabled(MIOPEN_DEBUG_PARALLEL_APPLICABILITY);
     if(IsAmdRocmOpencl(*this))
     {
         use_asm_kernels = !env::disabled(MIOPEN_DEBUG_GCN_ASM_KERNELS) && ValidateGcnAssembler();
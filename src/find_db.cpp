@@ -130,7 +130,14 @@ fs::path FindDbRecord_t<TDb>::GetInstalledPathFile(Handle& handle, const std::st
         const auto suffix =
             GetSystemFindDbSuffix() + (path_suffix.empty() ? "" : ('.' + path_suffix));
         const auto file_path = root_path / (base_name + "." + suffix + ext);
-        if(fs::exists(file_path))
+#if MIOPEN_DEBUG_FIND_DB_CACHING
+        // Installed dbs may be shipped compressed, ReadonlyRamDb unpacks them on load.
+        const auto exists =
+            fs::exists(file_path) || fs::exists(ReadonlyRamDb::GetCompressedPath(file_path));
+#else
+        const auto exists = fs::exists(file_path);
+#endif
+        if(exists)
         {
             MIOPEN_LOG_I2("Found exact find database file: " << file_path);
             return file_path;
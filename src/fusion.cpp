@@ -564,8 +564,7 @@ miopenStatus_t ConvForwardOpDescriptor::SetArgs(OperatorArgs& args,
 {
     float falpha = alpha != nullptr ? *reinterpret_cast<const float*>(alpha) : 1.0f;
     float fbeta  = beta != nullptr ? *reinterpret_cast<const float*>(beta) : 0.0f;
-    auto op_args = std::make_unique<fusion::ConvolutionOpInvokeParam>(falpha, fbeta, w);
-    args.SetArg(GetIdx(), std::move(op_args));
+    args.EmplaceArg<fusion::ConvolutionOpInvokeParam>(GetIdx(), falpha, fbeta, w);
     return miopenStatusSuccess;
 }
 
@@ -578,9 +577,7 @@ miopenStatus_t ActivFwdFusionOpDescriptor::SetArgs(OperatorArgs& args,
                                                    double activBeta,
                                                    double activGamma)
 {
-    auto op_args =
-        std::make_unique<fusion::ActivationOpInvokeParam>(activAlpha, activBeta, activGamma);
-    args.SetArg(GetIdx(), std::move(op_args));
+    args.EmplaceArg<fusion::ActivationOpInvokeParam>(GetIdx(), activAlpha, activBeta, activGamma);
     return miopenStatusSuccess;
 }
 
@@ -600,9 +597,8 @@ miopenStatus_t ActivBwdFusionOpDescriptor::SetArgs(OperatorArgs& args,
                                                    double activBeta,
                                                    double activGamma)
 {
-    auto op_args = std::make_unique<fusion::ActivationBwdOpInvokeParam>(
-        y, x, activAlpha, activBeta, activGamma);
-    args.SetArg(GetIdx(), std::move(op_args));
+    args.EmplaceArg<fusion::ActivationBwdOpInvokeParam>(
+        GetIdx(), y, x, activAlpha, activBeta, activGamma);
     return miopenStatusSuccess;
 }
 
@@ -623,9 +619,8 @@ miopenStatus_t BatchNormInferenceFusionOpDescriptor::SetArgs(OperatorArgs& args,
                                                              ConstData_t estimatedVariance,
                                                              double epsilon) const
 {
-    auto op_args = std::make_unique<fusion::BatchNormInferenceOpInvokeParam>(
-        bnScale, bnBias, estimatedMean, estimatedVariance, epsilon);
-    args.SetArg(GetIdx(), std::move(op_args));
+    args.EmplaceArg<fusion::BatchNormInferenceOpInvokeParam>(
+        GetIdx(), bnScale, bnBias, estimatedMean, estimatedVariance, epsilon);
     return miopenStatusSuccess;
 }
 
@@ -655,15 +650,15 @@ miopenStatus_t BatchNormFwdTrainFusionOpDescriptor::SetArgs(OperatorArgs& args,
                      "Save batch statistics was turned on at op creation time "
                      "but runningMean or runningVariance is set to nullptr");
     }
-    auto op_args = std::make_unique<fusion::BatchNormFwdTrainingOpInvokeParam>(runningMean,
-                                                                               runningVariance,
-                                                                               savedMean,
-                                                                               savedInvVariance,
-                                                                               bnScale,
-                                                                               bnBias,
-                                                                               expAvgFactor,
-                                                                               epsilon);
-    args.SetArg(GetIdx(), std::move(op_args));
+    args.EmplaceArg<fusion::BatchNormFwdTrainingOpInvokeParam>(GetIdx(),
+                                                               runningMean,
+                                                               runningVariance,
+                                                               savedMean,
+                                                               savedInvVariance,
+                                                               bnScale,
+                                                               bnBias,
+                                                               expAvgFactor,
+                                                               epsilon);
     return miopenStatusSuccess;
 }
 
@@ -688,9 +683,8 @@ miopenStatus_t BatchNormBwdTrainFusionOpDescriptor::SetArgs(OperatorArgs& args,
                                                             ConstData_t savedMean,
                                                             ConstData_t savedInvVariance) const
 {
-    auto op_args = std::make_unique<fusion::BatchNormBwdTrainingOpInvokeParam>(
-        x, bnScale, bnBias, resBnScaleDiff, resBnBiasDiff, savedMean, savedInvVariance);
-    args.SetArg(GetIdx(), std::move(op_args));
+    args.EmplaceArg<fusion::BatchNormBwdTrainingOpInvokeParam>(
+        GetIdx(), x, bnScale, bnBias, resBnScaleDiff, resBnBiasDiff, savedMean, savedInvVariance);
     return miopenStatusSuccess;
 }
 miopenStatus_t
@@ -714,8 +708,7 @@ miopenStatus_t BiasFusionOpDescriptor::SetArgs(OperatorArgs& args,
                                                const void* /*beta*/,
                                                ConstData_t bdata)
 {
-    auto op_args = std::make_unique<fusion::BiasOpInvokeParam>(bdata);
-    args.SetArg(GetIdx(), std::move(op_args));
+    args.EmplaceArg<fusion::BiasOpInvokeParam>(GetIdx(), bdata);
     return miopenStatusSuccess;
 }
 
@@ -728,8 +721,7 @@ miopenStatus_t TensorScaleAddOpDescriptor::GetOutputDesc(TensorDescriptor& outpu
 miopenStatus_t
 TensorScaleAddOpDescriptor::SetArgs(OperatorArgs& args, float alpha, ConstData_t tensor_ptr)
 {
-    auto op_args = std::make_unique<fusion::TensorScaleAddOpInvokeParam>(alpha, tensor_ptr);
-    args.SetArg(GetIdx(), std::move(op_args));
+    args.EmplaceArg<fusion::TensorScaleAddOpInvokeParam>(GetIdx(), alpha, tensor_ptr);
     return miopenStatusSuccess;
 }
 
@@ -1125,6 +1117,14 @@ miopenStatus_t FusionPlanDescriptor::Execute(const Handle& handle,
     {
         MIOPEN_THROW(miopenStatusBadParm, "The Fusion Plan was not compiled successfully");
     }
+    // The invokers take the arguments of the op by its index in the plan.
+    if(op_args.params.size() < op_map.size() ||
+       std::any_of(op_args.params.begin(),
+                   op_args.params.begin() + op_map.size(),
+                   [](const auto& arg) { return arg == nullptr; }))
+    {
+        MIOPEN_THROW(miopenStatusBadParm, "The arguments are not set for all the fusion ops");
+    }
 
     const auto plan_params =
         fusion::FusionInvokeParams{op_args, inputDesc, input, outputDesc, output, false};
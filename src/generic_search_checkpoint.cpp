@@ -0,0 +1,208 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/generic_search_checkpoint.hpp>
+#include <miopen/generic_search_controls.hpp>
+#include <miopen/db_path.hpp>
+#include <miopen/lock_file.hpp>
+#include <miopen/logger.hpp>
+#include <miopen/md5.hpp>
+
+#include <iomanip>
+#include <limits>
+#include <sstream>
+
+namespace miopen {
+namespace solver {
+
+namespace {
+
+constexpr std::string_view signature = "MIOpenTuningCheckpoint";
+constexpr int version                = 1;
+
+} // namespace
+
+TuningCheckpoint::TuningCheckpoint(const fs::path& path_, const std::string& key_)
+    : path(path_), key(key_)
+{
+    // Never waits: the owner may be tuning for hours.
+    auto& lock_file = LockFile::Get(LockFilePath(path));
+    if(!lock_file.try_lock())
+    {
+        MIOPEN_LOG_W("Tuning checkpoint is in use by another session, tuning without it: "
+                     << path);
+        path.clear();
+        return;
+    }
+    lock.reset(&lock_file);
+
+    Load();
+}
+
+void TuningCheckpoint::Unlock::operator()(LockFile* lock) const { lock->unlock(); }
+
+TuningCheckpoint TuningCheckpoint::Open(const std::string& db_basename,
+                                        const std::string& solver_id,
+                                        const std::string& problem_key)
+{
+    const auto& udb = GetUserDbPath();
+    if(udb.empty() || env::disabled(MIOPEN_DEBUG_TUNING_CHECKPOINT))
+        return {};
+
+    // The problem key is too long for a file name, and it is stored in the file anyway.
+    const auto key  = solver_id + " " + problem_key;
+    const auto name = db_basename + "_" + solver_id + "_" + md5(problem_key) + ".txt";
+    return {udb / "tuning" / name, key};
+}
+
+void TuningCheckpoint::Load()
+{
+    auto in = std::ifstream{path};
+    if(!in)
+        return;
+
+    auto line = std::string{};
+    auto sig  = std::string{};
+    auto ver  = 0;
+    if(!std::getline(in, line) || !(std::istringstream{line} >> sig >> ver) || sig != signature ||
+       ver != version)
+    {
+        MIOPEN_LOG_W("Ignoring unknown tuning checkpoint: " << path);
+        return;
+    }
+
+    if(!std::getline(in, line) || line != key)
+    {
+        MIOPEN_LOG_W("Ignoring tuning checkpoint of another problem: " << path);
+        return;
+    }
+
+    auto loaded = Header{};
+    if(!std::getline(in, line) ||
+       !(std::istringstream{line} >> loaded.seed >> loaded.n_configs >> loaded.strategy))
+    {
+        MIOPEN_LOG_W("Ignoring broken tuning checkpoint: " << path);
+        return;
+    }
+    header = loaded;
+
+    while(std::getline(in, line))
+    {
+        const auto space = line.find(' ');
+        // The last line may be incomplete if the process has been killed while writing it.
+        if(space == std::string::npos || in.eof())
+            break;
+
+        auto measurement   = Measurement{line.substr(space + 1), std::nullopt};
+        const auto time_str = line.substr(0, space);
+        if(time_str != "-")
+        {
+            auto time = 0.0f;
+            if(!(std::istringstream{time_str} >> time))
+                break;
+            measurement.time = time;
+        }
+        measurements.push_back(std::move(measurement));
+    }
+}
+
+std::optional<std::uint64_t> TuningCheckpoint::GetSeed() const
+{
+    if(!header)
+        return std::nullopt;
+    return header->seed;
+}
+
+std::vector<TuningCheckpoint::Measurement>
+TuningCheckpoint::Resume(std::uint64_t seed, std::size_t n_configs, std::string_view strategy)
+{
+    if(!IsEnabled())
+        return {};
+
+    auto resumed = std::vector<Measurement>{};
+
+    if(header && header->seed == seed && header->n_configs == n_configs &&
+       header->strategy == strategy)
+    {
+        resumed = std::move(measurements);
+        MIOPEN_LOG_W("Resuming tuning from " << path << ": " << resumed.size() << " of "
+                                             << n_configs << " configs measured");
+    }
+    else if(header)
+    {
+        MIOPEN_LOG_W("Tuning checkpoint does not match the search, starting over: " << path);
+    }
+    measurements.clear();
+
+    auto ec = std::error_code{};
+    fs::create_directories(path.parent_path(), ec);
+
+    // Rewritten from scratch, since the last line of the old file may be incomplete.
+    file.open(path, std::ios::out | std::ios::trunc);
+    if(!file)
+    {
+        MIOPEN_LOG_W("Unable to write tuning checkpoint: " << path);
+        path.clear();
+        lock.reset();
+        return resumed;
+    }
+
+    // The caller records the resumed measurements again if they are still relevant.
+    file << signature << ' ' << version << '\n'
+         << key << '\n'
+         << seed << ' ' << n_configs << ' ' << strategy << '\n';
+    file << std::setprecision(std::numeric_limits<float>::max_digits10);
+    file.flush();
+
+    return resumed;
+}
+
+void TuningCheckpoint::Record(const std::string& config, std::optional<float> time)
+{
+    if(!file.is_open())
+        return;
+
+    if(time)
+        file << *time;
+    else
+        file << '-';
+    file << ' ' << config << '\n';
+    file.flush();
+}
+
+void TuningCheckpoint::Finish()
+{
+    if(!IsEnabled())
+        return;
+
+    file.close();
+    auto ec = std::error_code{};
+    fs::remove(path, ec);
+    path.clear();
+    lock.reset();
+}
+
+} // namespace solver
+} // namespace miopen
@@ -0,0 +1,818 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/generic_search.hpp>
+#include <miopen/generic_search_controls.hpp>
+#include <miopen/generic_search_strategy.hpp>
+#include <miopen/errors.hpp>
+#include <miopen/logger.hpp>
+#include <miopen/stringutils.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <unordered_map>
+
+namespace miopen {
+namespace solver {
+
+const char* ToCString(SearchStrategyKind kind)
+{
+    switch(kind)
+    {
+    case SearchStrategyKind::Random: return "RANDOM";
+    case SearchStrategyKind::Annealing: return "ANNEALING";
+    case SearchStrategyKind::Genetic: return "GENETIC";
+    case SearchStrategyKind::Bayes: return "BAYES";
+    }
+    return "<Unknown>";
+}
+
+std::optional<SearchStrategyKind> ParseSearchStrategyKind(std::string_view str)
+{
+    auto upper = std::string{str};
+    for(auto& c : upper)
+        c = toupper(static_cast<unsigned char>(c));
+
+    for(const auto kind : {SearchStrategyKind::Random,
+                           SearchStrategyKind::Annealing,
+                           SearchStrategyKind::Genetic,
+                           SearchStrategyKind::Bayes})
+    {
+        if(upper == ToCString(kind))
+            return kind;
+    }
+    return std::nullopt;
+}
+
+SearchStrategyKind GetSearchStrategyKind(const std::string& solver_id,
+                                         SearchStrategyKind preferred)
+{
+    const auto str = env::value(MIOPEN_TUNING_STRATEGY);
+    if(str.empty())
+        return preferred;
+
+    auto common = std::optional<SearchStrategyKind>{};
+
+    for(const auto& entry : SplitDelim(str, ';'))
+    {
+        const auto colon = entry.find(':');
+        const auto name  = colon == std::string::npos ? entry : entry.substr(colon + 1);
+        const auto kind  = ParseSearchStrategyKind(name);
+
+        if(!kind)
+        {
+            MIOPEN_LOG_W("Wrong MIOPEN_TUNING_STRATEGY entry, ignored: " << entry);
+            continue;
+        }
+
+        if(colon == std::string::npos)
+            common = kind;
+        else if(entry.compare(0, colon, solver_id) == 0 && colon == solver_id.size())
+            return *kind;
+    }
+
+    return common ? *common : preferred;
+}
+
+std::size_t GetSearchBudget(SearchStrategyKind kind, std::size_t n_candidates)
+{
+    auto budget = n_candidates;
+
+    if(kind != SearchStrategyKind::Random)
+    {
+        const auto explicit_budget = env::value(MIOPEN_TUNING_STRATEGY_BUDGET);
+        budget = explicit_budget != 0 ? explicit_budget
+                                      : std::max<std::size_t>(64, n_candidates / 8);
+    }
+
+    return std::min({budget, n_candidates, GetTuningIterationsMax()});
+}
+
+namespace {
+
+/// Configs as points in a grid. Each dimension is a field of the serialized config,
+/// and each coordinate is the rank of the field value scaled to [0, 1].
+class SearchSpace
+{
+public:
+    explicit SearchSpace(const std::vector<std::string>& candidates) : size(candidates.size())
+    {
+        auto fields = std::vector<std::vector<std::string>>{};
+        fields.reserve(size);
+        for(const auto& candidate : candidates)
+            fields.push_back(Tokenize(candidate));
+
+        const auto max_fields =
+            std::accumulate(fields.begin(), fields.end(), std::size_t{0}, [](auto n, auto& f) {
+                return std::max(n, f.size());
+            });
+
+        for(std::size_t d = 0; d < max_fields; ++d)
+        {
+            auto values = std::vector<std::string>{};
+            for(const auto& f : fields)
+                values.push_back(d < f.size() ? f[d] : std::string{});
+
+            auto levels = values;
+            std::sort(levels.begin(), levels.end(), IsLess);
+            levels.erase(std::unique(levels.begin(), levels.end()), levels.end());
+
+            // A field with the same value everywhere does not tell the configs apart.
+            if(levels.size() < 2)
+                continue;
+
+            auto level_of = std::unordered_map<std::string, std::size_t>{};
+            for(std::size_t l = 0; l < levels.size(); ++l)
+                level_of.emplace(levels[l], l);
+
+            auto column = std::vector<std::uint32_t>{};
+            column.reserve(size);
+            for(const auto& v : values)
+                column.push_back(level_of.at(v));
+
+            columns.push_back(std::move(column));
+            n_levels.push_back(levels.size());
+            steps.push_back(1.0 / static_cast<double>(levels.size() - 1));
+        }
+    }
+
+    std::size_t Size() const { return size; }
+    std::size_t Dims() const { return columns.size(); }
+    std::size_t Level(std::size_t i, std::size_t d) const { return columns[d][i]; }
+    std::size_t Levels(std::size_t d) const { return n_levels[d]; }
+    double Step(std::size_t d) const { return steps[d]; }
+    double Coord(std::size_t i, std::size_t d) const
+    {
+        return static_cast<double>(columns[d][i]) * steps[d];
+    }
+
+    std::vector<double> Point(std::size_t i) const
+    {
+        auto point = std::vector<double>(Dims());
+        for(std::size_t d = 0; d < Dims(); ++d)
+            point[d] = Coord(i, d);
+        return point;
+    }
+
+    double Distance(std::size_t i, const std::vector<double>& point) const
+    {
+        auto dist = 0.0;
+        for(std::size_t d = 0; d < Dims(); ++d)
+            dist += std::abs(Coord(i, d) - point[d]);
+        return dist;
+    }
+
+    double Distance(std::size_t i, std::size_t j) const
+    {
+        auto dist = 0.0;
+        for(std::size_t d = 0; d < Dims(); ++d)
+            dist += std::abs(Coord(i, d) - Coord(j, d));
+        return dist;
+    }
+
+    /// The candidate closest to the point among those for which `filter` returns true.
+    template <class Filter>
+    std::optional<std::size_t> Nearest(const std::vector<double>& point, Filter&& filter) const
+    {
+        auto best      = std::optional<std::size_t>{};
+        auto best_dist = std::numeric_limits<double>::max();
+        for(std::size_t i = 0; i < size; ++i)
+        {
+            if(!filter(i))
+                continue;
+            const auto dist = Distance(i, point);
+            if(dist < best_dist)
+            {
+                best      = i;
+                best_dist = dist;
+            }
+        }
+        return best;
+    }
+
+private:
+    std::size_t size;
+    std::vector<std::vector<std::uint32_t>> columns;
+    std::vector<std::size_t> n_levels;
+    std::vector<double> steps;
+
+    static std::vector<std::string> Tokenize(const std::string& str)
+    {
+        auto tokens  = std::vector<std::string>{};
+        auto current = std::string{};
+        for(const auto c : str)
+        {
+            if(std::isalnum(static_cast<unsigned char>(c)) != 0 || c == '.' || c == '-')
+            {
+                current += c;
+            }
+            else if(!current.empty())
+            {
+                tokens.push_back(std::move(current));
+                current.clear();
+            }
+        }
+        if(!current.empty())
+            tokens.push_back(std::move(current));
+        return tokens;
+    }
+
+    static std::optional<double> ToNumber(const std::string& str)
+    {
+        if(str.empty())
+            return std::nullopt;
+        char* end       = nullptr;
+        const auto val = std::strtod(str.c_str(), &end);
+        if(end != str.c_str() + str.size())
+            return std::nullopt;
+        return val;
+    }
+
+    static bool IsLess(const std::string& lhs, const std::string& rhs)
+    {
+        const auto l = ToNumber(lhs);
+        const auto r = ToNumber(rhs);
+        if(l && r)
+            return *l < *r || (*l == *r && lhs < rhs);
+        if(l || r) // Numbers go first.
+            return l.has_value();
+        return lhs < rhs;
+    }
+};
+
+class RandomStrategy : public SearchStrategy
+{
+public:
+    RandomStrategy(std::size_t n_candidates, std::size_t budget, std::uint64_t seed)
+        : order(n_candidates), restored(n_candidates, false)
+    {
+        std::iota(order.begin(), order.end(), std::size_t{0});
+        auto rng = std::mt19937_64{seed};
+        std::shuffle(order.begin(), order.end(), rng);
+        order.resize(std::min(budget, n_candidates));
+        limit = order.size();
+    }
+
+    std::optional<std::size_t> Next() override
+    {
+        while(next < order.size() && restored[order[next]])
+            ++next;
+        if(next == order.size())
+            return std::nullopt;
+        return order[next++];
+    }
+
+    void Report(std::size_t, std::optional<float>) override {}
+
+    void Restore(std::size_t candidate, std::optional<float>) override
+    {
+        restored[candidate] = true;
+    }
+
+    void Prioritize(std::size_t candidate) override
+    {
+        if(n_prioritized == limit)
+            return;
+        const auto first_unprioritized = order.begin() + n_prioritized;
+        if(std::find(order.begin(), first_unprioritized, candidate) != first_unprioritized)
+            return;
+
+        // Takes the place of the last candidate in the order to stay within the budget.
+        const auto pos = std::find(first_unprioritized, order.end(), candidate);
+        if(pos != order.end())
+            order.erase(pos);
+        else
+            order.pop_back();
+        order.insert(order.begin() + n_prioritized, candidate);
+        ++n_prioritized;
+    }
+
+private:
+    std::vector<std::size_t> order;
+    std::vector<bool> restored;
+    std::size_t limit         = 0;
+    std::size_t next          = 0;
+    std::size_t n_prioritized = 0;
+};
+
+/// Common state of the strategies which learn from the measurements.
+/// Costs are log(time), so that all comparisons are relative.
+class ModelGuidedStrategy : public SearchStrategy
+{
+public:
+    ModelGuidedStrategy(const std::vector<std::string>& candidates,
+                        std::size_t budget_,
+                        std::uint64_t seed)
+        : space(candidates),
+          budget(std::min(budget_, candidates.size())),
+          visited(candidates.size(), false),
+          rng(seed)
+    {
+    }
+
+    std::optional<std::size_t> Next() final
+    {
+        if(proposed >= budget)
+            return std::nullopt;
+        auto candidate = NextPrioritized();
+        if(!candidate)
+            candidate = Propose();
+        if(!candidate)
+            candidate = RandomUnvisited();
+        if(!candidate)
+            return std::nullopt;
+        visited[*candidate] = true;
+        ++proposed;
+        return candidate;
+    }
+
+    void Report(std::size_t candidate, std::optional<float> time) final
+    {
+        // Failed configs are treated as much slower than anything measured, so that their
+        // neighbourhood is avoided without distorting the scale of the model.
+        const auto cost = time && *time > 0.0f ? std::log(static_cast<double>(*time))
+                                               : worst_cost.value_or(0.0) + 1.0;
+
+        if(time && *time > 0.0f)
+            worst_cost = std::max(worst_cost.value_or(cost), cost);
+
+        results.push_back({candidate, cost});
+        if(!best || cost < best->cost)
+            best = results.back();
+
+        OnResult(candidate, cost);
+    }
+
+    void Restore(std::size_t candidate, std::optional<float> time) final
+    {
+        if(visited[candidate])
+            return;
+        visited[candidate] = true;
+        ++proposed;
+        Report(candidate, time);
+    }
+
+    void Prioritize(std::size_t candidate) final { prioritized.push_back(candidate); }
+
+protected:
+    struct Result
+    {
+        std::size_t candidate;
+        double cost;
+    };
+
+    SearchSpace space;
+    std::size_t budget;
+    std::size_t proposed = 0;
+    std::vector<bool> visited;
+    std::vector<Result> results;
+    std::optional<Result> best;
+    std::optional<double> worst_cost;
+    std::mt19937_64 rng;
+    std::vector<std::size_t> prioritized;
+    std::size_t next_prioritized = 0;
+
+    /// Returns nullopt to fall back to a random candidate.
+    virtual std::optional<std::size_t> Propose()                 = 0;
+    virtual void OnResult(std::size_t candidate, double cost) = 0;
+
+    double Uniform() { return std::uniform_real_distribution<double>{0.0, 1.0}(rng); }
+
+    std::size_t UniformIndex(std::size_t n)
+    {
+        return std::uniform_int_distribution<std::size_t>{0, n - 1}(rng);
+    }
+
+    std::optional<std::size_t> NextPrioritized()
+    {
+        while(next_prioritized < prioritized.size())
+        {
+            const auto candidate = prioritized[next_prioritized++];
+            if(!visited[candidate])
+                return candidate;
+        }
+        return std::nullopt;
+    }
+
+    std::optional<std::size_t> RandomUnvisited()
+    {
+        const auto n = visited.size();
+        if(proposed >= n)
+            return std::nullopt;
+
+        // Cheap while the most of the candidates are unvisited, which is the usual case.
+        for(int attempt = 0; attempt < 32; ++attempt)
+        {
+            const auto i = UniformIndex(n);
+            if(!visited[i])
+                return i;
+        }
+
+        auto unvisited = std::vector<std::size_t>{};
+        for(std::size_t i = 0; i < n; ++i)
+            if(!visited[i])
+                unvisited.push_back(i);
+        return unvisited[UniformIndex(unvisited.size())];
+    }
+
+    std::optional<std::size_t> NearestUnvisited(const std::vector<double>& point) const
+    {
+        return space.Nearest(point, [&](auto i) { return !visited[i]; });
+    }
+
+    /// Moves the point by one level along a random dimension.
+    void Mutate(std::vector<double>& point)
+    {
+        if(point.empty())
+            return;
+        const auto d   = UniformIndex(point.size());
+        const auto dir = Uniform() < 0.5 ? -1.0 : 1.0;
+        point[d]       = std::clamp(point[d] + dir * space.Step(d), 0.0, 1.0);
+    }
+
+    /// The unvisited candidate closest to the neighbour of `i` along a random dimension.
+    std::optional<std::size_t> Neighbour(std::size_t i)
+    {
+        auto point = space.Point(i);
+        Mutate(point);
+        return NearestUnvisited(point);
+    }
+};
+
+class AnnealingStrategy : public ModelGuidedStrategy
+{
+public:
+    AnnealingStrategy(const std::vector<std::string>& candidates,
+                      std::size_t budget_,
+                      std::uint64_t seed)
+        : ModelGuidedStrategy(candidates, budget_, seed),
+          cooling(std::pow(final_temperature / initial_temperature,
+                           1.0 / static_cast<double>(std::max<std::size_t>(budget, 1))))
+    {
+    }
+
+private:
+    // A config 5% slower than the current one is accepted with probability 1/e at first.
+    static constexpr double initial_temperature = 0.05;
+    static constexpr double final_temperature   = 0.001;
+    static constexpr double restart_probability = 0.05;
+
+    double temperature = initial_temperature;
+    double cooling;
+    std::optional<Result> current;
+
+    std::optional<std::size_t> Propose() override
+    {
+        if(!current || Uniform() < restart_probability)
+            return std::nullopt;
+        return Neighbour(current->candidate);
+    }
+
+    void OnResult(std::size_t candidate, double cost) override
+    {
+        if(!current || cost < current->cost ||
+           Uniform() < std::exp((current->cost - cost) / temperature))
+            current = Result{candidate, cost};
+        temperature *= cooling;
+    }
+};
+
+class GeneticStrategy : public ModelGuidedStrategy
+{
+public:
+    GeneticStrategy(const std::vector<std::string>& candidates,
+                    std::size_t budget_,
+                    std::uint64_t seed)
+        : ModelGuidedStrategy(candidates, budget_, seed),
+          population(std::clamp<std::size_t>(budget / 8, 4, 32))
+    {
+    }
+
+private:
+    static constexpr std::size_t tournament_size = 4;
+    static constexpr double mutation_rate        = 0.3;
+
+    std::size_t population;
+
+    std::optional<std::size_t> Propose() override
+    {
+        // The first generation is random.
+        if(results.size() < population)
+            return std::nullopt;
+
+        const auto& lhs = Select();
+        const auto& rhs = Select();
+        auto child      = space.Point(lhs.candidate);
+
+        for(std::size_t d = 0; d < child.size(); ++d)
+        {
+            if(Uniform() < 0.5)
+                child[d] = space.Coord(rhs.candidate, d);
+        }
+        if(Uniform() < mutation_rate)
+            Mutate(child);
+
+        return NearestUnvisited(child);
+    }
+
+    void OnResult(std::size_t, double) override {}
+
+    const Result& Select()
+    {
+        const Result* winner = nullptr;
+        for(std::size_t i = 0; i < tournament_size; ++i)
+        {
+            const auto& contender = results[UniformIndex(results.size())];
+            if(winner == nullptr || contender.cost < winner->cost)
+                winner = &contender;
+        }
+        return *winner;
+    }
+};
+
+/// The surrogate is an additive model: the cost is the sum of the effects of the individual
+/// fields, each estimated from the measured configs and smoothed across the adjacent values.
+/// The uncertainty of an effect shrinks as more configs with close values are measured.
+/// The next config is the one with the lowest confidence bound. The model is refitted for
+/// each proposal, which is cheap compared to a single measurement.
+class BayesStrategy : public ModelGuidedStrategy
+{
+public:
+    BayesStrategy(const std::vector<std::string>& candidates,
+                  std::size_t budget_,
+                  std::uint64_t seed)
+        : ModelGuidedStrategy(candidates, budget_, seed),
+          n_initial(std::clamp<std::size_t>(budget / 10, 5, 20))
+    {
+    }
+
+private:
+    static constexpr double exploration = 3.0;
+    static constexpr double smoothing   = 0.1; // Bandwidth, in the fraction of a field range.
+    static constexpr double shrinkage   = 1.0; // Pulls rarely seen effects towards zero.
+    static constexpr int n_backfitting  = 3;
+
+    std::size_t n_initial;
+    // Predicted costs of proposed but not yet measured candidates, so that the candidates
+    // compiled ahead do not all end up in the same spot.
+    std::unordered_map<std::size_t, double> pending;
+
+    struct Effect
+    {
+        std::vector<double> value;
+        std::vector<double> uncertainty;
+    };
+
+    std::vector<Effect> Fit(const std::vector<Result>& data, double mean) const
+    {
+        auto effects   = std::vector<Effect>(space.Dims());
+        auto residuals = std::vector<double>(data.size());
+
+        for(std::size_t d = 0; d < space.Dims(); ++d)
+        {
+            effects[d].value.assign(space.Levels(d), 0.0);
+            effects[d].uncertainty.assign(space.Levels(d), 1.0);
+        }
+
+        for(int pass = 0; pass < n_backfitting; ++pass)
+        {
+            for(std::size_t d = 0; d < space.Dims(); ++d)
+            {
+                const auto n_levels = space.Levels(d);
+                auto sums           = std::vector<double>(n_levels, 0.0);
+                auto counts         = std::vector<double>(n_levels, 0.0);
+
+                for(std::size_t i = 0; i < data.size(); ++i)
+                {
+                    auto residual = data[i].cost - mean;
+                    for(std::size_t e = 0; e < space.Dims(); ++e)
+                    {
+                        if(e != d)
+                            residual -= effects[e].value[space.Level(data[i].candidate, e)];
+                    }
+                    const auto level = space.Level(data[i].candidate, d);
+                    sums[level] += residual;
+                    counts[level] += 1.0;
+                }
+
+                for(std::size_t l = 0; l < n_levels; ++l)
+                {
+                    auto sum    = 0.0;
+                    auto weight = 0.0;
+                    for(std::size_t m = 0; m < n_levels; ++m)
+                    {
+                        if(counts[m] == 0.0)
+                            continue;
+                        const auto dist = (static_cast<double>(l) - static_cast<double>(m)) *
+                                          space.Step(d) / smoothing;
+                        const auto k    = std::exp(-0.5 * dist * dist);
+                        sum += k * sums[m];
+                        weight += k * counts[m];
+                    }
+                    effects[d].value[l]       = sum / (weight + shrinkage);
+                    effects[d].uncertainty[l] = 1.0 / std::sqrt(1.0 + weight);
+                }
+            }
+        }
+
+        return effects;
+    }
+
+    std::optional<std::size_t> Propose() override
+    {
+        if(proposed < n_initial || results.size() < 2)
+            return std::nullopt;
+
+        auto mean = 0.0;
+        for(const auto& r : results)
+            mean += r.cost;
+        mean /= static_cast<double>(results.size());
+        auto variance = 0.0;
+        for(const auto& r : results)
+            variance += (r.cost - mean) * (r.cost - mean);
+        const auto spread = std::sqrt(variance / static_cast<double>(results.size()));
+
+        auto data = results;
+        for(const auto& p : pending)
+            data.push_back({p.first, p.second});
+        const auto effects = Fit(data, mean);
+
+        auto chosen     = std::optional<std::size_t>{};
+        auto chosen_lcb = std::numeric_limits<double>::max();
+        auto chosen_mu  = 0.0;
+
+        for(std::size_t c = 0; c < space.Size(); ++c)
+        {
+            if(visited[c])
+                continue;
+
+            auto mu          = mean;
+            auto uncertainty = 0.0;
+            for(std::size_t d = 0; d < space.Dims(); ++d)
+            {
+                const auto level = space.Level(c, d);
+                mu += effects[d].value[level];
+                uncertainty += effects[d].uncertainty[level];
+            }
+            if(space.Dims() != 0)
+                uncertainty /= static_cast<double>(space.Dims());
+
+            const auto lcb = mu - exploration * spread * uncertainty;
+            if(lcb < chosen_lcb)
+            {
+                chosen     = c;
+                chosen_lcb = lcb;
+                chosen_mu  = mu;
+            }
+        }
+
+        if(chosen)
+            pending[*chosen] = chosen_mu;
+        return chosen;
+    }
+
+    void OnResult(std::size_t candidate, double) override { pending.erase(candidate); }
+};
+
+} // namespace
+
+std::unique_ptr<SearchStrategy> MakeSearchStrategy(SearchStrategyKind kind,
+                                                   const std::vector<std::string>& candidates,
+                                                   std::size_t budget,
+                                                   std::uint64_t seed)
+{
+    switch(kind)
+    {
+    case SearchStrategyKind::Random:
+        return std::make_unique<RandomStrategy>(candidates.size(), budget, seed);
+    case SearchStrategyKind::Annealing:
+        return std::make_unique<AnnealingStrategy>(candidates, budget, seed);
+    case SearchStrategyKind::Genetic:
+        return std::make_unique<GeneticStrategy>(candidates, budget, seed);
+    case SearchStrategyKind::Bayes:
+        return std::make_unique<BayesStrategy>(candidates, budget, seed);
+    }
+    MIOPEN_THROW(miopenStatusInternalError, "Unknown search strategy");
+}
+
+SearchFeeder::SearchFeeder(SearchStrategy& strategy_, std::size_t max_pending_)
+    : strategy(strategy_), max_pending(std::max<std::size_t>(max_pending_, 1))
+{
+}
+
+std::optional<std::size_t> SearchFeeder::Take()
+{
+    auto lock = std::unique_lock<std::mutex>{mutex};
+    cond_var.wait(lock, [&] { return stopped || pending < max_pending; });
+    if(stopped)
+        return std::nullopt;
+    const auto candidate = strategy.Next();
+    if(candidate)
+        ++pending;
+    return candidate;
+}
+
+void SearchFeeder::Report(std::size_t candidate, std::optional<float> time)
+{
+    {
+        const auto lock = std::lock_guard<std::mutex>{mutex};
+        strategy.Report(candidate, time);
+        --pending;
+    }
+    cond_var.notify_one();
+}
+
+void SearchFeeder::Stop()
+{
+    {
+        const auto lock = std::lock_guard<std::mutex>{mutex};
+        stopped         = true;
+    }
+    cond_var.notify_all();
+}
+
+void MeasurementStats::Add(float time)
+{
+    // Welford's algorithm.
+    ++count;
+    const auto delta = static_cast<double>(time) - mean;
+    mean += delta / static_cast<double>(count);
+    m2 += delta * (static_cast<double>(time) - mean);
+}
+
+float MeasurementStats::StdDev() const
+{
+    if(count < 2)
+        return 0.0f;
+    return static_cast<float>(std::sqrt(m2 / static_cast<double>(count - 1)));
+}
+
+float MeasurementStats::Margin() const
+{
+    if(count < 2)
+        return std::numeric_limits<float>::infinity();
+
+    // Two-sided 95% quantiles of the Student's t-distribution.
+    constexpr double t_table[] = {
+        12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228};
+    const auto dof = count - 1;
+    const auto t   = dof <= std::size(t_table) ? t_table[dof - 1]
+                                               : 1.96 + 2.4 / static_cast<double>(dof);
+
+    return static_cast<float>(t * StdDev() / std::sqrt(static_cast<double>(count)));
+}
+
+std::vector<std::size_t> SelectSurvivors(const std::vector<MeasurementStats>& stats)
+{
+    auto order = std::vector<std::size_t>(stats.size());
+    std::iota(order.begin(), order.end(), std::size_t{0});
+    std::stable_sort(order.begin(), order.end(), [&](auto lhs, auto rhs) {
+        return stats[lhs].Mean() < stats[rhs].Mean();
+    });
+
+    if(order.empty())
+        return order;
+
+    const auto leader_upper = stats[order.front()].Upper();
+    auto survivors          = std::vector<std::size_t>{};
+    for(const auto i : order)
+    {
+        if(survivors.size() == (stats.size() + 1) / 2)
+            break;
+        if(stats[i].Lower() <= leader_upper)
+            survivors.push_back(i);
+    }
+    return survivors;
+}
+
+} // namespace solver
+} // namespace miopen
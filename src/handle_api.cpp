@@ -27,6 +27,7 @@
 #include <miopen/version.h>
 #include <miopen/errors.hpp>
 #include <miopen/handle.hpp>
+#include <miopen/system_db_prefetch.hpp>
 
 extern "C" const char* miopenGetErrorString(miopenStatus_t error)
 {
@@ -75,6 +76,7 @@ extern "C" miopenStatus_t miopenCreate(miopenHandle_t* handle)
     return miopen::try_([&] {
         auto& h = miopen::deref(handle);
         h       = new miopen::Handle();
+        miopen::PrefetchSystemDbs(miopen::deref(h));
     });
 }
 
@@ -85,6 +87,7 @@ extern "C" miopenStatus_t miopenCreateWithStream(miopenHandle_t* handle,
     return miopen::try_([&] {
         auto& h = miopen::deref(handle);
         h       = new miopen::Handle(stream);
+        miopen::PrefetchSystemDbs(miopen::deref(h));
     });
 }
 
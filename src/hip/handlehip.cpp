@@ -28,12 +28,15 @@
 #include <miopen/handle.hpp>
 
 #include <miopen/binary_cache.hpp>
+#include <miopen/compile_registry.hpp>
 #include <miopen/env.hpp>
 #include <miopen/errors.hpp>
 #include <miopen/handle_lock.hpp>
 #include <miopen/invoker.hpp>
 #include <miopen/kernel_cache.hpp>
 #include <miopen/logger.hpp>
+#include <miopen/ramdb.hpp>
+#include <miopen/shared_program_cache.hpp>
 #include <miopen/stringutils.hpp>
 #include <miopen/target_properties.hpp>
 #include <miopen/timer.hpp>
@@ -66,11 +69,26 @@
 #define WORKAROUND_FAULTY_HIPMEMGETINFO_VEGA_NAVI2X (HIP_PACKAGE_VERSION_FLAT >= 5007000000ULL)
 
 MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_DEVICE_CU)
+MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_SHARED_PROGRAM_CACHE_LIMIT_MB, 0)
 
 namespace miopen {
 
 namespace {
 
+/// Returns nullptr if the shared program cache is disabled.
+SharedProgramCache<HIPOCProgram>* GetSharedProgramCache()
+{
+    static auto* const cache = []() -> SharedProgramCache<HIPOCProgram>* {
+        const auto limit = env::value(MIOPEN_SHARED_PROGRAM_CACHE_LIMIT_MB) * 1024 * 1024;
+        if(limit == 0)
+            return nullptr;
+        // Never destroyed, so that the modules are not unloaded after the HIP runtime is.
+        return new SharedProgramCache<HIPOCProgram>{
+            limit, [](const HIPOCProgram& program) { return program.impl.use_count() > 1; }};
+    }();
+    return cache;
+}
+
 hipError_t hip_mem_get_info_wrapper(std::size_t* const free, std::size_t* const total)
 {
 #if WORKAROUND_FAULTY_HIPMEMGETINFO_VEGA_NAVI2X
@@ -288,6 +306,7 @@ struct HandleImpl
     Allocator allocator{};
     KernelCache cache;
     TargetProperties target_properties;
+    std::mutex max_mem_alloc_size_mutex;
 };
 
 Handle::Handle(miopenAcceleratorQueue_t stream) : impl(std::make_unique<HandleImpl>())
@@ -343,7 +362,8 @@ Handle::Handle() : impl(std::make_unique<HandleImpl>())
     MIOPEN_LOG_NQI(*this);
 }
 
-Handle::~Handle() {}
+// Pending write-behind db changes are flushed, so other processes see the tuning results.
+Handle::~Handle() { RamDb::FlushAll(); }
 
 // not MT safe
 void Handle::SetStream(miopenAcceleratorQueue_t streamID) const
@@ -560,6 +580,28 @@ Program Handle::LoadProgram(const fs::path& program_name,
     }
 #endif
 
+    // Handles of the same device reuse the programs loaded by each other.
+    auto* const shared_cache = GetSharedProgramCache();
+    const auto shared_key =
+        shared_cache == nullptr
+            ? std::string{}
+            : std::to_string(this->impl->device) + '|' +
+                  CompileRegistry::MakeKey(
+                      program_name, params, this->GetTargetProperties(), kernel_src);
+    if(shared_cache != nullptr)
+    {
+        const auto shared = shared_cache->Find(shared_key);
+        // A program loaded without its binary cannot be serialized.
+        if(shared && (!force_attach_binary || shared->IsCodeObjectInMemory() ||
+                      shared->IsCodeObjectInFile()))
+            return *shared;
+    }
+    const auto share = [&](const HIPOCProgram& program, std::size_t size) {
+        if(shared_cache != nullptr)
+            shared_cache->Insert(shared_key, program, size);
+        return program;
+    };
+
     auto hsaco = miopen::LoadBinary(
         this->GetTargetProperties(), this->GetMaxComputeUnits(), program_name, params);
     if(hsaco.empty())
@@ -580,62 +622,87 @@ Program Handle::LoadProgram(const fs::path& program_name,
     // specific code object
     if(hsaco.empty())
     {
-        CompileTimer ct;
-        auto p =
-            HIPOCProgram{program_name.string(), params, this->GetTargetProperties(), kernel_src};
-        ct.Log("Kernel", program_name.string());
-
-        // Save to cache
+        // Threads and handles which need the same program at the same time build it only once.
+        auto p            = HIPOCProgram{};
+        const auto binary = GetCompileRegistry().GetOrBuild(
+            CompileRegistry::MakeKey(program_name, params, this->GetTargetProperties(), kernel_src),
+            [&]() {
+                CompileTimer ct;
+                p = HIPOCProgram{
+                    program_name.string(), params, this->GetTargetProperties(), kernel_src};
+                ct.Log("Kernel", program_name.string());
+
+                std::vector<char> code_object;
+                if(!p.IsCodeObjectInMemory())
+                    code_object = miopen::LoadFile(p.GetCodeObjectPathname());
+                const auto& blob = p.IsCodeObjectInMemory() ? p.GetCodeObjectBlob() : code_object;
+
+                // Save to cache
 #if MIOPEN_ENABLE_SQLITE_KERN_CACHE
-        std::vector<char> binary;
-        if(!p.IsCodeObjectInMemory())
-            binary = miopen::LoadFile(p.GetCodeObjectPathname());
-
-        miopen::SaveBinary(p.IsCodeObjectInMemory() ? p.GetCodeObjectBlob() : binary,
-                           this->GetTargetProperties(),
-                           this->GetMaxComputeUnits(),
-                           program_name,
-                           params);
-
-        if(force_attach_binary && p.IsCodeObjectInTempFile())
-        {
-            MIOPEN_LOG_I2("Attaching a binary to the program for future serialization");
-            p.AttachBinary(std::vector<char>{binary.data(), binary.data() + binary.size()});
-        }
-        else
-        {
-            MIOPEN_LOG_I2("Skipped attaching a binary to the program for future serialization as "
-                          "it is in permanent file storage");
-        }
-
-        p.FreeCodeObjectFileStorage();
+                miopen::SaveBinary(blob,
+                                   this->GetTargetProperties(),
+                                   this->GetMaxComputeUnits(),
+                                   program_name,
+                                   params);
+
+                if(force_attach_binary && p.IsCodeObjectInTempFile())
+                {
+                    MIOPEN_LOG_I2("Attaching a binary to the program for future serialization");
+                    p.AttachBinary(blob);
+                }
+                else
+                {
+                    MIOPEN_LOG_I2("Skipped attaching a binary to the program for future "
+                                  "serialization as it is in permanent file storage");
+                }
 #else
-        boost::filesystem::path cache_path;
+                boost::filesystem::path cache_path;
+
+                // If cache is disabled we don't need to dump binary and move it there
+                if(!miopen::IsCacheDisabled())
+                {
+                    auto path = miopen::GetCachePath(false) / boost::filesystem::unique_path();
+                    miopen::WriteFile(blob, path);
+                    cache_path = miopen::SaveBinary(
+                        path, this->GetTargetProperties(), program_name, params, is_kernel_str);
+                }
+
+                if(force_attach_binary && p.IsCodeObjectInTempFile())
+                {
+                    MIOPEN_LOG_I2("Attaching a binary to the program for future serialization");
+                    if(cache_path.empty())
+                        p.AttachBinary(blob);
+                    else
+                        p.AttachBinary(std::move(cache_path));
+                }
+#endif
+                auto ret = blob;
+                p.FreeCodeObjectFileStorage();
+                return ret;
+            },
+            [&]() {
+                // Another caller may have finished and cached this program meanwhile.
+#if MIOPEN_ENABLE_SQLITE_KERN_CACHE
+                return miopen::LoadBinary(
+                    this->GetTargetProperties(), this->GetMaxComputeUnits(), program_name, params);
+#else
+                const auto path = miopen::LoadBinary(
+                    this->GetTargetProperties(), this->GetMaxComputeUnits(), program_name, params);
+                return path.empty() ? CompileRegistry::Binary{} : miopen::LoadFile(path);
+#endif
+            });
 
-        // If cache is disabled we don't need to dump binary and move it there
-        if(!miopen::IsCacheDisabled())
-        {
-            auto path = miopen::GetCachePath(false) / boost::filesystem::unique_path();
-            if(p.IsCodeObjectInMemory())
-                miopen::WriteFile(p.GetCodeObjectBlob(), path);
-            else
-                boost::filesystem::copy_file(p.GetCodeObjectPathname(), path);
-            cache_path = miopen::SaveBinary(
-                path, this->GetTargetProperties(), program_name, params, is_kernel_str);
-        }
+        if(p.impl != nullptr)
+            return share(p, binary.size());
 
-        if(force_attach_binary && p.IsCodeObjectInTempFile())
+        // Built by a concurrent call or found in the binary cache.
+        auto q = HIPOCProgram{program_name, binary};
+        if(force_attach_binary)
         {
             MIOPEN_LOG_I2("Attaching a binary to the program for future serialization");
-            if(cache_path.empty())
-                p.AttachBinary(LoadFileAsVector(p.GetCodeObjectPathname()));
-            else
-                p.AttachBinary(std::move(cache_path));
+            q.AttachBinary(binary);
         }
-
-        p.FreeCodeObjectFileStorage();
-#endif
-        return p;
+        return share(q, binary.size());
     }
     else
     {
@@ -646,8 +713,10 @@ Program Handle::LoadProgram(const fs::path& program_name,
             MIOPEN_LOG_I2("Attaching a binary to the program for future serialization");
             p.AttachBinary(std::vector<char>{hsaco.data(), hsaco.data() + hsaco.size()});
         }
+        return share(p, hsaco.size());
+#else
+        return share(p, fs::file_size(hsaco));
 #endif
-        return p;
     }
 }
 
@@ -757,8 +826,11 @@ std::size_t Handle::GetWavefrontWidth() const
 // for a single object.
 std::size_t Handle::GetMaxMemoryAllocSize()
 {
+    const std::lock_guard<std::mutex> lock{this->impl->max_mem_alloc_size_mutex};
     if(m_MaxMemoryAllocSizeCached == 0)
     {
+        // hipMemGetInfo reports the memory of the current device.
+        this->impl->set_ctx();
         size_t free, total;
         auto status = hip_mem_get_info_wrapper(&free, &total);
         if(status != hipSuccess)
@@ -795,6 +867,8 @@ std::ostream& Handle::Print(std::ostream& os) const
     return os;
 }
 
+void Handle::SetCurrentDevice() const { this->impl->set_ctx(); }
+
 shared<Data_t> Handle::CreateSubBuffer(Data_t data, std::size_t offset, std::size_t) const
 {
     auto cdata = reinterpret_cast<char*>(data);
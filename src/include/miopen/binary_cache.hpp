@@ -30,12 +30,29 @@
 #include <miopen/config.hpp>
 #include <miopen/target_properties.hpp>
 #include <miopen/filesystem.hpp>
+#include <cstdint>
 #include <string>
 
 namespace miopen {
 
 bool IsCacheDisabled();
 
+/// Process-wide kernel cache counters. Evictions happen when a new binary makes the user cache
+/// exceed MIOPEN_CACHE_SIZE_LIMIT_MB.
+struct KernelCacheStats
+{
+    std::uint64_t hits          = 0;
+    std::uint64_t misses        = 0;
+    std::uint64_t loaded_bytes  = 0;
+    std::uint64_t stores        = 0;
+    std::uint64_t stored_bytes  = 0;
+    std::uint64_t evictions     = 0;
+    std::uint64_t evicted_bytes = 0;
+};
+
+MIOPEN_INTERNALS_EXPORT KernelCacheStats GetKernelCacheStats();
+MIOPEN_INTERNALS_EXPORT void ResetKernelCacheStats();
+
 MIOPEN_INTERNALS_EXPORT fs::path
 GetCacheFile(const std::string& device, const fs::path& name, const std::string& args);
 
@@ -52,16 +69,16 @@ fs::path SaveBinary(const fs::path& binary_path,
                     const fs::path& name,
                     const std::string& args);
 #else
-std::vector<char> LoadBinary(const TargetProperties& target,
-                             std::size_t num_cu,
-                             const fs::path& name,
-                             const std::string& args);
+MIOPEN_INTERNALS_EXPORT std::vector<char> LoadBinary(const TargetProperties& target,
+                                                     std::size_t num_cu,
+                                                     const fs::path& name,
+                                                     const std::string& args);
 
-void SaveBinary(const std::vector<char>& hsaco,
-                const TargetProperties& target,
-                std::size_t num_cu,
-                const fs::path& name,
-                const std::string& args);
+MIOPEN_INTERNALS_EXPORT void SaveBinary(const std::vector<char>& hsaco,
+                                        const TargetProperties& target,
+                                        std::size_t num_cu,
+                                        const fs::path& name,
+                                        const std::string& args);
 #endif
 
 } // namespace miopen
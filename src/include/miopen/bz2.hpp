@@ -27,6 +27,8 @@
 #define GUARD_MIOPEN_BZ2_HPP_
 
 #include <miopen/config.hpp>
+#include <istream>
+#include <memory>
 #include <vector>
 #include <string>
 
@@ -36,6 +38,25 @@ MIOPEN_INTERNALS_EXPORT std::vector<char> compress(const std::vector<char>& v,
                                                    bool* compressed = nullptr);
 MIOPEN_INTERNALS_EXPORT std::vector<char> decompress(const std::vector<char>& v, unsigned int size);
 
+/// Decompresses bzip2 data read from the source stream on the fly, so large files are parsed
+/// without inflating them in memory first. Concatenated bzip2 streams are supported.
+///
+/// Corrupt or truncated data sets the badbit. Positioning is supported within the data that has
+/// been decompressed last, enough to peek at a file header.
+class MIOPEN_INTERNALS_EXPORT Bz2InputStream : public std::istream
+{
+public:
+    explicit Bz2InputStream(std::istream& source);
+    ~Bz2InputStream() override;
+
+    Bz2InputStream(const Bz2InputStream&) = delete;
+    Bz2InputStream& operator=(const Bz2InputStream&) = delete;
+
+private:
+    class Buffer;
+    std::unique_ptr<Buffer> buffer;
+};
+
 } // namespace miopen
 
 #endif // GUARD_MIOPEN_BZ2_HPP_
@@ -0,0 +1,89 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_COMPILE_REGISTRY_HPP_
+#define GUARD_MIOPEN_COMPILE_REGISTRY_HPP_
+
+#include <miopen/config.hpp>
+#include <miopen/filesystem.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace miopen {
+
+struct TargetProperties;
+
+struct CompileRegistryStats
+{
+    /// Programs built by the callers of GetOrBuild().
+    std::size_t compilations = 0;
+    /// Requests served by a build of a concurrent caller or found by the lookup of GetOrBuild(),
+    /// i.e. compilations saved.
+    std::size_t saved_compilations = 0;
+};
+
+/// Deduplicates concurrent builds of the same program within the process. The first caller for a
+/// key runs its builder, later callers for the same key wait for that build and get its code
+/// object instead of compiling it and writing it to the binary cache again. A key is only
+/// registered while its build is running, the results are kept by the binary cache as usual.
+class MIOPEN_INTERNALS_EXPORT CompileRegistry
+{
+public:
+    using Binary  = std::vector<char>;
+    using Builder = std::function<Binary()>;
+    using Lookup  = std::function<Binary()>;
+
+    /// Returns the code object produced by builder, or by the builder of a concurrent call with
+    /// the same key. An exception thrown by the builder is rethrown to all the waiting callers.
+    ///
+    /// The caller which registers the key runs lookup first and only builds the program if it
+    /// returns nothing. A build which has finished after the caller missed the binary cache is
+    /// not in flight anymore, and lookup is how the caller finds its result in the cache.
+    Binary GetOrBuild(const std::string& key, const Builder& builder, const Lookup& lookup = {});
+
+    CompileRegistryStats GetStats() const;
+
+    static std::string MakeKey(const fs::path& program_name,
+                               const std::string& params,
+                               const TargetProperties& target,
+                               const std::string& kernel_src);
+
+private:
+    mutable std::mutex mutex;
+    std::unordered_map<std::string, std::shared_future<Binary>> in_flight;
+    CompileRegistryStats stats;
+};
+
+MIOPEN_INTERNALS_EXPORT CompileRegistry& GetCompileRegistry();
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_COMPILE_REGISTRY_HPP_
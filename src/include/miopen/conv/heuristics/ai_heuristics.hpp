@@ -71,9 +71,18 @@ public:
     size_t EncodeLayout(const std::string& layout) const;
 };
 class Model;
+/// Metadata of the TunaNet model used for the device. Devices of the same architecture share
+/// one model, which is loaded on first use.
+MIOPEN_INTERNALS_EXPORT const Metadata& GetModelMetadata(const std::string& device);
 MIOPEN_INTERNALS_EXPORT std::vector<uint64_t> PredictSolver(const conv::ProblemDescription& problem,
                                                             const ExecutionContext& ctx,
                                                             const std::string& device);
+/// Same as PredictSolver() for each of the problems, but evaluates TunaNet once for all the
+/// problems which are not cached yet, e.g. for all the layers of a network at warm-up.
+MIOPEN_INTERNALS_EXPORT std::vector<std::vector<uint64_t>>
+PredictSolvers(const std::vector<conv::ProblemDescription>& problems,
+               const ExecutionContext& ctx,
+               const std::string& device);
 } // namespace immed_mode
 
 #endif // MIOPEN_ENABLE_AI_IMMED_MODE_FALLBACK
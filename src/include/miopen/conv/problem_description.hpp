@@ -28,6 +28,7 @@
 
 #include <boost/any.hpp>
 #include <miopen/conv_algo_name.hpp>
+#include <miopen/conv/problem_key.hpp>
 #include <miopen/names.hpp>
 #include <miopen/scalar.hpp>
 
@@ -371,6 +372,9 @@ struct MIOPEN_INTERNALS_EXPORT ProblemDescription : ProblemDescriptionBase
 
     void HeuristicUpdateLayouts();
 
+    /// Allocation-free form of the network config and of the find-db key.
+    ProblemKey MakeKey() const;
+
     void MakeNetworkConfig(std::string& conf_key) const;
 
     NetworkConfig MakeNetworkConfig() const override
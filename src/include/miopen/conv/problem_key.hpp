@@ -0,0 +1,122 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#pragma once
+
+#include <miopen/config.hpp>
+#include <miopen/conv_algo_name.hpp>
+#include <miopen/miopen.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace miopen {
+namespace conv {
+
+/// Compact form of a convolution problem: the values of the network config and of the find-db
+/// key in fixed-size fields, with the hash computed once. Unlike the string forms, it is built
+/// without allocations, so it is used to look up per-call caches. ToString() and ToDbKey() give
+/// the same strings as ProblemDescription::MakeNetworkConfig() and Serialize().
+struct MIOPEN_INTERNALS_EXPORT ProblemKey
+{
+    /// Layout strings, e.g. "NCHW" or "CHWNc", zero-padded. Any permutation of the dimensions
+    /// fits, so unusual layouts still compare correctly.
+    using Layout = std::array<char, 8>;
+
+    static constexpr std::int32_t no_cast_type = -1;
+
+    std::int64_t in_channels;
+    std::int64_t in_depth;
+    std::int64_t in_height;
+    std::int64_t in_width;
+    std::int64_t weights_depth;
+    std::int64_t weights_height;
+    std::int64_t weights_width;
+    std::int64_t out_channels;
+    std::int64_t out_depth;
+    std::int64_t out_height;
+    std::int64_t out_width;
+    std::int64_t batch_size;
+
+    std::array<std::int32_t, 3> pads;      // D, H, W
+    std::array<std::int32_t, 3> strides;   // D, H, W
+    std::array<std::int32_t, 3> dilations; // D, H, W
+    std::int32_t group_count;
+    std::int32_t bias;
+    std::array<std::int32_t, 3> data_types; // in, weights, out
+    std::array<std::int32_t, 3> cast_types; // in, weights, out, or no_cast_type
+
+    Layout in_layout;
+    Layout weights_layout;
+    Layout out_layout;
+
+    std::uint8_t spatial_dims;
+    std::uint8_t direction;
+    std::uint8_t alpha_beta_case;
+    std::uint8_t reserved;
+
+    /// Set by Seal() after all the fields above are filled.
+    std::uint64_t hash;
+
+    static Layout MakeLayout(std::string_view layout);
+    static std::string_view GetLayout(const Layout& layout);
+
+    Direction GetDirection() const { return static_cast<Direction>(direction); }
+
+    /// Computes the hash. Has to be called after any change of the fields.
+    void Seal();
+
+    /// Network config, used in logs and by the callers which are keyed by strings.
+    std::string ToString() const;
+    /// Find-db key.
+    std::string ToDbKey() const;
+
+    friend bool operator==(const ProblemKey& l, const ProblemKey& r)
+    {
+        return l.hash == r.hash && std::memcmp(&l, &r, offsetof(ProblemKey, hash)) == 0;
+    }
+    friend bool operator!=(const ProblemKey& l, const ProblemKey& r) { return !(l == r); }
+
+    struct Hasher
+    {
+        std::size_t operator()(const ProblemKey& key) const
+        {
+            return static_cast<std::size_t>(key.hash);
+        }
+    };
+};
+
+// The fields are compared and hashed as raw bytes, so there must be no padding.
+static_assert(std::has_unique_object_representations_v<ProblemKey>);
+static_assert(std::is_trivially_copyable_v<ProblemKey>);
+
+} // namespace conv
+} // namespace miopen
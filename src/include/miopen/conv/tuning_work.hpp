@@ -0,0 +1,67 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#pragma once
+
+#include <miopen/config.hpp>
+#include <miopen/tuning_queue.hpp>
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace miopen {
+
+struct Handle;
+struct Problem;
+
+namespace conv {
+
+/// Serialized form of a convolution problem for TuningWorkItem::problem, a JSON object on a
+/// single line.
+MIOPEN_INTERNALS_EXPORT std::string SerializeTuningProblem(const Problem& problem);
+/// Throws if the string is not a serialized convolution problem.
+MIOPEN_INTERNALS_EXPORT Problem DeserializeTuningProblem(const std::string& str);
+
+/// Work items of all the tunable solvers which are applicable to the convolution problem on the
+/// device of the handle, `n_shards` per solver.
+MIOPEN_INTERNALS_EXPORT std::vector<solver::TuningWorkItem>
+MakeTuningWork(Handle& handle, const Problem& problem, std::size_t n_shards);
+
+/// The TuningFunction of a worker. Searches the configs of the shard of the item on the device of
+/// the handle, i.e. runs FindSolution() with ExecutionContext::tuning_shard set. The result is not
+/// stored in the perf-db. Returns nullopt if none of the configs of the shard works.
+MIOPEN_INTERNALS_EXPORT std::optional<solver::TuningResult>
+Tune(Handle& handle, const solver::TuningWorkItem& item);
+
+/// Stores the fastest configs of the queue in the user perf-db of the device of the handle.
+/// Returns the number of the records updated.
+MIOPEN_INTERNALS_EXPORT std::size_t MergeTuningResults(Handle& handle,
+                                                       const solver::TuningQueue& queue);
+
+} // namespace conv
+} // namespace miopen
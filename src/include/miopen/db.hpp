@@ -26,6 +26,7 @@
 #ifndef GUARD_MIOPEN_DB_HPP_
 #define GUARD_MIOPEN_DB_HPP_
 
+#include <miopen/db_nearest.hpp>
 #include <miopen/db_record.hpp>
 #include <miopen/rank.hpp>
 #include <miopen/filesystem.hpp>
@@ -36,6 +37,8 @@
 
 #include <chrono>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace miopen {
 
@@ -65,6 +68,18 @@ public:
         return FindRecord(key);
     }
 
+    /// Searches db for all provided keys under a single lock and in a single pass over the file.
+    ///
+    /// Returns found records in the order of keys, none for the keys not found in database.
+    std::vector<boost::optional<DbRecord>> FindRecords(const std::vector<std::string>& keys);
+
+    template <class T>
+    inline std::vector<boost::optional<DbRecord>>
+    FindRecords(const std::vector<T>& problem_configs)
+    {
+        return FindRecords(DbRecord::SerializeKeys(db_kind, problem_configs));
+    }
+
     /// Stores provided record in database. If record with same key is already in database it is
     /// replaced by provided record.
     ///
@@ -221,6 +236,50 @@ public:
         return users ? users : _installed.FindRecord(args...);
     }
 
+    template <bool merge = merge_records, std::enable_if_t<merge>* = nullptr, class T>
+    auto FindRecords(const std::vector<T>& problem_configs)
+    {
+        auto users     = _user.FindRecords(problem_configs);
+        auto installed = _installed.FindRecords(problem_configs);
+
+        for(std::size_t i = 0; i < users.size(); ++i)
+        {
+            if(users[i] && installed[i])
+                users[i]->Merge(installed[i].value());
+            else if(!users[i])
+                users[i] = std::move(installed[i]);
+        }
+
+        return users;
+    }
+
+    template <bool merge = merge_records, std::enable_if_t<!merge>* = nullptr, class T>
+    auto FindRecords(const std::vector<T>& problem_configs)
+    {
+        auto users  = _user.FindRecords(problem_configs);
+        auto misses = std::vector<std::size_t>{};
+
+        for(std::size_t i = 0; i < users.size(); ++i)
+        {
+            if(!users[i])
+                misses.push_back(i);
+        }
+
+        if(misses.empty())
+            return users;
+
+        auto missed_configs = std::vector<T>{};
+        missed_configs.reserve(misses.size());
+        for(const auto i : misses)
+            missed_configs.push_back(problem_configs[i]);
+
+        auto installed = _installed.FindRecords(missed_configs);
+        for(std::size_t i = 0; i < misses.size(); ++i)
+            users[misses[i]] = std::move(installed[i]);
+
+        return users;
+    }
+
     template <typename... U>
     auto StoreRecord(const U&... args)
     {
@@ -259,7 +318,40 @@ public:
         return _user.Remove(args...);
     }
 
+    /// Calls func for every record of the user db, and then of the installed one. A key present
+    /// in both is visited twice. Dbs which cannot be enumerated are skipped.
+    template <class TFunc>
+    void ForEachRecord(const TFunc& func)
+    {
+#if !MIOPEN_DISABLE_USERDB
+        ForEachRecordIn(rank<1>{}, _user, func);
+#endif
+        ForEachRecordIn(rank<1>{}, _installed, func);
+    }
+
+    /// Offers the records of the user db, and then of the installed one, to nearest. Dbs which
+    /// cannot be enumerated are skipped.
+    void VisitNearest(NearestRecords& nearest)
+    {
+#if !MIOPEN_DISABLE_USERDB
+        miopen::VisitNearest(_user, nearest);
+#endif
+        miopen::VisitNearest(_installed, nearest);
+    }
+
 private:
+    template <class TDb, class TFunc>
+    static auto ForEachRecordIn(rank<1>, TDb& db, const TFunc& func)
+        -> decltype(db.ForEachRecord(func))
+    {
+        db.ForEachRecord(func);
+    }
+
+    template <class TDb, class TFunc>
+    static void ForEachRecordIn(rank<0>, TDb&, const TFunc&)
+    {
+    }
+
     template <class TDb, class TRet = decltype(TDb::GetCached(DbKinds::FindDb, "", true))>
     static TRet
     GetDbInstance(rank<1>, DbKinds db_kind, const fs::path& path, bool warn_if_unreadable)
@@ -301,6 +393,12 @@ public:
         return Measure("FindRecord", [&]() { return inner.FindRecord(args...); });
     }
 
+    template <class T>
+    auto FindRecords(const std::vector<T>& problem_configs)
+    {
+        return Measure("FindRecords", [&]() { return inner.FindRecords(problem_configs); });
+    }
+
     template <typename... U>
     auto StoreRecord(U&... record)
     {
@@ -337,6 +435,25 @@ public:
         return Measure("Remove", [&]() { return inner.Remove(args...); });
     }
 
+    template <class TFunc, class TDb = TInnerDb>
+    auto ForEachRecord(const TFunc& func) -> decltype(std::declval<TDb&>().ForEachRecord(func))
+    {
+        Measure("ForEachRecord", [&]() {
+            inner.ForEachRecord(func);
+            return true;
+        });
+    }
+
+    template <class TDb = TInnerDb>
+    auto VisitNearest(NearestRecords& nearest)
+        -> decltype(std::declval<TDb&>().VisitNearest(nearest))
+    {
+        Measure("VisitNearest", [&]() {
+            inner.VisitNearest(nearest);
+            return true;
+        });
+    }
+
 private:
     TInnerDb inner;
 
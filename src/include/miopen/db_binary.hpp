@@ -0,0 +1,90 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_DB_BINARY_HPP_
+#define GUARD_MIOPEN_DB_BINARY_HPP_
+
+#include <miopen/config.hpp>
+#include <miopen/filesystem.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace miopen {
+
+/// Compact, versioned binary encoding of a read-only text db (system find-db or perf-db).
+///
+/// All integers are LEB128 varints unless noted:
+///   Magic "MIODBBIN" and version (4 bytes, little endian)
+///   String table: count, then length-prefixed strings
+///   Records: count, then for each record
+///     Key: length-prefixed string
+///     Entries: count, then for each entry
+///       Id: index in the string table
+///       Values: count of the comma-separated fields, then a tag per field
+///     Records with no entries are followed by the length-prefixed raw contents instead.
+///
+/// A field tag is (value << 2 | kind), see FieldKind. Integers in the canonical decimal form
+/// are stored as varints, ids and repeated strings (such as algorithm names) once in the string
+/// table. Decoding yields the exact text contents, so code above the loader is unaffected.
+class MIOPEN_INTERNALS_EXPORT DbBinary
+{
+public:
+    static constexpr std::uint32_t Version = 1;
+
+    struct Record
+    {
+        std::string key;
+        std::string content;
+    };
+
+    /// Checks the magic without consuming it.
+    static bool IsBinary(std::istream& stream);
+    static bool IsBinary(const fs::path& path);
+
+    static bool Write(std::ostream& stream, const std::vector<Record>& records);
+
+    /// Calls the function with the key and the text contents of each record in the file order.
+    ///
+    /// Returns false if the stream is not a db of a supported version or is truncated.
+    static bool Read(std::istream& stream,
+                     const std::function<void(std::string&& key, std::string&& content)>& func);
+
+    /// Parses the text db. Ill-formed lines are skipped and the first record wins in case of
+    /// duplicate keys, as with the text db loaders.
+    static std::vector<Record> ParseText(std::istream& stream, const fs::path& source_path);
+
+    /// Converts the text db to the binary one. The file is written under a temporary name and
+    /// then renamed, so the paths may be the same.
+    static bool Convert(const fs::path& text_path, const fs::path& binary_path);
+};
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_DB_BINARY_HPP_
@@ -0,0 +1,121 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_DB_INDEX_HPP_
+#define GUARD_MIOPEN_DB_INDEX_HPP_
+
+#include <miopen/config.hpp>
+#include <miopen/filesystem.hpp>
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include <cstdint>
+#include <istream>
+#include <memory>
+#include <optional>
+#include <string_view>
+
+namespace miopen {
+
+/// Binary, memory-mappable index over a read-only text db (system find-db or perf-db).
+///
+/// The index is built once from the "KEY=ID:VALUES;..." text file and stored as:
+///   Header
+///   Entry[num_entries], sorted by (hash, key)
+///   Blob with keys and contents referenced by entries
+///
+/// Lookups are done directly over the mapped file, so there is no up-front parsing and all
+/// processes which use the same index share its pages.
+class MIOPEN_INTERNALS_EXPORT DbIndex
+{
+public:
+    struct Item
+    {
+        std::string_view key;
+        std::string_view content;
+        int line;
+    };
+
+    /// Identifies the text db the index was built from.
+    struct SourceStamp
+    {
+        std::uint64_t size = 0;
+        std::int64_t mtime = 0;
+
+        static std::optional<SourceStamp> Get(const fs::path& source_path);
+        bool operator==(const SourceStamp& other) const
+        {
+            return size == other.size && mtime == other.mtime;
+        }
+    };
+
+    DbIndex(const DbIndex&) = delete;
+    DbIndex(DbIndex&&)      = delete;
+    DbIndex& operator=(const DbIndex&) = delete;
+    DbIndex& operator=(DbIndex&&) = delete;
+
+    /// Maps the index file. Returns nullptr if the index is missing, malformed or has been built
+    /// from another version of the source db.
+    static std::unique_ptr<DbIndex> Open(const fs::path& index_path,
+                                         const std::optional<SourceStamp>& source);
+
+    /// Parses the text db from the stream and writes the index. The file is written under
+    /// a temporary name and then renamed, so concurrent readers never see a partial index.
+    ///
+    /// Returns false if the index cannot be written.
+    static bool Build(std::istream& source,
+                      const SourceStamp& stamp,
+                      const fs::path& source_path,
+                      const fs::path& index_path);
+
+    static bool Build(const fs::path& source_path, const fs::path& index_path);
+
+    /// Location of the index for the db file in the user db directory.
+    static fs::path GetIndexPath(const fs::path& source_path);
+
+    std::optional<Item> Find(std::string_view key) const;
+    std::size_t Size() const;
+
+    template <class TFunc>
+    void ForEach(TFunc&& func) const
+    {
+        for(std::size_t i = 0; i < Size(); ++i)
+            func(GetItem(i));
+    }
+
+private:
+    boost::interprocess::file_mapping file;
+    boost::interprocess::mapped_region region;
+
+    DbIndex(const fs::path& index_path);
+
+    bool Validate(const std::optional<SourceStamp>& source) const;
+    Item GetItem(std::size_t i) const;
+};
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_DB_INDEX_HPP_
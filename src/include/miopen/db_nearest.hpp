@@ -0,0 +1,169 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_DB_NEAREST_HPP_
+#define GUARD_MIOPEN_DB_NEAREST_HPP_
+
+#include <miopen/config.hpp>
+#include <miopen/db_record.hpp>
+#include <miopen/rank.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace miopen {
+
+/// Problem dimensions parsed from a perf-db key, e.g. "2x64x56x56x1x3x3x1x...xNCHWxFP32xF".
+/// Numeric fields are compared on the log scale, so that a batch of 64 is as close to 32 as
+/// 32 is to 16. Other fields (layout, data types, direction) shall match exactly.
+class MIOPEN_INTERNALS_EXPORT ProblemKeyFeatures
+{
+public:
+    explicit ProblemKeyFeatures(std::string_view key);
+
+    /// L1 distance between the features of the problems, or nullopt if they are not comparable.
+    /// Does not allocate.
+    std::optional<float> Distance(std::string_view other_key) const;
+
+    /// The key with the numeric fields replaced by a placeholder. Only the problems with the same
+    /// signature are comparable.
+    const std::string& GetSignature() const { return signature; }
+    /// The numeric fields on the log scale.
+    const std::vector<float>& GetValues() const { return values; }
+
+private:
+    std::string signature;
+    std::vector<float> values;
+};
+
+class NearestRecords;
+
+/// Perf-db records grouped by the solver and by the signature of the key, built in a single pass
+/// over a db. A lookup then only compares the features of the comparable problems which have
+/// values for the solver. Holds copies of the records, so it has to be rebuilt when the db
+/// changes.
+class MIOPEN_INTERNALS_EXPORT NearestIndex
+{
+public:
+    void Add(const DbRecordView& record);
+    void Clear();
+
+private:
+    struct Problem
+    {
+        std::string key;
+        std::vector<float> values;
+    };
+
+    struct Entry
+    {
+        std::size_t problem;
+        std::string values;
+    };
+
+    std::vector<Problem> problems;
+    // solver id -> signature -> entries
+    std::map<std::string, std::map<std::string, std::vector<Entry>>, std::less<>> entries;
+
+    friend class NearestRecords;
+};
+
+/// Collects the perf-db values of a solver stored under the keys nearest to the given one.
+/// The key itself is skipped.
+class MIOPEN_INTERNALS_EXPORT NearestRecords
+{
+public:
+    NearestRecords(std::string_view key, std::string_view solver_id_, std::size_t k_);
+
+    void Visit(const DbRecordView& record);
+    /// Same as visiting every record the index has been built from, but faster.
+    void Visit(const NearestIndex& index);
+
+    /// Values from the nearest records first. Equal values are returned once.
+    std::vector<std::string> GetValues() const;
+
+private:
+    std::string key;
+    ProblemKeyFeatures features;
+    std::string solver_id;
+    std::size_t k;
+    std::vector<std::pair<float, std::string>> nearest; // Sorted by the distance.
+
+    void Insert(float distance, std::string_view values);
+};
+
+namespace detail {
+
+template <class Db>
+auto VisitNearest(rank<2>, Db& db, NearestRecords& nearest) -> decltype(db.VisitNearest(nearest))
+{
+    db.VisitNearest(nearest);
+}
+
+template <class Db>
+auto VisitNearest(rank<1>, Db& db, NearestRecords& nearest)
+    -> decltype(db.ForEachRecord(std::declval<void (*)(const DbRecordView&)>()))
+{
+    db.ForEachRecord([&](const DbRecordView& record) { nearest.Visit(record); });
+}
+
+template <class Db>
+void VisitNearest(rank<0>, Db&, NearestRecords&)
+{
+}
+
+} // namespace detail
+
+/// Offers the records of the db to nearest. Uses the index of the db if it has one, otherwise
+/// visits every record. Does nothing for the dbs which cannot be enumerated.
+template <class Db>
+void VisitNearest(Db& db, NearestRecords& nearest)
+{
+    detail::VisitNearest(rank<2>{}, db, nearest);
+}
+
+/// Returns the values of the solver from the k perf-db records nearest to the problem.
+/// Returns nothing for the dbs which cannot be enumerated.
+template <class Db>
+std::vector<std::string>
+FindNearestValues(Db& db, const std::string& key, std::string_view solver_id, std::size_t k)
+{
+    if(k == 0)
+        return {};
+
+    auto nearest = NearestRecords{key, solver_id, k};
+    VisitNearest(db, nearest);
+    return nearest.GetValues();
+}
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_DB_NEAREST_HPP_
@@ -31,9 +31,12 @@
 
 #include <cassert>
 #include <istream>
+#include <optional>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <unordered_map>
+#include <vector>
 
 namespace miopen {
 
@@ -197,7 +200,17 @@ private:
         return ss.str();
     }
 
-    bool ParseContents(std::istream& contents);
+    template <class T>
+    static std::vector<std::string> SerializeKeys(DbKinds db_kind, const std::vector<T>& data)
+    {
+        auto keys = std::vector<std::string>{};
+        keys.reserve(data.size());
+        for(const auto& item : data)
+            keys.push_back(SerializeKey(db_kind, item));
+        return keys;
+    }
+
+    bool ParseContents(std::string_view contents);
     void WriteContents(std::ostream& stream) const;
     void WriteIdsAndValues(std::ostream& stream) const;
     bool SetValues(const std::string& id, const std::string& values);
@@ -205,12 +218,6 @@ private:
 
     DbRecord(const std::string& key_) : key(key_) {}
 
-    bool ParseContents(const std::string& contents)
-    {
-        auto ss = std::istringstream(contents);
-        return ParseContents(ss);
-    }
-
 public:
     DbRecord() : key(""){};
     /// T shall provide a db KEY by means of the "void Serialize(std::ostream&) const" member
@@ -285,6 +292,74 @@ public:
     friend class RamDb;
 };
 
+/// Non-owning view of a record payload ("ID:VALUES;ID:VALUES...").
+///
+/// Unlike DbRecord, the payload is not split into a map up front. IDs are located on demand,
+/// so getting VALUES of a single ID does not allocate. The view is only valid as long as
+/// the storage of the key and the payload is alive.
+///
+/// Legacy (v.1.0) find-db items are not transformed, so find-db records shall be read as DbRecord.
+class MIOPEN_INTERNALS_EXPORT DbRecordView
+{
+public:
+    DbRecordView(std::string_view key_, std::string_view contents_)
+        : key(key_), contents(contents_)
+    {
+    }
+
+    std::string_view GetKey() const { return key; }
+    std::string_view GetContents() const { return contents; }
+
+    /// Returns VALUES associated with ID or none if there is no such ID in the record.
+    std::optional<std::string_view> GetValues(std::string_view id) const;
+
+    /// See DbRecord::GetValues(). Only the lookup is allocation-free: Deserialize() takes
+    /// a std::string, so the located VALUES are copied into one.
+    template <class T>
+    bool GetValues(std::string_view id, T& values) const
+    {
+        const auto s = GetValues(id);
+        if(!s)
+            return false;
+
+        const bool ok = values.Deserialize(std::string{*s});
+        if(!ok)
+        {
+            MIOPEN_LOG_WE(
+                "Perf db record is obsolete or corrupt: " << *s << ". Performance may degrade.");
+        }
+        return ok;
+    }
+
+    /// Calls func(id, values) for every well-formed ID:VALUES pair in the payload order.
+    template <class TFunc>
+    void ForEach(TFunc&& func) const
+    {
+        auto rest = contents;
+        while(!rest.empty())
+        {
+            const auto id_and_values = NextItem(rest);
+            const auto id_size       = id_and_values.find(':');
+            if(id_size == std::string_view::npos)
+                continue;
+            func(id_and_values.substr(0, id_size), id_and_values.substr(id_size + 1));
+        }
+    }
+
+    /// Splits off the leading ID:VALUES item. Items are separated by ';'.
+    static std::string_view NextItem(std::string_view& rest)
+    {
+        const auto end  = rest.find(';');
+        const auto item = rest.substr(0, end);
+        rest            = end == std::string_view::npos ? std::string_view{} : rest.substr(end + 1);
+        return item;
+    }
+
+private:
+    std::string_view key;
+    std::string_view contents;
+};
+
 } // namespace miopen
 
 #endif // GUARD_MIOPEN_DB_RECORD_HPP_
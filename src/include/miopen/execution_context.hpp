@@ -36,8 +36,10 @@
 #endif
 #include <miopen/filesystem.hpp>
 
+#include <memory>
 #include <string>
 #include <string_view>
+#include <vector>
 
 class rocm_meta_version
 {
@@ -77,6 +79,10 @@ MIOPEN_EXPORT extern bool
 
 } // namespace debug
 
+namespace solver {
+struct TuningShard;
+} // namespace solver
+
 struct MIOPEN_INTERNALS_EXPORT ExecutionContext
 {
     // Solution-specific
@@ -97,6 +103,13 @@ struct MIOPEN_INTERNALS_EXPORT ExecutionContext
     bool disable_perfdb_access      = false;
     bool use_dynamic_solutions_only = false;
     bool is_for_generic_search      = false;
+    // Check the applicability of the solvers of a SolverContainer on the worker pool.
+    bool parallel_applicability = false;
+    // Serialized perf configs which the search measures first, e.g. the best ones found for
+    // similar problems.
+    std::vector<std::string> tuning_hints;
+    // Makes the search cover a slice of the configs only, see tuning_queue.hpp.
+    std::shared_ptr<solver::TuningShard> tuning_shard;
 
     inline Handle& GetStream() const { return *stream; }
     inline void SetStream(Handle* stream_) { stream = stream_; }
@@ -196,7 +209,14 @@ struct MIOPEN_INTERNALS_EXPORT ExecutionContext
             filename.append(ext);
 
             // clang-format on
-            if(fs::exists(pdb_path / filename))
+#if MIOPEN_ENABLE_SQLITE && MIOPEN_USE_SQLITE_PERFDB
+            const auto exists = fs::exists(pdb_path / filename);
+#else
+            // Installed dbs may be shipped compressed, ReadonlyRamDb unpacks them on load.
+            const auto exists = fs::exists(pdb_path / filename) ||
+                                fs::exists(pdb_path / (filename + ".bz2"));
+#endif
+            if(exists)
             {
                 MIOPEN_LOG_I("Found exact perf database file");
                 return pdb_path / filename;
@@ -146,6 +146,33 @@ public:
     auto end() { return content->As<FindDbData>().end(); }
     bool empty() const { return !content.is_initialized(); }
 
+    /// Location of the system find-db for the device of the handle.
+    static fs::path GetInstalledPath(Handle& handle, const std::string& path_suffix);
+
+    /// Opens the find-dbs for the device of the handle, so the cached ones are loaded ahead of
+    /// the first Find call, e.g. when a model is loaded.
+    static void Prefetch(Handle& handle, const std::string& path_suffix = "")
+    {
+        if(!debug::testing_find_db_enabled || env::enabled(MIOPEN_DEBUG_DISABLE_FIND_DB))
+            return;
+
+        const auto path = debug::testing_find_db_path_override()
+                              ? *debug::testing_find_db_path_override()
+                              : GetUserPath(handle, path_suffix);
+
+        if constexpr(std::is_same<TDb, FindDb>::value)
+        {
+            const auto installed_path = debug::testing_find_db_path_override()
+                                            ? *debug::testing_find_db_path_override()
+                                            : GetInstalledPath(handle, path_suffix);
+            std::ignore = DbTimer<TDb>{DbKinds::FindDb, installed_path, path};
+        }
+        else if constexpr(!DisableUserDbFileIO)
+        {
+            std::ignore = DbTimer<TDb>{DbKinds::FindDb, path, false};
+        }
+    }
+
     template <class TProblemDescription>
     static std::vector<Solution> TryLoad(Handle& handle,
                                          const TProblemDescription& problem,
@@ -192,7 +219,6 @@ private:
     bool in_sync    = false;
     bool dont_store = false; // E.g. to skip writing sub-optimal find-db records to disk.
 
-    static fs::path GetInstalledPath(Handle& handle, const std::string& path_suffix);
     static fs::path GetInstalledPathEmbed(Handle& handle, const std::string& path_suffix);
     static fs::path GetInstalledPathFile(Handle& handle, const std::string& path_suffix);
     static fs::path GetUserPath(Handle& handle, const std::string& path_suffix);
@@ -31,17 +31,25 @@
 #include <miopen/env.hpp>
 #include <miopen/errors.hpp>
 #include <miopen/conv_solution.hpp>
+#include <miopen/db_nearest.hpp>
 #include <miopen/execution_context.hpp>
 #include <miopen/find_controls.hpp>
+#include <miopen/generic_search_controls.hpp>
 #include <miopen/handle.hpp>
 #include <miopen/mlo_internal.hpp>
 #include <miopen/search_options.hpp>
+#include <miopen/solver_applicability_cache.hpp>
 #include <miopen/solver_id.hpp>
 #include <miopen/solver.hpp>
+#include <miopen/worker_pool.hpp>
 
+#include <algorithm>
+#include <array>
+#include <functional>
 #include <limits>
 #include <type_traits>
 #include <optional>
+#include <thread>
 #include <vector>
 
 namespace miopen {
@@ -131,8 +139,21 @@ auto FindSolutionImpl(rank<1>,
             MIOPEN_LOG_I("Starting search: " << s.SolverDbId() << ", enforce: " << enforce);
             try
             {
-                auto c = s.Search(context, problem, invoke_ctx);
-                db().Update(problem, s.SolverDbId(), c);
+                // The best configs of similar problems are likely to be good for this one.
+                auto search_context         = context;
+                search_context.tuning_hints = FindNearestValues(
+                    db(),
+                    DbRecord{DbKinds::PerfDb, problem}.GetKey(),
+                    s.SolverDbId(),
+                    env::value(MIOPEN_TUNING_TRANSFER_K));
+                if(!search_context.tuning_hints.empty())
+                    MIOPEN_LOG_I("Perf Db: " << search_context.tuning_hints.size()
+                                             << " configs of similar problems to measure first");
+                auto c = s.Search(search_context, problem, invoke_ctx);
+                // The best config of a shard is only the best of its slice. The tuning
+                // coordinator stores the best of all the shards, see MergeTuningResults.
+                if(!context.tuning_shard)
+                    db().Update(problem, s.SolverDbId(), c);
                 return s.GetSolution(context, problem, c);
             }
             catch(const miopen::Exception& ex)
@@ -141,6 +162,27 @@ auto FindSolutionImpl(rank<1>,
                 return ConvSolution(miopenStatusInternalError);
             }
         }
+
+        if(env::enabled(MIOPEN_PERFDB_USE_NEAREST))
+        {
+            using PerformanceConfig = decltype(s.GetDefaultPerformanceConfig(context, problem));
+            const auto nearest      = FindNearestValues(
+                db(),
+                DbRecord{DbKinds::PerfDb, problem}.GetKey(),
+                s.SolverDbId(),
+                std::max<std::size_t>(env::value(MIOPEN_TUNING_TRANSFER_K), 1));
+            for(const auto& values : nearest)
+            {
+                PerformanceConfig config{};
+                if(config.Deserialize(values) &&
+                   s.IsValidPerformanceConfig(context, problem, config))
+                {
+                    MIOPEN_LOG_I("Perf Db: record of a similar problem used: " << s.SolverDbId()
+                                                                               << ": " << config);
+                    return s.GetSolution(context, problem, config);
+                }
+            }
+        }
     }
 
     return s.GetSolution(context, problem, s.GetDefaultPerformanceConfig(context, problem));
@@ -270,6 +312,30 @@ struct SolverContainer
         miopen::each_args([&](auto solver) { receiver(solver); }, Solvers{}...);
     }
 
+    /// Calls check(solver) for all the solvers concurrently on the worker pool.
+    /// The results are in the order of the solvers in the container.
+    template <class Result, class Context, class Check>
+    static std::array<Result, sizeof...(Solvers)> CheckInParallel(const Context& ctx,
+                                                                   const Check& check)
+    {
+        auto tasks = std::array<std::function<Result()>, sizeof...(Solvers)>{};
+        auto idx   = std::size_t{0};
+        miopen::each_args(
+            [&](auto solver) { tasks[idx++] = [&check, solver]() { return check(solver); }; },
+            Solvers{}...);
+
+        auto results      = std::array<Result, sizeof...(Solvers)>{};
+        const auto caller = std::this_thread::get_id();
+        GetWorkerPool().ParallelFor(tasks.size(), [&](std::size_t i) {
+            // The checks may query the current device, which the workers do not share with
+            // the calling thread.
+            if(std::this_thread::get_id() != caller)
+                ctx.GetStream().SetCurrentDevice();
+            results[i] = tasks[i]();
+        });
+        return results;
+    }
+
     // Search for all applicable solutions among many solvers
     template <class Context, class Problem, class Db, class Solution = miopen::solver::ConvSolution>
     std::vector<Solution>
@@ -283,8 +349,27 @@ struct SolverContainer
         std::vector<Solution> ss;
         std::size_t count    = 0;
         const auto find_only = GetEnvFindOnlySolver();
+
+        // Applicability of all the solvers is checked at once, even if the limit is reached
+        // earlier, and the solutions are then searched in the usual order.
+        auto applicable = std::optional<std::array<bool, sizeof...(Solvers)>>{};
+        if(ctx.parallel_applicability)
+        {
+            applicable = CheckInParallel<bool>(ctx, [&](auto solver) {
+                if(find_only &&
+                   (std::find(find_only->begin(), find_only->end(), Id{solver.SolverDbId()}) ==
+                    find_only->end()))
+                    return false;
+                if(ctx.use_dynamic_solutions_only && !solver.IsDynamic())
+                    return false;
+                return solver.IsApplicable(ctx, problem);
+            });
+        }
+
+        auto idx = std::size_t{0};
         miopen::each_args(
             [&](auto solver) {
+                const auto i = idx++;
                 if(count >= limit)
                     return;
                 if(find_only &&
@@ -298,7 +383,7 @@ struct SolverContainer
                 {
                     MIOPEN_LOG_I2(solver.SolverDbId() << ": Skipped (non-dynamic)");
                 }
-                else if(!solver.IsApplicable(ctx, problem))
+                else if(!(applicable ? (*applicable)[i] : solver.IsApplicable(ctx, problem)))
                 {
                     MIOPEN_LOG_I2(solver.SolverDbId() << ": Not applicable");
                 }
@@ -340,8 +425,24 @@ struct SolverContainer
         std::vector<Solution> ss;
         std::size_t count    = 0;
         const auto find_only = GetEnvFindOnlySolver();
+        const auto record    = GetApplicabilityRecord(ctx, problem);
+
+        auto applicable = std::optional<std::array<bool, sizeof...(Solvers)>>{};
+        if(ctx.parallel_applicability)
+        {
+            applicable = CheckInParallel<bool>(ctx, [&](auto solver) {
+                if(find_only &&
+                   (std::find(find_only->begin(), find_only->end(), Id{solver.SolverDbId()}) ==
+                    find_only->end()))
+                    return false;
+                return CachedIsApplicable(record.get(), solver, ctx, problem);
+            });
+        }
+
+        auto idx = std::size_t{0};
         miopen::each_args(
             [&](auto solver) {
+                const auto i = idx++;
                 if(count >= limit)
                     return;
                 if(find_only &&
@@ -353,7 +454,8 @@ struct SolverContainer
                 // it is much faster than IsApplicable().
                 // else if(problem.use_dynamic_solutions_only && !solver.IsDynamic())
                 //    MIOPEN_LOG_I2(solver.SolverDbId() << ": Skipped (non-dynamic)");
-                else if(!solver.IsApplicable(ctx, problem))
+                else if(!(applicable ? (*applicable)[i]
+                                     : CachedIsApplicable(record.get(), solver, ctx, problem)))
                 {
                     MIOPEN_LOG_I2(solver.SolverDbId() << ": Not applicable");
                 }
@@ -400,8 +502,31 @@ struct SolverContainer
     {
         std::vector<std::pair<std::string, size_t>> res;
         const auto find_only = GetEnvFindOnlySolver();
+
+        // Workspace sizes of the applicable solvers, the same checks as below.
+        auto sizes = std::optional<std::array<std::optional<std::size_t>, sizeof...(Solvers)>>{};
+        if(ctx.parallel_applicability)
+        {
+            sizes = CheckInParallel<std::optional<std::size_t>>(
+                ctx, [&](auto solver) -> std::optional<std::size_t> {
+                    if(find_only && (std::find(find_only->begin(),
+                                               find_only->end(),
+                                               Id{solver.SolverDbId()}) == find_only->end()))
+                        return std::nullopt;
+                    if(!simple_primitive && !solver.MayNeedWorkspace())
+                        return std::nullopt;
+                    if(ctx.use_dynamic_solutions_only && !solver.IsDynamic())
+                        return std::nullopt;
+                    if(!solver.IsApplicable(ctx, problem))
+                        return std::nullopt;
+                    return solver.GetWorkspaceSize(ctx, problem);
+                });
+        }
+
+        auto idx = std::size_t{0};
         miopen::each_args(
             [&](auto solver) {
+                const auto i = idx++;
                 if(find_only &&
                    (std::find(find_only->begin(), find_only->end(), Id{solver.SolverDbId()}) ==
                     find_only->end()))
@@ -423,13 +548,13 @@ struct SolverContainer
                 {
                     MIOPEN_LOG_I2(solver.SolverDbId() << ": Skipped (non-dynamic)");
                 }
-                else if(!solver.IsApplicable(ctx, problem))
+                else if(sizes ? !(*sizes)[i] : !solver.IsApplicable(ctx, problem))
                 {
                     MIOPEN_LOG_I2(solver.SolverDbId() << ": Not applicable");
                 }
                 else
                 {
-                    auto sz = solver.GetWorkspaceSize(ctx, problem);
+                    auto sz = sizes ? *(*sizes)[i] : solver.GetWorkspaceSize(ctx, problem);
                     res.push_back(std::make_pair(solver.SolverDbId(), sz));
                     MIOPEN_LOG_I2(solver.SolverDbId() << ": " << sz);
                 }
@@ -29,6 +29,8 @@
 #include <miopen/fusion/fusion_op_args.hpp>
 #include <miopen/invoke_params.hpp>
 
+#include <utility>
+
 namespace miopen {
 
 namespace fusion {
@@ -172,9 +174,9 @@ struct FusionInvokeParams : InvokeParams
                        Data_t out_,
                        bool gfx90aFp16alt_)
         : op_args(op_args_),
-          inDesc(in_desc),
+          inDesc(std::move(in_desc)),
           in(in_),
-          outDesc(out_desc),
+          outDesc(std::move(out_desc)),
           out(out_),
           gfx90aFp16alt(gfx90aFp16alt_)
     {
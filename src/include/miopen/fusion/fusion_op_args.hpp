@@ -28,6 +28,11 @@
 
 #include <miopen/miopen.h>
 
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
 namespace miopen {
 
 namespace fusion {
@@ -44,6 +49,23 @@ struct OperatorArgs : miopenOperatorArgs
             params.resize(idx + 1);
         params[idx] = std::move(arg);
     }
+
+    /// Sets the arguments of the op in the slot idx. The object which is already in the slot is
+    /// reused when it has the same type, so setting the arguments of a plan before each
+    /// execution does not allocate.
+    template <class T, class... Args>
+    void EmplaceArg(std::size_t idx, Args&&... args)
+    {
+        if(idx < params.size())
+        {
+            if(auto* const arg = dynamic_cast<T*>(params[idx].get()))
+            {
+                *arg = T(std::forward<Args>(args)...);
+                return;
+            }
+        }
+        SetArg(idx, std::make_unique<T>(std::forward<Args>(args)...));
+    }
 };
 
 } // namespace miopen
@@ -16,32 +16,6 @@ namespace solver {
 struct ConvSolution;
 } // namespace solver
 
-enum class Exec_Arg_Type_t
-{
-    Scalar,
-    Input_Ptr,
-    Output_Ptr,
-    Pointer,
-    Padding,
-    Default
-};
-
-struct Exec_arg_t
-{
-    std::string key;
-    Exec_Arg_Type_t type;
-    int size;
-    OpKernelArg val;
-    Exec_arg_t(std::string k, Exec_Arg_Type_t t, int s)
-        : key(std::move(k)), type(t), size(s), val(OpKernelArg(0))
-    {
-    }
-    Exec_arg_t(std::string k, Exec_Arg_Type_t t, int s, OpKernelArg v)
-        : key(std::move(k)), type(t), size(s), val(v)
-    {
-    }
-};
-
 struct FusionContext;
 struct MIOPEN_INTERNALS_EXPORT FusionPlanDescriptor : miopenFusionPlanDescriptor
 {
@@ -81,7 +55,6 @@ struct MIOPEN_INTERNALS_EXPORT FusionPlanDescriptor : miopenFusionPlanDescriptor
     FusionKernelSourceType kernel_source_type;
     bool fp_contains_bn;
     miopenDataType_t data_type;
-    std::vector<Exec_arg_t> arg_list;
     std::vector<Invoker> invokers;
     std::optional<miopenConvFwdAlgorithm_t> conv_fwd_algo;
 };
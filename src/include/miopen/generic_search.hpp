@@ -37,7 +37,11 @@
 #include <miopen/logger.hpp>
 #include <miopen/timer.hpp>
 #include <miopen/mt_queue.hpp>
+#include <miopen/rank.hpp>
+#include <miopen/generic_search_checkpoint.hpp>
 #include <miopen/generic_search_controls.hpp>
+#include <miopen/generic_search_strategy.hpp>
+#include <miopen/tuning_queue.hpp>
 
 #include <algorithm>
 #include <vector>
@@ -46,7 +50,14 @@
 #include <iterator>
 #include <chrono>
 #include <cassert>
+#include <cstdint>
+#include <numeric>
+#include <optional>
 #include <random>
+#include <sstream>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
 
 namespace miopen {
 namespace solver {
@@ -234,13 +245,118 @@ public:
             Continue();
         }
     }
+
+    void MonitorRefinement(const size_t round,
+                           const PerformanceConfig& config,
+                           const MeasurementStats& stats,
+                           const bool is_kept)
+    {
+        MIOPEN_LOG_I("Round " << round << ": " << stats.Mean() << " +- " << stats.Margin() << " ("
+                              << stats.Count() << " runs, stddev " << stats.StdDev() << ") "
+                              << (is_kept ? "kept " : "dropped ") << config);
+    }
 };
 
+template <class PerformanceConfig>
+struct TuningCandidate
+{
+    PerformanceConfig config;
+    Invoker invoker;
+    MeasurementStats stats;
+};
+
+/// Keeps the configs which were the fastest in a single run, along with their invokers.
+template <class PerformanceConfig>
+void KeepCandidate(std::vector<TuningCandidate<PerformanceConfig>>& pool,
+                   const std::size_t pool_size,
+                   const PerformanceConfig& config,
+                   Invoker invoker,
+                   const float time)
+{
+    auto candidate = TuningCandidate<PerformanceConfig>{config, std::move(invoker), {}};
+    candidate.stats.Add(time);
+
+    if(pool.size() < pool_size)
+    {
+        pool.emplace_back(std::move(candidate));
+        return;
+    }
+
+    const auto slowest =
+        std::max_element(pool.begin(), pool.end(), [](const auto& lhs, const auto& rhs) {
+            return lhs.stats.Mean() < rhs.stats.Mean();
+        });
+    if(slowest != pool.end() && time < slowest->stats.Mean())
+        *slowest = std::move(candidate);
+}
+
+/// Successive halving over the kept candidates: the survivors of each round are measured
+/// twice as many times as in the previous one, until a single one is left.
+/// Returns the index of the fastest candidate, or nullopt if all have failed.
+template <class PerformanceConfig>
+std::optional<std::size_t> RefineCandidates(std::vector<TuningCandidate<PerformanceConfig>>& pool,
+                                            const Handle& profile_h,
+                                            const AnyInvokeParams& invoke_ctx,
+                                            HeartBeat<PerformanceConfig>& heartbeat)
+{
+    constexpr std::size_t max_runs = 32;
+
+    std::vector<std::size_t> survivors(pool.size());
+    std::iota(survivors.begin(), survivors.end(), std::size_t{0});
+
+    for(std::size_t round = 0, runs = 2; survivors.size() > 1 && runs <= max_runs;
+        ++round, runs *= 2)
+    {
+        std::vector<std::size_t> measured;
+        std::vector<MeasurementStats> stats;
+
+        for(const auto idx : survivors)
+        {
+            auto& candidate = pool[idx];
+            try
+            {
+                while(candidate.stats.Count() < runs)
+                {
+                    candidate.invoker(profile_h, invoke_ctx);
+                    candidate.stats.Add(profile_h.GetKernelTime());
+                }
+            }
+            catch(const std::exception& e)
+            {
+                MIOPEN_LOG_E("Error: Exception encountered : " << e.what());
+                continue;
+            }
+            measured.push_back(idx);
+            stats.push_back(candidate.stats);
+        }
+
+        const auto kept = SelectSurvivors(stats);
+        survivors.clear();
+        for(const auto i : kept)
+            survivors.push_back(measured[i]);
+
+        for(const auto idx : measured)
+        {
+            const auto is_kept = std::find(survivors.begin(), survivors.end(), idx) !=
+                                 survivors.end();
+            heartbeat.MonitorRefinement(round, pool[idx].config, pool[idx].stats, is_kept);
+        }
+    }
+
+    if(survivors.empty())
+        return std::nullopt;
+    return survivors.front();
+}
+
 /// Solver member function requirements:
 /// * GetDefaultPerformanceConfig shall be implemented.
 ///   - Its return type shall be suitable for instantiation of the ComputedContainer.
 /// * GetSolution shall be implemented.
 /// * Solution should provide invoker
+/// * GetSearchStrategy() may be implemented to choose the SearchStrategyKind used to tune
+///   the solver. MIOPEN_TUNING_STRATEGY takes precedence. The default is Random.
+/// * GetSearchSpaceSize(context, problem) may be implemented to report the number of
+///   configs in the main set (or an upper bound of it) without enumerating them.
 ///
 /// clang-format-off
 /// -----------------------------------------------
@@ -262,6 +378,23 @@ public:
 /// ------------------------------------------------
 /// clang-format-on
 
+template <class Solver, class Context, class Problem>
+auto GetSolverSearchSpaceSize(const Solver& s,
+                              const Context& context,
+                              const Problem& problem,
+                              rank<1>)
+    -> decltype(s.GetSearchSpaceSize(context, problem), std::optional<std::size_t>{})
+{
+    return s.GetSearchSpaceSize(context, problem);
+}
+
+template <class Solver, class Context, class Problem>
+std::optional<std::size_t>
+GetSolverSearchSpaceSize(const Solver&, const Context&, const Problem&, rank<0>)
+{
+    return std::nullopt;
+}
+
 template <class Solver, class Context, class Problem>
 auto GetAllConfigs(const Solver s, const Context& context, const Problem& problem)
     -> ComputedContainer<decltype(s.GetDefaultPerformanceConfig(context, problem)),
@@ -271,17 +404,61 @@ auto GetAllConfigs(const Solver s, const Context& context, const Problem& proble
     using PerformanceConfig = decltype(s.GetDefaultPerformanceConfig(context, problem));
 
     const ComputedContainer<PerformanceConfig, Context, Problem> primary(context, problem);
-    const int primary_size = std::distance(primary.begin(), primary.end());
     const ComputedContainer<PerformanceConfig, Context, Problem> spare(context, problem, true);
-    const int spare_size = std::distance(spare.begin(), spare.end());
-    const bool useSpare  = (primary_size == 0);
+    // Looks for the first valid config only, the sets are enumerated once by the caller.
+    const bool useSpare = primary.begin() == primary.end();
 
-    ComputedContainer<PerformanceConfig, Context, Problem> all_configs = useSpare ? spare : primary;
-    const int n_runs_total = useSpare ? spare_size : primary_size;
-    MIOPEN_LOG_W(s.SolverDbId() << ": Searching the best solution among " << n_runs_total
-                                << (useSpare ? " (spare)" : "") << "...");
+    if(useSpare)
+    {
+        MIOPEN_LOG_W(s.SolverDbId() << ": Searching the best solution (spare)...");
+        return spare;
+    }
 
-    return all_configs;
+    const auto size = GetSolverSearchSpaceSize(s, context, problem, rank<1>{});
+    if(size)
+        MIOPEN_LOG_W(s.SolverDbId() << ": Searching the best solution among " << *size << "...");
+    else
+        MIOPEN_LOG_W(s.SolverDbId() << ": Searching the best solution...");
+    return primary;
+}
+
+/// Collects a uniformly random subset of at most `limit` configs in a single pass
+/// (reservoir sampling), so that each config is validated once and no more than `limit`
+/// configs are held in memory. Returns the subset and the number of all configs of the shard.
+template <class PerformanceConfig, class Context, class Problem>
+std::pair<std::vector<PerformanceConfig>, std::size_t>
+SampleConfigs(const ComputedContainer<PerformanceConfig, Context, Problem>& configs,
+              const std::size_t limit,
+              const std::size_t size_hint,
+              const std::uint64_t seed,
+              const TuningShard& shard = {})
+{
+    std::vector<PerformanceConfig> sample;
+    sample.reserve(std::min(limit, size_hint / shard.count));
+    auto rng = std::mt19937_64{seed};
+
+    std::size_t n_configs = 0;
+    std::size_t position  = 0;
+    for(const auto& config : configs)
+    {
+        // Only the configs of the shard are considered, see TuningWorkItem.
+        if(position++ % shard.count != shard.index)
+            continue;
+
+        if(sample.size() < limit)
+        {
+            sample.push_back(config);
+        }
+        else
+        {
+            const auto idx = std::uniform_int_distribution<std::size_t>{0, n_configs}(rng);
+            if(idx < limit)
+                sample[idx] = config;
+        }
+        ++n_configs;
+    }
+
+    return {std::move(sample), n_configs};
 }
 
 template <class Solver, class Context, class Problem>
@@ -306,22 +483,34 @@ std::size_t GetTuningIterationsMax();
 std::chrono::milliseconds GetTuningTimeMax(); // returns the max allowed time in milliseconds
 std::size_t GetTuningThreadsMax();
 
+template <class Solver>
+auto GetSolverSearchStrategy(const Solver& s, rank<1>) -> decltype(s.GetSearchStrategy())
+{
+    return s.GetSearchStrategy();
+}
+
+template <class Solver>
+SearchStrategyKind GetSolverSearchStrategy(const Solver&, rank<0>)
+{
+    return SearchStrategyKind::Random;
+}
+
 template <typename PerformanceConfig, typename Solver, typename Context, typename Problem>
-void CompileAgent(size_t thread_index,
-                  size_t total_threads,
-                  const Solver& s,
-                  const Context& context,
-                  const Problem& problem,
-                  std::vector<PerformanceConfig>& data,
-                  ThreadSafeQueue<std::tuple<PerformanceConfig, ConvSolution, bool>>& comp_queue)
+void CompileAgent(
+    size_t thread_index,
+    const Solver& s,
+    const Context& context,
+    const Problem& problem,
+    const std::vector<PerformanceConfig>& data,
+    SearchFeeder& feeder,
+    ThreadSafeQueue<std::tuple<PerformanceConfig, ConvSolution, bool, std::size_t>>& comp_queue)
 {
     const auto start_time =
         std::chrono::time_point_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now());
-    const auto data_size   = data.size();
     const auto time_budget = GetTuningTimeMax();
     const auto& profile_h  = context.GetStream();
     // start the counter
-    for(auto idx = thread_index; idx < data_size; idx += total_threads)
+    while(true)
     {
         // Check if we are out of time
         const auto current_time = std::chrono::time_point_cast<std::chrono::milliseconds>(
@@ -329,11 +518,15 @@ void CompileAgent(size_t thread_index,
         if(current_time - start_time > time_budget)
         {
             MIOPEN_LOG_I2("Thread: " << thread_index << " Done, exhausted time budget");
-            auto tmp = std::make_tuple<PerformanceConfig, ConvSolution, bool>({}, {}, true);
-            comp_queue.push(std::move(tmp));
             break;
         }
-        auto& current_config          = data.at(idx);
+        const auto idx = feeder.Take();
+        if(!idx)
+        {
+            MIOPEN_LOG_I2("Thread: " << thread_index << " Done, completed tuning");
+            break;
+        }
+        const auto& current_config    = data.at(*idx);
         ConvSolution current_solution = s.GetSolution(context, problem, current_config);
         for(const auto& kernel : current_solution.construction_params)
         {
@@ -341,11 +534,21 @@ void CompileAgent(size_t thread_index,
                 continue;
             std::ignore = profile_h.LoadProgram(kernel.kernel_file, kernel.comp_options, "");
         }
-        auto tup = std::make_tuple<PerformanceConfig, ConvSolution, bool>(
-            std::move(current_config), std::move(current_solution), false);
-        comp_queue.push(std::move(tup));
+        auto tup = std::make_tuple<PerformanceConfig, ConvSolution, bool, std::size_t>(
+            PerformanceConfig{current_config},
+            std::move(current_solution),
+            false,
+            std::size_t{*idx});
+        if(!comp_queue.push(std::move(tup)))
+        {
+            MIOPEN_LOG_I2("Thread: " << thread_index << " Done, search is over");
+            break;
+        }
     }
-    MIOPEN_LOG_I2("Thread: " << thread_index << " Done, completed tuning");
+    // Lets the consumer know that no more items come from this thread, whatever the reason.
+    auto tmp =
+        std::make_tuple<PerformanceConfig, ConvSolution, bool, std::size_t>({}, {}, true, 0);
+    comp_queue.push(std::move(tmp));
 }
 
 template <class Solver, class Context, class Problem>
@@ -371,26 +574,89 @@ auto GenericSearch(const Solver s,
     auto& profile_h = context.GetStream();
     const AutoEnableProfiling enableProfiling{profile_h};
 
-    auto tmp_all_configs = GetAllConfigs(s, context, problem);
-    // For random access
-    std::vector<PerformanceConfig> all_configs;
-    std::copy(tmp_all_configs.begin(), tmp_all_configs.end(), std::back_inserter(all_configs));
-    // shuffle the configs
-    std::random_device rd{};
-    auto rng = std::default_random_engine{rd()};
-    std::shuffle(all_configs.begin(), all_configs.end(), rng);
-    std::size_t n_runs_total = std::min(all_configs.size(), GetTuningIterationsMax());
-    all_configs.resize(n_runs_total);
     std::size_t patience = env::value(MIOPEN_TUNING_PATIENCE);
 
-    if(all_configs.empty())
+    const auto strategy_kind =
+        GetSearchStrategyKind(s.SolverDbId(), GetSolverSearchStrategy(s, rank<1>{}));
+
+    // The random strategy measures a random subset only, so there is no need to keep the rest.
+    // The model-guided strategies choose the configs to measure from all of them.
+    const auto sample_limit = strategy_kind == SearchStrategyKind::Random
+                                  ? GetTuningIterationsMax()
+                                  : std::numeric_limits<std::size_t>::max();
+    // The tuning workers search a slice of the configs each.
+    const auto shard = context.tuning_shard ? *context.tuning_shard : TuningShard{};
+    if(shard.count == 0 || shard.index >= shard.count)
+        MIOPEN_THROW("Invalid tuning shard " + std::to_string(shard.index) + "/" +
+                     std::to_string(shard.count));
+
+    // An interrupted search is resumed with the same seed, and thus the same configs.
+    auto checkpoint = [&]() {
+        if(env::enabled(MIOPEN_DEBUG_COMPILE_ONLY))
+            return TuningCheckpoint{};
+        auto key = problem.MakeNetworkConfig().ToString();
+        if(shard.count > 1)
+            key += "_shard" + std::to_string(shard.index) + "of" + std::to_string(shard.count);
+        return TuningCheckpoint::Open(profile_h.GetDbBasename(), s.SolverDbId(), key);
+    }();
+    const auto seed = checkpoint.GetSeed().value_or(std::random_device{}());
+
+    const auto size_hint = GetSolverSearchSpaceSize(s, context, problem, rank<1>{});
+    auto [all_configs, n_all_configs] = SampleConfigs(
+        GetAllConfigs(s, context, problem), sample_limit, size_hint.value_or(0), seed, shard);
+    MIOPEN_LOG_I(s.SolverDbId() << ": " << n_all_configs << " configs, " << all_configs.size()
+                                << " sampled");
+
+    // Hints are measured first, so they are added if left out of the sample.
+    std::vector<std::string> serialized_configs(all_configs.size());
+    std::vector<std::size_t> hinted;
+    if(strategy_kind != SearchStrategyKind::Random || checkpoint.IsEnabled() ||
+       !context.tuning_hints.empty())
+    {
+        for(std::size_t i = 0; i < all_configs.size(); ++i)
+        {
+            std::ostringstream ss;
+            ss << all_configs[i];
+            serialized_configs[i] = ss.str();
+        }
+    }
+    for(const auto& hint : context.tuning_hints)
+    {
+        const auto found = std::find(serialized_configs.begin(), serialized_configs.end(), hint);
+        if(found != serialized_configs.end())
+        {
+            hinted.push_back(
+                static_cast<std::size_t>(std::distance(serialized_configs.begin(), found)));
+            continue;
+        }
+
+        PerformanceConfig config{};
+        if(!config.Deserialize(hint) || !config.IsValid(context, problem))
+        {
+            MIOPEN_LOG_I2(s.SolverDbId() << ": Hint is not applicable: " << hint);
+            continue;
+        }
+        std::ostringstream ss;
+        ss << config;
+        hinted.push_back(all_configs.size());
+        all_configs.push_back(std::move(config));
+        serialized_configs.push_back(ss.str());
+    }
+
+    std::size_t n_runs_total = GetSearchBudget(strategy_kind, all_configs.size());
+
+    if(n_runs_total == 0)
     {
         const auto default_config = s.GetDefaultPerformanceConfig(context, problem);
 
         if(default_config.IsValid(context, problem))
         {
-            all_configs.emplace_back(default_config);
-            n_runs_total += 1;
+            std::ostringstream ss;
+            ss << default_config;
+            all_configs        = {default_config};
+            serialized_configs = {ss.str()};
+            hinted.clear();
+            n_runs_total = 1;
         }
         else
         {
@@ -400,6 +666,38 @@ auto GenericSearch(const Solver s,
         }
     }
 
+    if(strategy_kind != SearchStrategyKind::Random)
+    {
+        MIOPEN_LOG_I(s.SolverDbId() << ": " << ToCString(strategy_kind) << " search, measuring "
+                                    << n_runs_total << " of " << all_configs.size());
+    }
+    const auto strategy =
+        MakeSearchStrategy(strategy_kind, serialized_configs, n_runs_total, seed);
+
+    // Configs measured before the search was interrupted, along with their times.
+    std::vector<std::pair<std::size_t, std::optional<float>>> restored;
+    {
+        const auto measurements =
+            checkpoint.Resume(seed, all_configs.size(), ToCString(strategy_kind));
+        std::unordered_map<std::string_view, std::size_t> index;
+        if(!measurements.empty())
+        {
+            for(std::size_t i = 0; i < serialized_configs.size(); ++i)
+                index.emplace(serialized_configs[i], i);
+        }
+        for(const auto& measurement : measurements)
+        {
+            const auto found = index.find(measurement.config);
+            if(found == index.end())
+                continue;
+            strategy->Restore(found->second, measurement.time);
+            checkpoint.Record(measurement.config, measurement.time);
+            restored.emplace_back(found->second, measurement.time);
+        }
+    }
+    for(const auto idx : hinted)
+        strategy->Prioritize(idx);
+
     bool is_passed  = false; // left false only if all iterations failed.
     float best_time = std::numeric_limits<float>::max();
     size_t n_failed = 0;
@@ -409,18 +707,30 @@ auto GenericSearch(const Solver s,
 
     const auto total_threads = GetTuningThreadsMax();
 
-    ThreadSafeQueue<std::tuple<PerformanceConfig, ConvSolution, bool>> solution_queue;
+    // Model-guided strategies shall not run too far ahead of the measurements.
+    SearchFeeder feeder{*strategy,
+                        strategy_kind == SearchStrategyKind::Random ||
+                                env::enabled(MIOPEN_DEBUG_COMPILE_ONLY)
+                            ? std::numeric_limits<std::size_t>::max()
+                            : 2 * std::max<std::size_t>(total_threads, 1)};
+
+    // Compiled programs stay loaded until measured, so the compile agents are only allowed to
+    // get a bit ahead of the measurements. Nothing is measured in the compile-only mode.
+    ThreadSafeQueue<std::tuple<PerformanceConfig, ConvSolution, bool, std::size_t>>
+        solution_queue{env::enabled(MIOPEN_DEBUG_COMPILE_ONLY)
+                           ? std::numeric_limits<std::size_t>::max()
+                           : std::max<std::size_t>(total_threads, 1)};
     std::vector<std::thread> compile_agents;
     compile_agents.reserve(total_threads);
     for(auto idx = 0; idx < total_threads; ++idx)
     {
         compile_agents.emplace_back(CompileAgent<PerformanceConfig, Solver, Context, Problem>,
                                     idx,
-                                    total_threads,
                                     std::cref(s),
                                     std::cref(context),
                                     std::cref(problem),
-                                    std::ref(all_configs),
+                                    std::cref(all_configs),
+                                    std::ref(feeder),
                                     std::ref(solution_queue));
     }
 
@@ -429,6 +739,60 @@ auto GenericSearch(const Solver s,
         size_t n_current       = 0;
         size_t last_imprv      = 0;
         auto threads_remaining = total_threads;
+
+        // In the successive halving mode, each config is run once, and the fastest ones are
+        // re-measured afterwards.
+        const auto is_halving = env::enabled(MIOPEN_TUNING_SUCCESSIVE_HALVING);
+        const auto pool_size =
+            std::max<std::size_t>(env::value(MIOPEN_TUNING_HALVING_POOL), 1);
+        std::vector<TuningCandidate<PerformanceConfig>> pool;
+
+        for(const auto& [idx, time] : restored)
+        {
+            ++n_current;
+            if(!time)
+            {
+                ++n_failed;
+                continue;
+            }
+            is_passed = true;
+            if(*time < best_time)
+            {
+                best_config = all_configs[idx];
+                best_time   = *time;
+                n_best      = n_current - 1;
+            }
+        }
+
+        if(is_halving)
+        {
+            // Restored configs take part in the re-measurements, so they are compiled again.
+            auto fastest = restored;
+            fastest.erase(std::remove_if(fastest.begin(),
+                                         fastest.end(),
+                                         [](const auto& item) { return !item.second; }),
+                          fastest.end());
+            std::sort(fastest.begin(), fastest.end(), [](const auto& lhs, const auto& rhs) {
+                return *lhs.second < *rhs.second;
+            });
+            fastest.resize(std::min(fastest.size(), pool_size));
+
+            for(const auto& [idx, time] : fastest)
+            {
+                try
+                {
+                    const auto solution = s.GetSolution(context, problem, all_configs[idx]);
+                    auto invoker = profile_h.PrepareInvoker(*solution.invoker_factory,
+                                                            solution.construction_params);
+                    KeepCandidate(pool, pool_size, all_configs[idx], std::move(invoker), *time);
+                }
+                catch(const std::exception& e)
+                {
+                    MIOPEN_LOG_E("Error: Exception encountered : " << e.what());
+                }
+            }
+        }
+
         while(true)
         {
             if(n_current >= n_runs_total)
@@ -444,9 +808,10 @@ auto GenericSearch(const Solver s,
 
             last_imprv++;
             MIOPEN_LOG_I2("Waiting for item in queue");
-            const auto kinder     = solution_queue.pop();
-            auto current_config   = std::get<0>(kinder);
-            auto current_solution = std::get<1>(kinder);
+            auto kinder            = solution_queue.pop();
+            auto current_config    = std::move(std::get<0>(kinder));
+            auto current_solution  = std::move(std::get<1>(kinder));
+            const auto current_idx = std::get<3>(kinder);
 
             if(std::get<2>(kinder))
             {
@@ -500,7 +865,22 @@ auto GenericSearch(const Solver s,
                          << '/' << n_runs_total << " elapsed_time: " << elapsed_time
                          << ", best_time: " << best_time << ", " << current_config);
 
-            if(ret == 0)
+            if(ret == 0 && is_halving)
+            {
+                is_passed = true;
+                KeepCandidate(pool, pool_size, current_config, invoker, elapsed_time);
+                if(elapsed_time < best_time)
+                {
+                    MIOPEN_LOG_I('#' << n_current << '/' << n_failed << '/' << n_runs_total << ' '
+                                     << elapsed_time << " < " << best_time << ' '
+                                     << current_config);
+                    best_config = current_config;
+                    best_time   = elapsed_time;
+                    n_best      = n_current;
+                    last_imprv  = 0;
+                }
+            }
+            else if(ret == 0)
             {
                 // Smooth the jitter of measurements:
                 // If the 1st probe is NOT too bad (measured time <= 1.10 * best known time),
@@ -560,6 +940,9 @@ auto GenericSearch(const Solver s,
                                  << " Failed rc=" << ret);
                 ++n_failed;
             }
+            const auto result = ret == 0 ? std::optional<float>{elapsed_time} : std::nullopt;
+            feeder.Report(current_idx, result);
+            checkpoint.Record(serialized_configs[current_idx], result);
             heartbeat.Monitor(ret != 0,
                               elapsed_time,
                               n_current,
@@ -569,21 +952,51 @@ auto GenericSearch(const Solver s,
                               current_config);
             ++n_current;
         }
+
+        if(is_halving && !pool.empty())
+        {
+            MIOPEN_LOG_I("Re-measuring " << pool.size() << " fastest configs");
+            const auto winner = RefineCandidates(pool, profile_h, invoke_ctx, heartbeat);
+            if(winner)
+            {
+                const auto& candidate = pool[*winner];
+                MIOPEN_LOG_W("Refined: " << candidate.stats.Mean() << " +- "
+                                         << candidate.stats.Margin() << " ("
+                                         << candidate.stats.Count() << " runs) "
+                                         << candidate.config);
+                best_config = candidate.config;
+                best_time   = candidate.stats.Mean();
+            }
+        }
     }
     else
     {
+        for(auto& agent : compile_agents)
+            agent.join();
         MIOPEN_THROW(miopenStatusGpuOperationsSkipped,
                      "Running kernels on GPU is disabled. Search skipped");
     }
 
+    feeder.Stop();
+    solution_queue.close();
     for(auto& agent : compile_agents)
         agent.join();
 
+    // The search is over, the result will be stored in the perf-db.
+    checkpoint.Finish();
+
     MIOPEN_LOG_W("Done: " << n_runs_total << '/' << n_failed << '/' << n_runs_total << ", best #"
                           << n_best << ' ' << best_time << ' ' << best_config);
 
     if(!is_passed)
         MIOPEN_THROW("Search failed");
+
+    if(context.tuning_shard)
+    {
+        std::ostringstream ss;
+        ss << best_config;
+        context.tuning_shard->result = TuningResult{ss.str(), best_time};
+    }
     // Run once with the default config and show score.
 
     const auto& invoker = profile_h.PrepareInvoker(*default_solution.invoker_factory,
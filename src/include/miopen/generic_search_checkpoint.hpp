@@ -0,0 +1,123 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_GENERIC_SEARCH_CHECKPOINT_HPP_
+#define GUARD_MIOPEN_GENERIC_SEARCH_CHECKPOINT_HPP_
+
+#include <miopen/config.hpp>
+#include <miopen/filesystem.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace miopen {
+
+class LockFile;
+
+namespace solver {
+
+/// Progress of a GenericSearch session, so that the search resumes where it has left off
+/// if the process is killed. Each measurement is appended to the file as soon as it is done.
+/// The file is removed once the search is over. Not MT-safe.
+///
+/// The file is locked for as long as the object lives. A search which finds it locked by another
+/// thread or process tuning the same problem runs without a checkpoint, leaving the file alone.
+///
+/// File format:
+///   MIOpenTuningCheckpoint <version>
+///   <key>
+///   <seed> <number of configs> <strategy>
+///   <time or "-" if failed> <serialized config>
+///   ...
+class MIOPEN_INTERNALS_EXPORT TuningCheckpoint
+{
+public:
+    struct Measurement
+    {
+        std::string config;
+        std::optional<float> time;
+    };
+
+    /// Does nothing.
+    TuningCheckpoint() = default;
+    /// Loads the interrupted session from the file, if any, and if it belongs to the same key.
+    /// Disabled if the file is locked by another session.
+    TuningCheckpoint(const fs::path& path_, const std::string& key_);
+
+    /// Returns the checkpoint for the solver and the problem in the user db directory.
+    /// Does nothing if the user db is disabled or MIOPEN_DEBUG_TUNING_CHECKPOINT=0.
+    static TuningCheckpoint Open(const std::string& db_basename,
+                                 const std::string& solver_id,
+                                 const std::string& problem_key);
+
+    bool IsEnabled() const { return !path.empty(); }
+
+    /// The seed of the interrupted session. The same seed yields the same set and order of
+    /// configs, which is required to resume the session.
+    std::optional<std::uint64_t> GetSeed() const;
+
+    /// Returns the measurements of the interrupted session if it has searched the same configs
+    /// with the same strategy. Otherwise, starts a new session from scratch.
+    std::vector<Measurement>
+    Resume(std::uint64_t seed, std::size_t n_configs, std::string_view strategy);
+
+    void Record(const std::string& config, std::optional<float> time);
+
+    /// Removes the file. To be called once the search is over.
+    void Finish();
+
+private:
+    struct Header
+    {
+        std::uint64_t seed;
+        std::size_t n_configs;
+        std::string strategy;
+    };
+
+    struct Unlock
+    {
+        void operator()(LockFile* lock) const;
+    };
+
+    fs::path path;
+    std::string key;
+    std::unique_ptr<LockFile, Unlock> lock;
+    std::optional<Header> header;
+    std::vector<Measurement> measurements;
+    std::ofstream file;
+
+    void Load();
+};
+
+} // namespace solver
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_GENERIC_SEARCH_CHECKPOINT_HPP_
@@ -29,6 +29,7 @@
 #include <miopen/config.h>
 #include <chrono>
 #include <limits>
+#include <thread>
 
 MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_DEBUG_TUNING_ITERATIONS_MAX,
                               std::numeric_limits<std::size_t>::max())
@@ -38,6 +39,13 @@ MIOPEN_DECLARE_ENV_VAR_UINT64(
 MIOPEN_DECLARE_ENV_VAR_UINT64(
     MIOPEN_TUNING_PATIENCE,
     std::numeric_limits<std::size_t>::max()) // End tuning if no improvement in X iterations
+MIOPEN_DECLARE_ENV_VAR_STR(MIOPEN_TUNING_STRATEGY)
+MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_TUNING_STRATEGY_BUDGET) // 0 means a fraction of all configs
+MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_TUNING_SUCCESSIVE_HALVING)
+MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_TUNING_HALVING_POOL, 16) // Configs kept for re-measurements
+MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_TUNING_CHECKPOINT) // Enabled unless set to 0
+MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_TUNING_TRANSFER_K, 4) // Nearest tuned problems to start from
+MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_PERFDB_USE_NEAREST) // Instead of the default perf config
 
 #if MIOPEN_USE_COMGR
 MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_COMPILE_PARALLEL_LEVEL, 1) // COMGR is not parallelizable
@@ -0,0 +1,160 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_GENERIC_SEARCH_STRATEGY_HPP_
+#define GUARD_MIOPEN_GENERIC_SEARCH_STRATEGY_HPP_
+
+#include <miopen/config.hpp>
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace miopen {
+namespace solver {
+
+/// Order in which GenericSearch measures the perf configs.
+enum class SearchStrategyKind
+{
+    /// Uniformly shuffled, all configs up to the tuning iterations limit.
+    Random,
+    /// Simulated annealing over the neighbourhood of the current config.
+    Annealing,
+    /// Genetic search: crossover and mutation of the fastest configs.
+    Genetic,
+    /// Bayesian optimization with a kernel regression surrogate.
+    Bayes,
+};
+
+MIOPEN_INTERNALS_EXPORT const char* ToCString(SearchStrategyKind kind);
+MIOPEN_INTERNALS_EXPORT std::optional<SearchStrategyKind>
+ParseSearchStrategyKind(std::string_view str);
+
+/// Returns the strategy set for the solver by MIOPEN_TUNING_STRATEGY, or `preferred`.
+///
+/// The variable holds a ';'-separated list of entries, each is either a strategy name
+/// (applies to all solvers) or "SolverDbId:name". Names are case-insensitive.
+MIOPEN_INTERNALS_EXPORT SearchStrategyKind GetSearchStrategyKind(const std::string& solver_id,
+                                                                 SearchStrategyKind preferred);
+
+/// Max number of configs to measure out of `n_candidates` with the given strategy.
+/// Model-guided strategies measure a fraction of the configs unless
+/// MIOPEN_TUNING_STRATEGY_BUDGET is set. All strategies respect the tuning iterations limit.
+MIOPEN_INTERNALS_EXPORT std::size_t GetSearchBudget(SearchStrategyKind kind,
+                                                    std::size_t n_candidates);
+
+/// Chooses the next perf config to measure based on the measurements done so far.
+///
+/// Candidates are identified by their index in the list passed to MakeSearchStrategy().
+/// Each candidate is proposed at most once. Several candidates may be proposed before
+/// their results are reported, as they are compiled ahead of the measurements.
+/// Not MT-safe, see SearchFeeder.
+class MIOPEN_INTERNALS_EXPORT SearchStrategy
+{
+public:
+    virtual ~SearchStrategy() = default;
+
+    /// Returns nullopt once the budget is exhausted.
+    virtual std::optional<std::size_t> Next() = 0;
+    /// `time` is nullopt if the candidate has failed.
+    virtual void Report(std::size_t candidate, std::optional<float> time) = 0;
+    /// Accounts for a candidate measured before the search was interrupted, as if it were
+    /// proposed and reported. Shall be called before the first Next().
+    virtual void Restore(std::size_t candidate, std::optional<float> time) = 0;
+    /// Proposes the candidate before the others, in the order of the calls, unless it is
+    /// restored. Shall be called before the first Next().
+    virtual void Prioritize(std::size_t candidate) = 0;
+};
+
+/// The parameter space is derived from the serialized configs: each field of a config
+/// (separated by non-alphanumeric characters) is a dimension, and its distinct values
+/// are ordered numerically when possible and lexicographically otherwise.
+MIOPEN_INTERNALS_EXPORT std::unique_ptr<SearchStrategy>
+MakeSearchStrategy(SearchStrategyKind kind,
+                   const std::vector<std::string>& candidates,
+                   std::size_t budget,
+                   std::uint64_t seed);
+
+/// MT-safe access to the strategy for the compile agents and the measurement loop.
+///
+/// Model-guided strategies need results to make progress, so Take() blocks while
+/// `max_pending` candidates have been taken but not reported.
+class MIOPEN_INTERNALS_EXPORT SearchFeeder
+{
+public:
+    SearchFeeder(SearchStrategy& strategy_, std::size_t max_pending_);
+
+    /// Returns nullopt when the search is over.
+    std::optional<std::size_t> Take();
+    void Report(std::size_t candidate, std::optional<float> time);
+    /// Wakes up and finishes all waiting Take() calls.
+    void Stop();
+
+private:
+    SearchStrategy& strategy;
+    std::size_t max_pending;
+    std::size_t pending = 0;
+    bool stopped        = false;
+    std::mutex mutex;
+    std::condition_variable cond_var;
+};
+
+/// Running mean and variance of the repeated measurements of a config.
+class MIOPEN_INTERNALS_EXPORT MeasurementStats
+{
+public:
+    void Add(float time);
+
+    std::size_t Count() const { return count; }
+    float Mean() const { return static_cast<float>(mean); }
+    float StdDev() const;
+    /// Half-width of the 95% confidence interval of the mean.
+    /// Infinite until there are at least two measurements.
+    float Margin() const;
+    float Lower() const { return Mean() - Margin(); }
+    float Upper() const { return Mean() + Margin(); }
+
+private:
+    std::size_t count = 0;
+    double mean       = 0.0;
+    double m2         = 0.0;
+};
+
+/// One round of successive halving. Returns the indices of the configs worth measuring
+/// further, fastest first: the configs which are confidently slower than the fastest one
+/// are dropped, and at most half of the configs (rounded up) are kept.
+MIOPEN_INTERNALS_EXPORT std::vector<std::size_t>
+SelectSurvivors(const std::vector<MeasurementStats>& stats);
+
+} // namespace solver
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_GENERIC_SEARCH_STRATEGY_HPP_
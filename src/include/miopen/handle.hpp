@@ -165,6 +165,7 @@ struct MIOPEN_EXPORT Handle : miopenHandle
     }
 
     std::size_t m_MaxMemoryAllocSizeCached = 0;
+    /// Thread-safe.
     virtual std::size_t GetMaxMemoryAllocSize();
     virtual bool CooperativeLaunchSupported() const;
 
@@ -176,6 +177,9 @@ private:
 
 public:
     std::ostream& Print(std::ostream& os) const;
+    /// Makes the device of the handle current for the calling thread, e.g. for a worker thread
+    /// which queries the device on behalf of the handle.
+    void SetCurrentDevice() const;
     void Copy(ConstData_t src, Data_t dest, std::size_t size) const;
 
     Allocator::ManageDataPtr Create(std::size_t sz) const;
@@ -284,6 +288,29 @@ public:
         return invokers.GetFound1_0(config, *algo);
     }
 
+    /// Same as above, without building the network config once the problem is known.
+    std::optional<Invoker> GetInvoker(const conv::ProblemKey& problem,
+                                      const std::optional<solver::Id>& solver,
+                                      const std::optional<AlgorithmName>& algo = std::nullopt) const
+    {
+        assert(solver || algo);
+        assert(!(solver && algo));
+        if(solver)
+        {
+            MIOPEN_LOG_I2("Returning an invoker for problem " << problem.ToString()
+                                                              << " and solver "
+                                                              << solver->ToString());
+            return invokers.Get(problem, solver->ToString());
+        }
+
+        if(!algo)
+            MIOPEN_THROW(miopenStatusInternalError);
+
+        MIOPEN_LOG_I2("Returning an invoker for problem " << problem.ToString()
+                                                          << " and algorithm " << algo->ToString());
+        return invokers.GetFound1_0(problem, *algo);
+    }
+
     std::optional<std::string> GetFound1_0SolverId(const NetworkConfig& config,
                                                    const AlgorithmName& algo) const
     {
@@ -26,23 +26,34 @@
 
 #pragma once
 
+#include <miopen/config.hpp>
+#include <miopen/conv/problem_key.hpp>
 #include <miopen/errors.hpp>
 #include <miopen/invoker.hpp>
 
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <optional>
 
 namespace miopen {
 
-class InvokerCache
+class MIOPEN_INTERNALS_EXPORT InvokerCache
 {
 public:
     // network_config, solver_id
     using Key = std::pair<std::string, std::string>;
 
+    InvokerCache() = default;
+    // by_key points into invokers, so a copy would point into the source. A move keeps the
+    // nodes of both maps, so the pointers stay valid.
+    InvokerCache(const InvokerCache&) = delete;
+    InvokerCache& operator=(const InvokerCache&) = delete;
+    InvokerCache(InvokerCache&&) noexcept = default;
+    InvokerCache& operator=(InvokerCache&&) noexcept = default;
+
     std::optional<Invoker> operator[](const Key& key) const;
     // For find 1.0
     std::optional<Invoker> GetFound1_0(const std::string& network_config,
@@ -50,6 +61,11 @@ public:
     std::optional<std::string> GetFound1_0SolverId(const std::string& network_config,
                                                    const std::string& algorithm) const;
 
+    // Same as above, but the network config is only built on the first lookup of the problem.
+    std::optional<Invoker> Get(const conv::ProblemKey& problem, const std::string& solver_id) const;
+    std::optional<Invoker> GetFound1_0(const conv::ProblemKey& problem,
+                                       const std::string& algorithm) const;
+
     void Register(const Key& key, const Invoker& invoker);
     // For find 1.0
     void SetAsFound1_0(const std::string& network_config,
@@ -66,8 +82,17 @@ private:
         std::map<std::string, Invoker> invokers;
     };
 
+    const Item* Find(const conv::ProblemKey& problem) const;
+    static std::optional<Invoker> GetFound1_0(const Item& item,
+                                              const std::string& network_config,
+                                              const std::string& algorithm);
+
     // network_config -> Item
     std::map<std::string, Item> invokers;
+    // Items of the convolution problems which were looked up by ProblemKey. The items are
+    // never removed, so the pointers stay valid; anything that erases from invokers must clear
+    // by_key as well. Like the rest of the cache, it is used by the thread of the handle only.
+    mutable std::unordered_map<conv::ProblemKey, const Item*, conv::ProblemKey::Hasher> by_key;
 };
 
 } // namespace miopen
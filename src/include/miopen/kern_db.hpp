@@ -38,53 +38,121 @@
 #include <boost/none.hpp>
 #include <boost/optional/optional.hpp>
 
+#include <cstdint>
 #include <functional>
+#include <mutex>
 #include <string>
 #include <chrono>
 #include <thread>
+#include <tuple>
+#include <vector>
 
 namespace miopen {
+
+/// Brings equivalent spellings of compiler options to one form, so they map to the same cache
+/// entry. Tokens are separated by single spaces, "-D NAME" is joined into "-DNAME" and defines
+/// are sorted. Defines keep their order if it may matter, i.e. if a macro is defined twice or
+/// any macro is undefined with -U.
+MIOPEN_INTERNALS_EXPORT std::string NormalizeKernelArgs(const std::string& args);
+
 struct KernelConfig
 {
     static std::string table_name() { return "kern_db"; }
+    /// Binaries of the user db, keyed by the md5 of their uncompressed contents. Kernels with
+    /// identical binaries share one row.
+    static std::string blob_table_name() { return "kern_blob"; }
     fs::path kernel_name;
     std::string kernel_args;
     std::vector<char> kernel_blob;
-    static std::vector<std::string> FieldNames()
-    {
-        return {"kernel_name", "kernel_args", "kernel_blob"};
-    }
+    static std::vector<std::string> FieldNames() { return {"kernel_name", "kernel_args"}; }
     static std::string CreateQuery()
     {
         std::ostringstream ss;
-        ss << "CREATE TABLE IF NOT EXISTS `" << KernelConfig::table_name() << "` ("
+        ss << "CREATE TABLE IF NOT EXISTS `" << KernelConfig::blob_table_name() << "` ("
+           << "`kernel_hash` TEXT PRIMARY KEY NOT NULL"
+           << ",`kernel_blob` BLOB NOT NULL"
+           << ",`uncompressed_size` INT NOT NULL"
+           << ");"
+           << "CREATE TABLE IF NOT EXISTS `" << KernelConfig::table_name() << "` ("
            << "`id` INTEGER PRIMARY KEY ASC"
            << ",`kernel_name` TEXT NOT NULL"
            << ",`kernel_args` TEXT NOT NULL"
-           << ",`kernel_blob` BLOB NOT NULL"
            << ",`kernel_hash` TEXT NOT NULL"
-           << ",`uncompressed_size` INT NOT NULL"
+           << ",`last_access` INT NOT NULL DEFAULT 0"
            << ");"
            << "CREATE UNIQUE INDEX IF NOT EXISTS "
            << "`idx_" << KernelConfig::table_name() << "` "
-           << "ON " << KernelConfig::table_name() << "(kernel_name, kernel_args);";
+           << "ON " << KernelConfig::table_name() << "(kernel_name, kernel_args);"
+           << "CREATE INDEX IF NOT EXISTS "
+           << "`idx_" << KernelConfig::table_name() << "_hash` "
+           << "ON " << KernelConfig::table_name() << "(kernel_hash);";
         return ss.str();
     }
-    std::string Where() const
+    std::tuple<std::string, std::vector<std::string>> WhereClause() const
     {
-        std::ostringstream ss;
-        ss << "(kernel_name = '" << kernel_name.string() << "')"
-           << " AND (kernel_args = '" << kernel_args << "')";
-        return ss.str();
+        return std::make_tuple("(kernel_name = ?) AND (kernel_args = ?)",
+                               std::vector<std::string>{kernel_name.string(), kernel_args});
     }
 };
 
+/// Kernel binary cache.
+///
+/// User dbs created by this version keep binaries in a separate table, referenced by the
+/// (kernel_name, kernel_args) rows. System dbs and older user dbs have a single table with the
+/// binaries inline. Both layouts are read and written.
+///
+/// Kernel args are normalized with NormalizeKernelArgs() before they are stored. Lookups try the
+/// normalized args first and then the original ones, which older dbs have been keyed with.
 class KernDb : public SQLiteBase<KernDb>
 {
     std::function<std::vector<char>(const std::vector<char>&, bool*)> compress_fn;
     std::function<std::vector<char>(const std::vector<char>&, unsigned int)> decompress_fn;
+    /// False for system dbs and for user dbs created before access times were recorded, which
+    /// could not be upgraded.
+    bool has_access_time = false;
+    /// True if binaries are stored in the blob table rather than inline.
+    bool has_blob_table = false;
+    /// Serializes the public record methods, as an instance is shared by the threads of
+    /// the process through GetCached().
+    std::mutex mutex;
+
+    /// Adds the access time column and its index to user dbs created by older versions.
+    void UpgradeSchemaUnsafe();
+    void TouchUnsafe(std::int64_t id);
+    boost::optional<std::vector<char>> FindBlobUnsafe(const fs::path& kernel_name,
+                                                      const std::string& kernel_args);
+    bool BlobExistsUnsafe(const std::string& hash);
+    void StoreBlobUnsafe(const std::string& hash, const std::vector<char>& blob);
+    /// Removes binaries no kernel refers to anymore.
+    void RemoveUnusedBlobsUnsafe();
+    void RemoveUnusedBlobUnsafe(const std::string& hash);
+
+    template <class TFunc>
+    void TransactionUnsafe(TFunc&& func)
+    {
+        sql.Exec("BEGIN IMMEDIATE;");
+        try
+        {
+            func();
+            sql.Exec("COMMIT;");
+        }
+        catch(...)
+        {
+            sql.Exec("ROLLBACK;");
+            throw;
+        }
+    }
 
 public:
+    struct EvictionStats
+    {
+        std::uint64_t records = 0;
+        std::uint64_t bytes   = 0;
+    };
+
+    /// Milliseconds since the epoch, the unit of the `last_access` column.
+    static std::int64_t Now();
+
     MIOPEN_INTERNALS_EXPORT KernDb(DbKinds db_kind, const fs::path& filename_, bool is_system);
     // This constructor is only intended for testing
     MIOPEN_INTERNALS_EXPORT
@@ -93,96 +161,57 @@ public:
            bool is_system_,
            std::function<std::vector<char>(const std::vector<char>&, bool*)> compress_fn_,
            std::function<std::vector<char>(const std::vector<char>&, unsigned int)> decompress_fn_);
-    template <typename T>
-    bool RemoveRecordUnsafe(const T& problem_config)
+    KernDb(const KernDb&) = delete;
+    KernDb& operator=(const KernDb&) = delete;
+
+    /// Returns the instance for the path, which keeps its connection and thus its prepared
+    /// statements open for the lifetime of the process.
+    MIOPEN_INTERNALS_EXPORT static KernDb&
+    GetCached(DbKinds db_kind, const fs::path& path, bool is_system);
+
+    boost::optional<std::vector<char>> FindRecord(const KernelConfig& problem_config)
     {
-        if(filename.empty())
-            return true;
-        auto del_query =
-            "DELETE FROM " + T::table_name() + " WHERE " + problem_config.Where() + ";";
-        auto stmt = SQLite::Statement{sql, del_query};
-        auto rc   = stmt.Step(sql);
-        if(rc == SQLITE_DONE)
-        {
-            return true;
-        }
-        else
-        {
-            MIOPEN_THROW(miopenStatusInternalError, sql.ErrorMessage());
-            return false;
-        }
+        const std::lock_guard<std::mutex> lock{mutex};
+        return SQLiteBase::FindRecord(problem_config);
     }
 
-    template <typename T>
-    boost::optional<std::vector<char>> FindRecordUnsafe(const T& problem_config)
+    bool StoreRecord(const KernelConfig& problem_config)
     {
-        if(filename.empty())
-            return boost::none;
-        // Where clause with inserted values defeats the purpose of a prepraed statement
-        auto select_query = "SELECT kernel_blob, kernel_hash, uncompressed_size FROM " +
-                            T::table_name() + " WHERE " + problem_config.Where() + ";";
-        auto stmt = SQLite::Statement{sql, select_query};
-        // only one result field
-        // assert one row
-        auto rc = stmt.Step(sql);
-        if(rc == SQLITE_ROW)
-        {
-            auto compressed_blob                 = stmt.ColumnBlob(0);
-            auto md5_hash                        = stmt.ColumnText(1);
-            auto uncompressed_size               = stmt.ColumnInt64(2);
-            std::vector<char>& decompressed_blob = compressed_blob;
-            if(uncompressed_size != 0)
-            {
-                decompressed_blob = decompress_fn(compressed_blob, uncompressed_size);
-            }
-            auto new_md5 = md5(decompressed_blob);
-            if(new_md5 != md5_hash)
-                MIOPEN_THROW(miopenStatusInternalError, "Possible database corruption");
-            return decompressed_blob;
-        }
-        else if(rc == SQLITE_DONE)
-        {
-            return boost::none;
-        }
-        else
-        {
-            MIOPEN_THROW(miopenStatusInternalError, sql.ErrorMessage());
-        }
-        return boost::none;
+        const std::lock_guard<std::mutex> lock{mutex};
+        return SQLiteBase::StoreRecord(problem_config);
     }
 
-    template <typename T>
-    bool StoreRecordUnsafe(const T& problem_config)
+    bool RemoveRecord(const KernelConfig& problem_config)
     {
-        if(filename.empty())
-            return false;
-        auto insert_query = "INSERT OR REPLACE INTO " + T::table_name() +
-                            "(kernel_name, kernel_args, kernel_blob, kernel_hash, "
-                            "uncompressed_size) VALUES(?, ?, ?, ?, ?);";
-        auto md5_sum           = md5(problem_config.kernel_blob);
-        auto uncompressed_size = problem_config.kernel_blob.size();
-        bool success           = false;
-        auto compressed_blob   = compress_fn(problem_config.kernel_blob, &success);
-        auto stmt              = SQLite::Statement{sql, insert_query};
-        stmt.BindPath(1, problem_config.kernel_name);
-        stmt.BindText(2, problem_config.kernel_args);
-        if(!success)
-        {
-            stmt.BindBlob(3, problem_config.kernel_blob);
-            stmt.BindInt64(5, 0);
-        }
-        else
-        {
-            stmt.BindBlob(3, compressed_blob);
-            stmt.BindInt64(5, uncompressed_size);
-        }
-        stmt.BindText(4, md5_sum);
+        const std::lock_guard<std::mutex> lock{mutex};
+        return SQLiteBase::RemoveRecord(problem_config);
+    }
 
-        auto rc = stmt.Step(sql);
-        if(rc != SQLITE_DONE)
-            MIOPEN_THROW(miopenStatusInternalError, sql.ErrorMessage());
-        return true;
+    EvictionStats Evict(std::uint64_t quota)
+    {
+        const std::lock_guard<std::mutex> lock{mutex};
+        return EvictUnsafe(quota);
     }
+
+    /// Size of the live pages of the db file, excluding the free ones.
+    MIOPEN_INTERNALS_EXPORT std::uint64_t GetUsedBytesUnsafe();
+
+    /// Removes the least recently used kernels until the db takes no more than 90% of the quota,
+    /// so that each new kernel does not trigger another eviction. Does nothing while the db is
+    /// within the quota.
+    ///
+    /// Kernels are ranked by the access times recorded while MIOPEN_CACHE_SIZE_LIMIT_MB is set.
+    MIOPEN_INTERNALS_EXPORT EvictionStats EvictUnsafe(std::uint64_t quota);
+
+    /// Returns free pages of the db file to the file system. Dbs created with incremental
+    /// auto-vacuum are compacted in place. Others are vacuumed once a quarter of their pages is
+    /// free, as VACUUM rewrites the whole file.
+    MIOPEN_INTERNALS_EXPORT bool CompactUnsafe();
+
+    MIOPEN_INTERNALS_EXPORT bool RemoveRecordUnsafe(const KernelConfig& problem_config);
+    MIOPEN_INTERNALS_EXPORT boost::optional<std::vector<char>>
+    FindRecordUnsafe(const KernelConfig& problem_config);
+    MIOPEN_INTERNALS_EXPORT bool StoreRecordUnsafe(const KernelConfig& problem_config);
 };
 } // namespace miopen
 #endif
@@ -148,7 +148,7 @@ public:
                return flock.timed_lock_sharable(ToPTime(duration));
            }))
             return true;
-        access_mutex.unlock();
+        access_mutex.unlock_shared();
         return false;
     }
 
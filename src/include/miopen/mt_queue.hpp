@@ -28,32 +28,58 @@
 
 #include <queue>
 #include <condition_variable>
+#include <cstddef>
+#include <limits>
 #include <mutex>
 
+/// Multi-producer queue. When the capacity is reached, push() blocks until an item is popped,
+/// so that the producers do not run too far ahead of the consumer.
 template <typename T>
 class ThreadSafeQueue
 {
     std::mutex mutex;
     std::condition_variable cond_var;
+    std::condition_variable not_full;
     std::queue<T> queue;
+    std::size_t capacity = std::numeric_limits<std::size_t>::max();
+    bool closed          = false;
 
 public:
-    void push(T&& item)
-    {
+    ThreadSafeQueue() = default;
+    explicit ThreadSafeQueue(std::size_t capacity_) : capacity(capacity_ == 0 ? 1 : capacity_) {}
 
+    /// Returns false and drops the item if the queue is closed.
+    bool push(T&& item)
+    {
         {
-            std::lock_guard<std::mutex> lock(mutex);
-            queue.push(item);
+            std::unique_lock<std::mutex> lock(mutex);
+            not_full.wait(lock, [&] { return closed || queue.size() < capacity; });
+            if(closed)
+                return false;
+            queue.push(std::move(item));
         }
 
         cond_var.notify_one();
+        return true;
     }
     T pop()
     {
         std::unique_lock<std::mutex> lock(mutex);
         cond_var.wait(lock, [&] { return !queue.empty(); });
-        T ret = queue.front();
+        T ret = std::move(queue.front());
         queue.pop();
+        lock.unlock();
+        not_full.notify_one();
         return ret;
     }
+    /// Wakes up the producers waiting for space, and makes all further pushes fail.
+    /// To be used when the consumer stops early.
+    void close()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            closed = true;
+        }
+        not_full.notify_all();
+    }
 };
@@ -117,6 +117,11 @@ struct Problem
     std::vector<Solution>
     FindSolutions(Handle& handle, const FindOptions& options, std::size_t max_solutions) const;
 
+    /// Loads the perf-db and find-db files that are kept in memory, so that they are read before
+    /// the problems are solved one by one. Looks up the perf-db records of the problems in
+    /// batches, which the SQLite system perf-db keeps for the later lookups.
+    static void PrefetchDbs(Handle& handle, const std::vector<Problem>& problems);
+
     conv::ProblemDescription AsConvolution() const;
     activ::ProblemDescription AsActivation() const;
     mha::ProblemDescription AsMha() const;
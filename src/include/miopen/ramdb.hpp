@@ -26,14 +26,21 @@
 #pragma once
 
 #include <miopen/db.hpp>
+#include <miopen/db_nearest.hpp>
 #include <miopen/db_record.hpp>
 
 #include <boost/optional.hpp>
 
 #include <chrono>
+#include <cstdint>
+#include <functional>
 #include <map>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
 #include <string>
 #include <sstream>
+#include <vector>
 
 // Value of one enables experimental write-through feature of RamDb.
 // It provides some performance gain in case of multi-threaded cache write operations.
@@ -58,6 +65,7 @@ public:
     }
 
     RamDb(DbKinds db_kind_, const fs::path& path, bool is_system = false);
+    ~RamDb();
 
     RamDb(const RamDb&) = delete;
     RamDb(RamDb&&)      = delete;
@@ -85,15 +93,36 @@ public:
         return FindRecord(key);
     }
 
+    /// Searches the cache for all provided keys, validating it once for the whole batch.
+    std::vector<boost::optional<DbRecord>> FindRecords(const std::vector<std::string>& keys);
+
+    template <class TProblem>
+    std::vector<boost::optional<DbRecord>> FindRecords(const std::vector<TProblem>& problems)
+    {
+        return FindRecords(DbRecord::SerializeKeys(db_kind, problems));
+    }
+
     template <class TProblem, class TValue>
     bool Load(const TProblem& problem, const std::string& id, TValue& value)
     {
-        const auto record = FindRecord(problem);
-        if(!record)
-            return false;
-        return record->GetValues(id, value);
+        return VisitRecord(MakeKey(problem),
+                           [&](const DbRecordView& record) { return record.GetValues(id, value); });
     }
 
+    /// Calls the visitor with a view of the cached record under the key, without parsing it.
+    /// The view is only valid during the call.
+    ///
+    /// Returns false if there is no such record, otherwise the result of the visitor.
+    bool VisitRecord(const std::string& key,
+                     const std::function<bool(const DbRecordView&)>& visitor);
+
+    /// Calls func for every cached record in the key order. The views are only valid during
+    /// the call, and the db shall not be accessed from func.
+    void ForEachRecord(const std::function<void(const DbRecordView&)>& func);
+
+    /// Offers the records to nearest through an index, which is rebuilt when the cache changes.
+    void VisitNearest(NearestRecords& nearest);
+
     bool StoreRecord(const DbRecord& record);
     bool UpdateRecord(DbRecord& record);
     bool RemoveRecord(const std::string& key);
@@ -113,6 +142,19 @@ public:
         return RemoveRecord(key);
     }
 
+    /// In the write-behind mode (MIOPEN_DEBUG_DB_WRITE_BEHIND) writes only update the cache and
+    /// a journal of pending changes, coalesced per key. The journal is written to the file by
+    /// a background thread, on handle destruction and when the db is destroyed.
+    ///
+    /// Writes the pending changes, if any. Returns false if the file could not be written, in
+    /// which case the changes are kept for the next attempt.
+    bool Flush();
+
+    /// Flushes all dbs in the write-behind mode.
+    static void FlushAll();
+
+    bool IsWriteBehind() const { return write_behind; }
+
     template <class T, class V>
     inline boost::optional<DbRecord>
     Update(const T& problem_config, const std::string& id, const V& values)
@@ -133,14 +175,70 @@ private:
         std::string content;
     };
 
+    /// Pending change of a record. Ids mapped to nullopt have been removed. If replace is set,
+    /// the record in the file is discarded before applying the values.
+    struct JournalItem
+    {
+        bool replace = false;
+        std::map<std::string, std::optional<std::string>> values;
+    };
+
+    using Journal = std::map<std::string, JournalItem, std::less<>>;
+
     ramdb_clock::time_point file_read_time;
     std::map<std::string, CacheItem> cache;
+    const bool write_behind;
+    /// Changes not yet written to the file in the write-behind mode, guarded by cache_mutex.
+    /// The cache always reflects them.
+    Journal journal;
+
+    /// Guards the cache within the process. Lookups take it shared, while writes and cache
+    /// refreshes take it exclusively. When both are needed, it is acquired after the file lock.
+    mutable std::shared_mutex cache_mutex;
+
+    /// Last write time of the .time file seen while the cache was validated. As long as it is
+    /// unchanged and trusted, lookups skip the file lock and the validation.
+    std::optional<std::int64_t> time_file_stamp;
+    ramdb_clock::time_point time_file_stamp_seen;
+    bool time_file_stamp_trusted = false;
+
+    /// Changes with every change of the cache, guarded by cache_mutex.
+    std::uint64_t cache_version = 0;
+    std::mutex nearest_index_mutex;
+    NearestIndex nearest_index;
+    std::optional<std::uint64_t> nearest_index_version;
 
     boost::optional<miopen::DbRecord> FindRecordUnsafe(const std::string& problem);
 
+    template <class TFunc>
+    auto ReadCache(TFunc&& func);
+    template <class TFunc>
+    auto WriteCache(TFunc&& func);
+    template <class TFunc>
+    auto RefreshCache(TFunc&& func);
+    bool IsCacheFreshUnsafe() const;
+    void RefreshCacheUnsafe();
+
+    template <class TProblem>
+    std::string MakeKey(const TProblem& problem) const
+    {
+        return DbRecord::SerializeKey(db_kind, problem);
+    }
+
+    const std::string& MakeKey(const std::string& key) const { return key; }
+
     bool ValidateUnsafe();
     void Prefetch();
 
+    bool StoreRecordDeferred(const DbRecord& record);
+    bool UpdateRecordDeferred(DbRecord& record);
+    bool RemoveRecordDeferred(const std::string& key);
+    bool RemoveDeferred(const std::string& key, const std::string& id);
+    void SetCacheEntryUnsafe(const DbRecord& record);
+    void ApplyJournalUnsafe();
+    bool WriteJournal(const Journal& changes);
+    static void ApplyJournalItem(DbRecord& record, const JournalItem& item);
+
 #if MIOPEN_DB_CACHE_WRITE_THROUGH
     void UpdateCacheEntryUnsafe(const DbRecord& record);
 #endif
@@ -178,6 +276,12 @@ public:
         return Measure("FindRecord", [&]() { return inner.FindRecord(problem); });
     }
 
+    template <class TProblem>
+    auto FindRecords(const std::vector<TProblem>& problems)
+    {
+        return Measure("FindRecords", [&]() { return inner.FindRecords(problems); });
+    }
+
     bool StoreRecord(const DbRecord& record)
     {
         return Measure("StoreRecord", [&]() { return inner.StoreRecord(record); });
@@ -26,14 +26,21 @@
 #ifndef MIOPEN_GUARD_MLOPEN_READONLYRAMDB_HPP
 #define MIOPEN_GUARD_MLOPEN_READONLYRAMDB_HPP
 
+#include <miopen/db_index.hpp>
+#include <miopen/db_nearest.hpp>
 #include <miopen/db_record.hpp>
 #include <miopen/filesystem.hpp>
 
 #include <boost/optional.hpp>
 
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <string>
+#include <string_view>
 #include <sstream>
+#include <vector>
 
 namespace miopen {
 
@@ -46,27 +53,40 @@ class MIOPEN_INTERNALS_EXPORT ReadonlyRamDb
 public:
     ReadonlyRamDb(DbKinds db_kind_, const fs::path& path) : db_kind(db_kind_), db_path(path) {}
 
+    ReadonlyRamDb(const ReadonlyRamDb&) = delete;
+    ReadonlyRamDb(ReadonlyRamDb&&)      = delete;
+    ReadonlyRamDb& operator=(const ReadonlyRamDb&) = delete;
+    ReadonlyRamDb& operator=(ReadonlyRamDb&&) = delete;
+
+    /// Returns the shared instance for the path, loading the db on the first call. Only the
+    /// callers of a db which is still being loaded wait for it.
     static ReadonlyRamDb&
     GetCached(DbKinds db_kind_, const fs::path& path, bool warn_if_unreadable);
 
+    /// Starts loading the db on a background thread, unless it is loaded already.
+    static void PrefetchAsync(DbKinds db_kind_, const fs::path& path);
+
+    /// Location of the compressed copy of a db, used when the db itself is not installed.
+    static fs::path GetCompressedPath(const fs::path& path) { return path + ".bz2"; }
+
     boost::optional<DbRecord> FindRecord(const std::string& problem) const
     {
         MIOPEN_LOG_I2("Looking for key " << problem << " in file " << db_path);
-        const auto it = cache.find(problem);
+        const auto item = FindItem(problem);
 
-        if(it == cache.end())
+        if(!item)
             return boost::none;
 
         auto record = DbRecord{problem};
 
         MIOPEN_LOG_I2("Key match: " << problem);
-        MIOPEN_LOG_I2("Contents found: " << it->second.content);
+        MIOPEN_LOG_I2("Contents found: " << item->content);
 
-        if(!record.ParseContents(it->second.content))
+        if(!record.ParseContents(item->content))
         {
             MIOPEN_LOG_E("Error parsing payload under the key: "
-                         << problem << " form file " << db_path << "#" << it->second.line);
-            MIOPEN_LOG_E("Contents: " << it->second.content);
+                         << problem << " form file " << db_path << "#" << item->line);
+            MIOPEN_LOG_E("Contents: " << item->content);
             return boost::none;
         }
 
@@ -80,33 +100,85 @@ public:
         return FindRecord(key);
     }
 
+    std::vector<boost::optional<DbRecord>> FindRecords(const std::vector<std::string>& keys) const
+    {
+        auto records = std::vector<boost::optional<DbRecord>>{};
+        records.reserve(keys.size());
+        for(const auto& key : keys)
+            records.push_back(FindRecord(key));
+        return records;
+    }
+
+    template <class TProblem>
+    std::vector<boost::optional<DbRecord>> FindRecords(const std::vector<TProblem>& problems) const
+    {
+        return FindRecords(DbRecord::SerializeKeys(db_kind, problems));
+    }
+
+    /// Returns a view over the payload stored under the key. Unlike FindRecord(), the payload
+    /// is not parsed and nothing is allocated. The view stays valid as long as the db is alive.
+    boost::optional<DbRecordView> FindRecordView(const std::string& problem) const
+    {
+        const auto item = FindItem(problem);
+        if(!item)
+            return boost::none;
+        return DbRecordView{item->key, item->content};
+    }
+
+    template <class TProblem>
+    boost::optional<DbRecordView> FindRecordView(const TProblem& problem) const
+    {
+        const auto key = DbRecord::SerializeKey(db_kind, problem);
+        return FindRecordView(key);
+    }
+
     template <class TProblem, class TValue>
     bool Load(const TProblem& problem, const std::string& id, TValue& value) const
     {
-        const auto record = FindRecord(problem);
+        const auto record = FindRecordView(problem);
         if(!record)
             return false;
         return record->GetValues(id, value);
     }
 
+    /// Calls func for every record of the db in no particular order. The views are only valid
+    /// during the call.
+    void ForEachRecord(const std::function<void(const DbRecordView&)>& func) const;
+
+    /// Offers the records to nearest through an index, built on the first call.
+    void VisitNearest(NearestRecords& nearest) const;
+
     struct CacheItem
     {
         int line;
         std::string content;
     };
 
-    const std::unordered_map<std::string, CacheItem>& GetCacheMap() const { return cache; }
+    /// Returns all the records of the db. When the db is served from the index, the map is
+    /// materialized on the first call, so this is intended for tests and tools only.
+    const std::unordered_map<std::string, CacheItem>& GetCacheMap() const;
 
 private:
+    struct ItemView
+    {
+        int line;
+        std::string_view key;
+        std::string_view content;
+    };
+
     DbKinds db_kind;
     fs::path db_path;
-    std::unordered_map<std::string, CacheItem> cache;
+    std::unique_ptr<DbIndex> index;
+    mutable std::unordered_map<std::string, CacheItem> cache;
+    mutable std::once_flag cache_materialized;
+    mutable NearestIndex nearest_index;
+    mutable std::once_flag nearest_indexed;
+    std::once_flag prefetched;
 
-    ReadonlyRamDb(const ReadonlyRamDb&) = default;
-    ReadonlyRamDb(ReadonlyRamDb&&)      = default;
-    ReadonlyRamDb& operator=(const ReadonlyRamDb&) = default;
-    ReadonlyRamDb& operator=(ReadonlyRamDb&&) = default;
+    static ReadonlyRamDb& GetInstance(DbKinds db_kind_, const fs::path& path);
 
+    boost::optional<ItemView> FindItem(const std::string& problem) const;
+    bool TryLoadIndex();
     void Prefetch(bool warn_if_unreadable);
     void ParseAndLoadDb(std::istream& input_stream, bool warn_if_unreadable);
 };
@@ -0,0 +1,143 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_SHARED_PROGRAM_CACHE_HPP_
+#define GUARD_MIOPEN_SHARED_PROGRAM_CACHE_HPP_
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace miopen {
+
+struct SharedProgramCacheStats
+{
+    std::size_t hits      = 0;
+    std::size_t misses    = 0;
+    std::size_t evictions = 0;
+    std::size_t entries   = 0;
+    std::size_t bytes     = 0;
+};
+
+/// Programs shared by all the handles of the process. The handles of a device load each program
+/// from the binary cache only once and keep references to the same code object. When the size of
+/// the code objects exceeds the limit, the least recently used programs which are not referenced
+/// outside of the cache are evicted. The programs in use are never evicted, so the cache may stay
+/// over the limit until the handles which use them are destroyed.
+template <class Program>
+class SharedProgramCache
+{
+public:
+    /// is_shared(program) tells if the program is referenced outside of the cache.
+    SharedProgramCache(std::size_t limit_, std::function<bool(const Program&)> is_shared_)
+        : limit(limit_), is_shared(std::move(is_shared_))
+    {
+    }
+
+    std::optional<Program> Find(const std::string& key)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        const auto it = index.find(key);
+        if(it == index.end())
+        {
+            ++stats.misses;
+            return std::nullopt;
+        }
+        ++stats.hits;
+        lru.splice(lru.begin(), lru, it->second);
+        return it->second->program;
+    }
+
+    /// Adds the program, or replaces the program stored with the same key.
+    void Insert(const std::string& key, const Program& program, std::size_t size)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        const auto it = index.find(key);
+        if(it != index.end())
+        {
+            stats.bytes -= it->second->size;
+            lru.erase(it->second);
+            index.erase(it);
+        }
+
+        lru.push_front(Entry{key, program, size});
+        index.emplace(key, lru.begin());
+        stats.bytes += size;
+
+        // The new program is about to be used by the caller, so it is not evicted.
+        for(auto entry = std::prev(lru.end()); stats.bytes > limit && entry != lru.begin();)
+        {
+            const auto current = entry--;
+            if(is_shared(current->program))
+                continue;
+            stats.bytes -= current->size;
+            ++stats.evictions;
+            index.erase(current->key);
+            lru.erase(current);
+        }
+    }
+
+    SharedProgramCacheStats GetStats() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto ret    = stats;
+        ret.entries = lru.size();
+        return ret;
+    }
+
+    void Clear()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        index.clear();
+        lru.clear();
+        stats.bytes = 0;
+    }
+
+private:
+    struct Entry
+    {
+        std::string key;
+        Program program;
+        std::size_t size;
+    };
+
+    const std::size_t limit;
+    const std::function<bool(const Program&)> is_shared;
+
+    mutable std::mutex mutex;
+    std::list<Entry> lru;
+    std::unordered_map<std::string, typename std::list<Entry>::iterator> index;
+    SharedProgramCacheStats stats;
+};
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_SHARED_PROGRAM_CACHE_HPP_
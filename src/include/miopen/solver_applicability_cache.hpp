@@ -0,0 +1,217 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_SOLVER_APPLICABILITY_CACHE_HPP_
+#define GUARD_MIOPEN_SOLVER_APPLICABILITY_CACHE_HPP_
+
+#include <miopen/config.hpp>
+#include <miopen/names.hpp>
+#include <miopen/solver_id.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace miopen {
+
+struct ExecutionContext;
+
+namespace conv {
+struct ProblemDescription;
+} // namespace conv
+
+namespace solver {
+
+/// Memoized results of the solver checks for one problem. Solvers are indexed by Id::Value().
+/// Thread-safe.
+class MIOPEN_INTERNALS_EXPORT ApplicabilityRecord
+{
+public:
+    std::optional<bool> IsApplicable(Id id) const;
+    void SetApplicable(Id id, bool applicable);
+
+    std::optional<std::size_t> GetWorkspaceSize(Id id) const;
+    void SetWorkspaceSize(Id id, std::size_t size);
+
+    std::optional<float> GetWti(Id id) const;
+    void SetWti(Id id, float wti);
+
+private:
+    struct Estimates
+    {
+        std::optional<std::size_t> workspace_size;
+        std::optional<float> wti;
+    };
+
+    mutable std::shared_mutex mutex;
+    std::vector<bool> checked;
+    std::vector<bool> applicable_solvers;
+    std::unordered_map<std::uint64_t, Estimates> estimates;
+};
+
+struct ApplicabilityCacheStats
+{
+    std::uint64_t hits      = 0;
+    std::uint64_t misses    = 0;
+    std::uint64_t evictions = 0;
+    std::size_t entries     = 0;
+};
+
+/// Bounded LRU map from a problem key to its ApplicabilityRecord. Records are dropped when any
+/// environment variable is changed by the library, because solvers read the environment in
+/// IsApplicable(). Thread-safe.
+class MIOPEN_INTERNALS_EXPORT ApplicabilityCache
+{
+public:
+    explicit ApplicabilityCache(std::size_t capacity_);
+
+    /// Returns the record of the key, creating an empty one on a miss.
+    /// Returns nullptr if the capacity is 0.
+    std::shared_ptr<ApplicabilityRecord> Get(const std::string& key);
+
+    bool IsEnabled() const { return capacity > 0; }
+
+    ApplicabilityCacheStats GetStats() const;
+    void ResetStats();
+    void Clear();
+
+private:
+    struct Entry
+    {
+        std::string key;
+        std::uint64_t env_generation;
+        std::shared_ptr<ApplicabilityRecord> record;
+    };
+
+    std::size_t capacity;
+    mutable std::mutex mutex;
+    std::list<Entry> lru; // Most recently used first.
+    std::unordered_map<std::string, std::list<Entry>::iterator> index;
+    ApplicabilityCacheStats stats;
+};
+
+/// Process-wide cache, MIOPEN_DEBUG_APPLICABILITY_CACHE_SIZE entries (0 disables it).
+MIOPEN_INTERNALS_EXPORT ApplicabilityCache& GetApplicabilityCache();
+
+/// The key consists of the problem, the device and the context flags that IsApplicable() may
+/// depend on.
+MIOPEN_INTERNALS_EXPORT std::string MakeApplicabilityKey(const ExecutionContext& ctx,
+                                                         const NetworkConfig& network_config);
+
+/// Unlike the network config, includes the tensor strides and the convolution attributes.
+MIOPEN_INTERNALS_EXPORT std::string
+MakeApplicabilityKey(const ExecutionContext& ctx, const miopen::conv::ProblemDescription& problem);
+
+template <class Problem>
+std::string MakeApplicabilityKey(const ExecutionContext& ctx, const Problem& problem)
+{
+    return MakeApplicabilityKey(ctx, problem.MakeNetworkConfig());
+}
+
+/// Record of the problem in the process-wide cache, or nullptr if the cache is disabled.
+template <class Problem>
+std::shared_ptr<ApplicabilityRecord> GetApplicabilityRecord(const ExecutionContext& ctx,
+                                                            const Problem& problem)
+{
+    auto& cache = GetApplicabilityCache();
+    if(!cache.IsEnabled())
+        return nullptr;
+    return cache.Get(MakeApplicabilityKey(ctx, problem));
+}
+
+/// The functions below call the solver if the record is null or does not have the result yet.
+/// Solvers missing from the registry are not cached.
+
+template <class Solver, class Problem>
+bool CachedIsApplicable(ApplicabilityRecord* record,
+                        Id id,
+                        const Solver& solver,
+                        const ExecutionContext& ctx,
+                        const Problem& problem)
+{
+    if(record == nullptr || !id.IsValid())
+        return solver.IsApplicable(ctx, problem);
+    if(const auto known = record->IsApplicable(id))
+        return *known;
+    const auto applicable = solver.IsApplicable(ctx, problem);
+    record->SetApplicable(id, applicable);
+    return applicable;
+}
+
+/// For the solver classes, which are identified by SolverDbId().
+template <class Solver, class Problem>
+bool CachedIsApplicable(ApplicabilityRecord* record,
+                        const Solver& solver,
+                        const ExecutionContext& ctx,
+                        const Problem& problem)
+{
+    if(record == nullptr)
+        return solver.IsApplicable(ctx, problem);
+    return CachedIsApplicable(record, Id{solver.SolverDbId()}, solver, ctx, problem);
+}
+
+template <class Solver, class Problem>
+std::size_t CachedGetWorkspaceSize(ApplicabilityRecord* record,
+                                   Id id,
+                                   const Solver& solver,
+                                   const ExecutionContext& ctx,
+                                   const Problem& problem)
+{
+    if(record == nullptr || !id.IsValid())
+        return solver.GetWorkspaceSize(ctx, problem);
+    if(const auto known = record->GetWorkspaceSize(id))
+        return *known;
+    const auto size = solver.GetWorkspaceSize(ctx, problem);
+    record->SetWorkspaceSize(id, size);
+    return size;
+}
+
+template <class Solver, class Problem>
+float CachedGetWti(ApplicabilityRecord* record,
+                   Id id,
+                   const Solver& solver,
+                   const ExecutionContext& ctx,
+                   const Problem& problem)
+{
+    if(record == nullptr || !id.IsValid())
+        return solver.GetWti(ctx, problem);
+    if(const auto known = record->GetWti(id))
+        return *known;
+    const auto wti = solver.GetWti(ctx, problem);
+    record->SetWti(id, wti);
+    return wti;
+}
+
+} // namespace solver
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_SOLVER_APPLICABILITY_CACHE_HPP_
@@ -46,9 +46,14 @@
 #include <mutex>
 #include <thread>
 
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <shared_mutex>
 #include <string>
 #include <chrono>
 #include <unordered_map>
+#include <vector>
 
 MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_DISABLE_SQL_WAL)
 MIOPEN_DECLARE_ENV_VAR_STR(MIOPEN_DEBUG_PERFDB_OVERRIDE)
@@ -164,6 +169,8 @@ class MIOPEN_INTERNALS_EXPORT SQLite
     std::unique_ptr<impl> pImpl;
 
 public:
+    /// Prepared statements are pooled per connection by their query text and reused once the
+    /// Statement is destroyed. Values should therefore be bound instead of inlined into queries.
     class MIOPEN_INTERNALS_EXPORT Statement
     {
         class impl;
@@ -189,6 +196,15 @@ public:
         int BindInt64(int idx, int64_t);
     };
 
+    /// Process-wide counters of compiled statements and of the ones taken from the pools.
+    struct StatementStats
+    {
+        std::uint64_t prepared = 0;
+        std::uint64_t reused   = 0;
+    };
+
+    static StatementStats GetStatementStats();
+
     using result_type = std::vector<std::unordered_map<std::string, std::string>>;
     SQLite();
     SQLite(const fs::path& filename_, bool is_system);
@@ -324,6 +340,15 @@ public:
         return reinterpret_cast<Derived*>(this)->FindRecordUnsafe(args...);
     }
 
+    template <typename T>
+    inline auto FindRecords(const std::vector<T>& problem_configs)
+    {
+        using Ret = decltype(reinterpret_cast<Derived*>(this)->FindRecordsUnsafe(problem_configs));
+        if(!is_system && DisableUserDbFileIO)
+            return Ret(problem_configs.size());
+        return reinterpret_cast<Derived*>(this)->FindRecordsUnsafe(problem_configs);
+    }
+
     template <typename... U>
     inline auto RemoveRecord(U&... args)
     {
@@ -396,6 +421,18 @@ public:
     MIOPEN_INTERNALS_EXPORT
     SQLitePerfDb(DbKinds db_kind, const fs::path& filename_, bool is_system);
 
+    /// Records of a system db looked up by FindRecords(), shared by all the instances of the
+    /// path. The system db is read-only, so they never get stale. The lookups of a prefetched
+    /// config, e.g. Load() for each solver, are served from here instead of running a query.
+    struct PrefetchedRecords
+    {
+        std::shared_mutex mutex;
+        // Config values, as bound to the WHERE clause -> record
+        std::unordered_map<std::string, boost::optional<DbRecord>> records;
+    };
+
+    MIOPEN_INTERNALS_EXPORT static PrefetchedRecords& GetPrefetchedRecords(const fs::path& path);
+
     template <class T>
     inline void InsertConfig(const T& prob_desc)
     {
@@ -469,6 +506,18 @@ public:
         std::string clause;
         std::vector<std::string> values;
         std::tie(clause, values) = problem_config.WhereClause();
+
+        if(prefetched != nullptr)
+        {
+            const auto lock = std::shared_lock<std::shared_mutex>{prefetched->mutex};
+            if(!prefetched->records.empty())
+            {
+                const auto it = prefetched->records.find(JoinStrings(values, ","));
+                if(it != prefetched->records.end())
+                    return it->second;
+            }
+        }
+
         // clang-format off
         auto select_query =
             "SELECT solver, params "
@@ -502,6 +551,106 @@ public:
             return {rec};
     }
 
+    /// Searches for records of all PROBLEM_CONFIGS, running one query per batch of configs
+    /// instead of one per config. The records of a system db are kept for later lookups, see
+    /// PrefetchedRecords.
+    ///
+    /// Returns records in the order of PROBLEM_CONFIGS, none for the configs not found.
+    template <typename T>
+    inline std::vector<boost::optional<DbRecord>>
+    FindRecordsUnsafe(const std::vector<T>& problem_configs)
+    {
+        auto records = std::vector<boost::optional<DbRecord>>(problem_configs.size());
+        if(dbInvalid || problem_configs.empty())
+            return records;
+
+        if(!env::value(MIOPEN_DEBUG_PERFDB_OVERRIDE).empty())
+        {
+            for(std::size_t i = 0; i < problem_configs.size(); ++i)
+                records[i] = FindRecordUnsafe(problem_configs[i]);
+            return records;
+        }
+
+        // The batch size is fixed, so the query text is always the same and its prepared
+        // statement is reused. It is small enough to stay within the limit on bound parameters.
+        constexpr std::size_t batch_size = 16;
+        const auto table                 = problem_configs.front().table_name();
+
+        std::vector<std::string> columns;
+        for(const auto& name : problem_configs.front().FieldNames())
+            columns.push_back(table + "." + name);
+
+        for(std::size_t first = 0; first < problem_configs.size(); first += batch_size)
+        {
+            std::vector<std::string> clauses;
+            std::vector<std::string> values;
+            std::map<std::vector<std::string>, std::vector<std::size_t>> batch;
+
+            for(std::size_t i = first; i < first + batch_size; ++i)
+            {
+                // Unused slots of the last batch repeat its last config.
+                const auto idx = std::min(i, problem_configs.size() - 1);
+                std::string clause;
+                std::vector<std::string> config_values;
+                std::tie(clause, config_values) = problem_configs[idx].WhereClause();
+                clauses.push_back("( " + clause + " )");
+                values.insert(values.end(), config_values.begin(), config_values.end());
+                if(idx == i)
+                    batch[config_values].push_back(idx);
+            }
+
+            // clang-format off
+            auto select_query =
+                "SELECT solver, params, " + JoinStrings(columns, ", ") + " "
+                "FROM perf_db "
+                "INNER JOIN " + table + " "
+                "ON perf_db.config = " + table + ".id "
+                "WHERE " + JoinStrings(clauses, " OR ") + ";";
+            // clang-format on
+            auto stmt = SQLite::Statement{sql, select_query, values};
+            while(true)
+            {
+                auto rc = stmt.Step(sql);
+                if(rc == SQLITE_ROW)
+                {
+                    std::vector<std::string> config_values;
+                    for(std::size_t column = 0; column < columns.size(); ++column)
+                        config_values.push_back(stmt.ColumnText(static_cast<int>(column) + 2));
+
+                    const auto it = batch.find(config_values);
+                    if(it == batch.end())
+                        continue;
+
+                    const auto solver = stmt.ColumnText(0);
+                    const auto params = stmt.ColumnText(1);
+                    for(const auto idx : it->second)
+                    {
+                        if(!records[idx])
+                            records[idx].emplace();
+                        records[idx]->SetValues(solver, params);
+                    }
+                }
+                else if(rc == SQLITE_DONE)
+                {
+                    break;
+                }
+                else if(rc == SQLITE_ERROR || rc == SQLITE_MISUSE)
+                {
+                    MIOPEN_THROW(miopenStatusInternalError, sql.ErrorMessage());
+                }
+            }
+
+            if(prefetched != nullptr)
+            {
+                const auto lock = std::unique_lock<std::shared_mutex>{prefetched->mutex};
+                for(const auto& [config_values, indices] : batch)
+                    prefetched->records[JoinStrings(config_values, ",")] = records[indices.front()];
+            }
+        }
+
+        return records;
+    }
+
     /// Removes ID with associated VALUES from record with key PROBLEM_CONFIG from db.
     ///
     /// Returns true if remove was successful. Returns false if this PROBLEM_CONFIG or ID was not
@@ -520,8 +669,9 @@ public:
             "WHERE config IN ("
             "SELECT id FROM config WHERE ( "
             + clause + " ) )"
-            "AND solver == '" +  id + "' ;";
+            "AND solver == ? ;";
         // clang-format on
+        values.push_back(id);
         auto stmt = SQLite::Statement{sql, query, values};
         auto rc   = stmt.Step(sql);
         if(rc == SQLITE_DONE)
@@ -646,5 +796,9 @@ public:
             return false;
         return record->GetValues(id, values);
     }
+
+private:
+    /// Set for the system dbs only.
+    PrefetchedRecords* prefetched = nullptr;
 };
 } // namespace miopen
@@ -39,6 +39,8 @@
 
 #include <algorithm>
 #include <cassert>
+#include <memory>
+#include <mutex>
 #include <numeric>
 #include <vector>
 #include <optional>
@@ -264,6 +266,18 @@ struct MIOPEN_INTERNALS_EXPORT TensorDescriptor : miopenTensorDescriptor
     friend void from_json(const nlohmann::json& j, TensorDescriptor& descriptor);
 
 private:
+    /// Lengths and strides do not change after the construction, so the copies of a
+    /// descriptor share them and copying does not allocate.
+    struct Shape
+    {
+        std::vector<std::size_t> lens;
+        std::vector<std::size_t> strides;
+
+        // For GetLayout()
+        mutable std::vector<int64_t> permutation;
+        mutable std::once_flag permutation_computed;
+    };
+
     TensorDescriptor(miopenDataType_t t,
                      const std::optional<miopenTensorLayout_t>& layout_in,
                      const std::vector<std::size_t>& lens_in,
@@ -276,10 +290,10 @@ private:
                      std::vector<std::size_t>&& strides_in,
                      bool use_strides);
 
-    void CheckArgsAndInit(bool use_strides);
+    void CheckArgsAndInit(Shape& new_shape, bool use_strides);
+    const Shape& GetShape() const;
 
-    std::vector<std::size_t> lens;
-    std::vector<std::size_t> strides;
+    std::shared_ptr<const Shape> shape;
 
     bool packed;
     std::size_t vector_length = 1;
@@ -295,9 +309,6 @@ private:
     // For GetLayout_str()
     mutable std::string cached_layout_str;
 
-    // For GetLayout
-    mutable std::vector<int64_t> cached_permutation;
-
     // For AllLengthsFitIntoInt()
     mutable std::optional<bool> cached_lengths_fit_into_int;
     // For AllDimsFitIntoInt()
@@ -0,0 +1,207 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_TUNING_QUEUE_HPP_
+#define GUARD_MIOPEN_TUNING_QUEUE_HPP_
+
+#include <miopen/config.hpp>
+#include <miopen/filesystem.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace miopen {
+
+class LockFile;
+
+namespace solver {
+
+/// Search of a solver for a problem among the configs whose index in the enumeration order
+/// modulo `n_shards` is `shard`.
+struct TuningWorkItem
+{
+    std::string key;     // The perf-db key of the problem.
+    std::string solver;  // The perf-db id of the solver.
+    std::string problem; // Serialized, see conv/tuning_work.hpp.
+    std::size_t shard    = 0;
+    std::size_t n_shards = 1;
+};
+
+struct TuningResult
+{
+    std::string config; // Serialized.
+    float time = 0.0f;
+};
+
+/// Restricts GenericSearch to a slice of the configs and receives the fastest one of them.
+/// To be set via ExecutionContext::tuning_shard by the TuningFunction of a worker.
+struct TuningShard
+{
+    std::size_t index = 0;
+    std::size_t count = 1;
+    std::optional<TuningResult> result;
+};
+
+/// Splits the search of the item into `n_shards` work items.
+MIOPEN_INTERNALS_EXPORT std::vector<TuningWorkItem> ShardTuningWork(const TuningWorkItem& item,
+                                                                    std::size_t n_shards);
+
+/// Work queue shared by the tuning processes of a machine.
+///
+/// The coordinator posts the items and starts the workers (see RunTuningWorker), which may run
+/// on different GPUs. Then it waits for the workers (see WaitForTuning) and merges the results
+/// into the perf-db (see MergeTuningResults). The tunenet tool does this for convolutions, see
+/// conv/tuning_work.hpp.
+///
+/// The queue is a text file rewritten under the lock file on each operation, so any process may
+/// be killed at any time. A claimed item is leased to the worker, which renews the lease while
+/// the item is being tuned. Once the lease expires, the item is given to another worker, unless
+/// it has been claimed `max_attempts` times already, in which case it fails.
+class MIOPEN_INTERNALS_EXPORT TuningQueue
+{
+public:
+    enum class State
+    {
+        Pending,
+        Claimed,
+        Done,
+        Failed,
+    };
+
+    struct Entry
+    {
+        std::size_t id = 0;
+        TuningWorkItem item;
+        State state           = State::Pending;
+        std::size_t attempts  = 0;
+        std::string worker;         // The last one to claim the item.
+        std::int64_t lease_end = 0; // Milliseconds since the epoch.
+        std::optional<TuningResult> result;
+    };
+
+    struct Counts
+    {
+        std::size_t pending = 0;
+        std::size_t claimed = 0;
+        std::size_t done    = 0;
+        std::size_t failed  = 0;
+
+        bool IsFinished() const { return pending == 0 && claimed == 0; }
+    };
+
+    TuningQueue(const fs::path& path_,
+                std::chrono::milliseconds lease_ = std::chrono::minutes{1},
+                std::size_t max_attempts_        = 3);
+
+    const fs::path& GetPath() const { return path; }
+    std::chrono::milliseconds GetLease() const { return lease; }
+
+    void Post(const std::vector<TuningWorkItem>& items);
+    /// Returns nullopt if no item is pending.
+    std::optional<Entry> Claim(const std::string& worker);
+    /// Returns false if the item is no longer leased to the worker.
+    bool Renew(std::size_t id, const std::string& worker);
+    /// The result is nullopt if the search has found nothing. Late results are accepted as long
+    /// as no other worker has completed the item. Returns false otherwise.
+    bool Complete(std::size_t id, const std::optional<TuningResult>& result);
+    /// Gives the item back to the queue, e.g. after an error.
+    void Abandon(std::size_t id, const std::string& worker);
+    /// Requeues the items whose leases have expired.
+    Counts Reclaim();
+
+    std::vector<Entry> GetEntries() const;
+    /// Entries with the fastest results by the problem key and the solver.
+    std::map<std::pair<std::string, std::string>, Entry> GetBestResults() const;
+
+private:
+    fs::path path;
+    LockFile& lock_file;
+    std::chrono::milliseconds lease;
+    std::size_t max_attempts;
+
+    template <class TFunc>
+    auto Modify(TFunc&& func);
+    std::vector<Entry> LoadUnsafe() const;
+    void SaveUnsafe(const std::vector<Entry>& entries) const;
+    void ReclaimUnsafe(std::vector<Entry>& entries) const;
+};
+
+using TuningFunction = std::function<std::optional<TuningResult>(const TuningWorkItem&)>;
+
+/// Claims and tunes the items until none is pending or claimed. Returns the number of the items
+/// tuned by the worker. On a GPU, the function is conv::Tune().
+MIOPEN_INTERNALS_EXPORT std::size_t
+RunTuningWorker(TuningQueue& queue,
+                const std::string& worker,
+                const TuningFunction& tune,
+                std::chrono::milliseconds poll_period = std::chrono::seconds{1});
+
+/// Waits until all the items of the queue are done or failed. Returns false on timeout.
+MIOPEN_INTERNALS_EXPORT bool
+WaitForTuning(TuningQueue& queue,
+              std::chrono::milliseconds timeout,
+              std::chrono::milliseconds poll_period = std::chrono::seconds{1});
+
+namespace detail {
+
+struct SerializedValues
+{
+    const std::string& values;
+
+    void Serialize(std::ostream& stream) const { stream << values; }
+};
+
+} // namespace detail
+
+/// Stores the fastest config found for each problem and solver in the db. `make_problem` turns
+/// an item into the problem config which the db is keyed by. Returns the number of the records
+/// updated.
+template <class Db, class TMakeProblem>
+std::size_t MergeTuningResults(const TuningQueue& queue, Db& db, const TMakeProblem& make_problem)
+{
+    std::size_t n_updated = 0;
+    for(const auto& best : queue.GetBestResults())
+    {
+        const auto& entry = best.second;
+        if(db.Update(make_problem(entry.item),
+                     entry.item.solver,
+                     detail::SerializedValues{entry.result->config}))
+            ++n_updated;
+    }
+    return n_updated;
+}
+
+} // namespace solver
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_TUNING_QUEUE_HPP_
@@ -0,0 +1,78 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_WORKER_POOL_HPP_
+#define GUARD_MIOPEN_WORKER_POOL_HPP_
+
+#include <miopen/config.hpp>
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace miopen {
+
+/// Fixed set of threads which run the iterations of ParallelFor() calls. Unlike par_for(), does
+/// not start threads on each call, so it suits many short loops, e.g. over the solvers.
+class MIOPEN_INTERNALS_EXPORT WorkerPool
+{
+public:
+    explicit WorkerPool(std::size_t n_threads);
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    /// Calls f(i) for each i in [0, n) and waits for all the calls. The calling thread runs
+    /// iterations too, so nested calls from the workers do not deadlock. The first exception
+    /// thrown by f is rethrown after all the other iterations are finished.
+    void ParallelFor(std::size_t n, const std::function<void(std::size_t)>& f);
+
+    std::size_t GetThreadCount() const { return threads.size(); }
+
+private:
+    struct Job;
+
+    void Work();
+    static void Run(Job& job);
+
+    std::mutex mutex;
+    std::condition_variable has_jobs;
+    std::deque<std::shared_ptr<Job>> jobs;
+    bool stop = false;
+    std::vector<std::thread> threads;
+};
+
+/// Process-wide pool with a thread per hardware thread, except the calling one.
+MIOPEN_INTERNALS_EXPORT WorkerPool& GetWorkerPool();
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_WORKER_POOL_HPP_
@@ -50,14 +50,21 @@ std::optional<Invoker> InvokerCache::GetFound1_0(const std::string& network_conf
         MIOPEN_LOG_I2("No invokers found for " << network_config);
         return std::nullopt;
     }
-    if(item->second.found_1_0.empty())
+    return GetFound1_0(item->second, network_config, algorithm);
+}
+
+std::optional<Invoker> InvokerCache::GetFound1_0(const Item& item,
+                                                 const std::string& network_config,
+                                                 const std::string& algorithm)
+{
+    if(item.found_1_0.empty())
     {
         MIOPEN_LOG_I2("Invokers found for " << network_config
                                             << " but there is no find 1.0 result.");
         return std::nullopt;
     }
-    const auto& item_invokers = item->second.invokers;
-    const auto& found_1_0_ids = item->second.found_1_0;
+    const auto& item_invokers = item.invokers;
+    const auto& found_1_0_ids = item.found_1_0;
     const auto found_1_0_id   = found_1_0_ids.find(algorithm);
     if(found_1_0_id == found_1_0_ids.end())
     {
@@ -100,6 +107,54 @@ std::optional<std::string> InvokerCache::GetFound1_0SolverId(const std::string&
     return found_1_0_id->second;
 }
 
+const InvokerCache::Item* InvokerCache::Find(const conv::ProblemKey& problem) const
+{
+    const auto known = by_key.find(problem);
+    if(known != by_key.end())
+        return known->second;
+
+    // Invokers may have been registered by the network config, so the first lookup has to
+    // build it. Misses are not remembered, since the invoker may be registered later.
+    const auto item = invokers.find(problem.ToString());
+    if(item == invokers.end())
+        return nullptr;
+    by_key.emplace(problem, &item->second);
+    return &item->second;
+}
+
+std::optional<Invoker> InvokerCache::Get(const conv::ProblemKey& problem,
+                                         const std::string& solver_id) const
+{
+    const auto item = Find(problem);
+    if(item == nullptr)
+        return std::nullopt;
+    const auto invoker = item->invokers.find(solver_id);
+    if(invoker == item->invokers.end())
+        return std::nullopt;
+    return invoker->second;
+}
+
+std::optional<Invoker> InvokerCache::GetFound1_0(const conv::ProblemKey& problem,
+                                                 const std::string& algorithm) const
+{
+    const auto item = Find(problem);
+    if(item == nullptr)
+    {
+        MIOPEN_LOG_I2("No invokers found for " << problem.ToString());
+        return std::nullopt;
+    }
+    // The network config is only built for the messages, so it is not built on a hit.
+    const auto& found_1_0_ids = item->found_1_0;
+    const auto found_1_0_id   = found_1_0_ids.find(algorithm);
+    if(found_1_0_id != found_1_0_ids.end())
+    {
+        const auto invoker = item->invokers.find(found_1_0_id->second);
+        if(invoker != item->invokers.end())
+            return invoker->second;
+    }
+    return GetFound1_0(*item, problem.ToString(), algorithm);
+}
+
 void InvokerCache::Register(const Key& key, const Invoker& invoker)
 {
     auto it = invokers.find(key.first);
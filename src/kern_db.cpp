@@ -25,8 +25,119 @@
  *******************************************************************************/
 #include "miopen/bz2.hpp"
 #include <miopen/kern_db.hpp>
+#include <miopen/env.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_CACHE_SIZE_LIMIT_MB, 0)
 
 namespace miopen {
+
+namespace {
+
+std::vector<std::string> SplitArgs(const std::string& args)
+{
+    auto tokens = std::vector<std::string>{};
+    auto token  = std::string{};
+    char quote  = 0;
+
+    for(const auto c : args)
+    {
+        if(quote != 0)
+        {
+            token += c;
+            if(c == quote)
+                quote = 0;
+        }
+        else if(c == '"' || c == '\'')
+        {
+            token += c;
+            quote = c;
+        }
+        else if(std::isspace(static_cast<unsigned char>(c)) != 0)
+        {
+            if(!token.empty())
+                tokens.push_back(std::move(token));
+            token.clear();
+        }
+        else
+        {
+            token += c;
+        }
+    }
+
+    if(!token.empty())
+        tokens.push_back(std::move(token));
+    return tokens;
+}
+
+bool IsDefine(const std::string& token) { return token.size() > 2 && token.rfind("-D", 0) == 0; }
+
+std::string GetMacroName(const std::string& define)
+{
+    return define.substr(2, define.find('=') - 2);
+}
+
+/// Args to look the kernel up with: the normalized ones and then the original ones, if they differ.
+std::vector<std::string> GetLookupArgs(const std::string& args)
+{
+    auto normalized = NormalizeKernelArgs(args);
+    if(normalized == args)
+        return {std::move(normalized)};
+    return {std::move(normalized), args};
+}
+
+} // namespace
+
+std::string NormalizeKernelArgs(const std::string& args)
+{
+    auto tokens = std::vector<std::string>{};
+    auto split  = SplitArgs(args);
+
+    for(std::size_t i = 0; i < split.size(); ++i)
+    {
+        if(split[i] == "-D" && i + 1 < split.size())
+            tokens.push_back("-D" + split[++i]);
+        else
+            tokens.push_back(std::move(split[i]));
+    }
+
+    auto positions = std::vector<std::size_t>{};
+    auto defines   = std::vector<std::string>{};
+    auto names     = std::set<std::string>{};
+    auto reorder   = true;
+
+    for(std::size_t i = 0; i < tokens.size() && reorder; ++i)
+    {
+        if(tokens[i].rfind("-U", 0) == 0)
+            reorder = false;
+        else if(IsDefine(tokens[i]))
+        {
+            reorder = names.insert(GetMacroName(tokens[i])).second;
+            positions.push_back(i);
+            defines.push_back(tokens[i]);
+        }
+    }
+
+    if(reorder)
+    {
+        std::sort(defines.begin(), defines.end());
+        for(std::size_t i = 0; i < positions.size(); ++i)
+            tokens[positions[i]] = std::move(defines[i]);
+    }
+
+    return JoinStrings(tokens, " ");
+}
+
 KernDb::KernDb(DbKinds db_kind, const fs::path& filename_, bool is_system_)
     : KernDb(db_kind, filename_, is_system_, compress, decompress)
 {
@@ -55,9 +166,21 @@ KernDb::KernDb(
     }
     if(!is_system)
     {
-        const std::string create_table = KernelConfig::CreateQuery();
-        sql.Exec(create_table);
-        MIOPEN_LOG_I2("Database created successfully");
+        const auto tables = sql.Exec("SELECT name FROM sqlite_master WHERE type = 'table';");
+        // Lets CompactUnsafe() shrink new dbs in place. The file header may already have been
+        // written when the journal mode was set, so VACUUM is needed for the mode to apply.
+        if(tables.empty())
+            sql.Exec("PRAGMA auto_vacuum = INCREMENTAL; VACUUM;");
+        // Dbs with binaries inline are kept in their layout.
+        const auto has_table = std::any_of(tables.begin(), tables.end(), [](const auto& row) {
+            return row.at("name") == KernelConfig::table_name();
+        });
+        if(!has_table)
+        {
+            const std::string create_table = KernelConfig::CreateQuery();
+            sql.Exec(create_table);
+            MIOPEN_LOG_I2("Database created successfully");
+        }
     }
     if(!CheckTableColumns(KernelConfig::table_name(), KernelConfig::FieldNames()))
     {
@@ -66,6 +189,407 @@ KernDb::KernDb(
            << filename;
         MIOPEN_LOG_W(ss.str());
         dbInvalid = true;
+        return;
+    }
+    has_blob_table = !CheckTableColumns(KernelConfig::table_name(), {"kernel_blob"});
+    if(has_blob_table && !CheckTableColumns(KernelConfig::blob_table_name(),
+                                            {"kernel_hash", "kernel_blob", "uncompressed_size"}))
+    {
+        MIOPEN_LOG_W("Invalid fields in table: " << KernelConfig::blob_table_name()
+                                                 << " disabling access to " << filename);
+        dbInvalid = true;
+        return;
+    }
+    if(!is_system)
+        UpgradeSchemaUnsafe();
+}
+
+KernDb& KernDb::GetCached(DbKinds db_kind, const fs::path& path, bool is_system)
+{
+    // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+    static std::mutex mutex;
+    const std::lock_guard<std::mutex> lock{mutex};
+
+    // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+    static auto instances = std::map<std::pair<fs::path, bool>, std::unique_ptr<KernDb>>{};
+    auto& instance        = instances[{path, is_system}];
+
+    if(!instance)
+        instance = std::make_unique<KernDb>(db_kind, path, is_system);
+    return *instance;
+}
+
+boost::optional<std::vector<char>> KernDb::FindRecordUnsafe(const KernelConfig& problem_config)
+{
+    if(filename.empty())
+        return boost::none;
+
+    for(const auto& args : GetLookupArgs(problem_config.kernel_args))
+    {
+        auto blob = FindBlobUnsafe(problem_config.kernel_name, args);
+        if(blob)
+            return blob;
+    }
+
+    return boost::none;
+}
+
+boost::optional<std::vector<char>> KernDb::FindBlobUnsafe(const fs::path& kernel_name,
+                                                          const std::string& kernel_args)
+{
+    const auto table = KernelConfig::table_name();
+    const auto select_query =
+        has_blob_table
+            ? "SELECT b.kernel_blob, k.kernel_hash, b.uncompressed_size, k.id FROM " + table +
+                  " AS k JOIN " + KernelConfig::blob_table_name() +
+                  " AS b ON b.kernel_hash = k.kernel_hash"
+                  " WHERE (k.kernel_name = ?) AND (k.kernel_args = ?);"
+            : "SELECT kernel_blob, kernel_hash, uncompressed_size, id FROM " + table +
+                  " WHERE (kernel_name = ?) AND (kernel_args = ?);";
+    auto stmt = SQLite::Statement{sql, select_query};
+    stmt.BindPath(1, kernel_name);
+    stmt.BindText(2, kernel_args);
+
+    // only one result field
+    // assert one row
+    auto rc = stmt.Step(sql);
+    if(rc == SQLITE_DONE)
+        return boost::none;
+    if(rc != SQLITE_ROW)
+        MIOPEN_THROW(miopenStatusInternalError, sql.ErrorMessage());
+
+    auto compressed_blob                 = stmt.ColumnBlob(0);
+    auto md5_hash                        = stmt.ColumnText(1);
+    auto uncompressed_size               = stmt.ColumnInt64(2);
+    std::vector<char>& decompressed_blob = compressed_blob;
+    if(uncompressed_size != 0)
+    {
+        decompressed_blob = decompress_fn(compressed_blob, uncompressed_size);
+    }
+    auto new_md5 = md5(decompressed_blob);
+    if(new_md5 != md5_hash)
+        MIOPEN_THROW(miopenStatusInternalError, "Possible database corruption");
+    // Access times are only needed for eviction, which is off without a size limit. Recording
+    // them would turn every cache hit into a write.
+    if(has_access_time && env::value(MIOPEN_CACHE_SIZE_LIMIT_MB) != 0)
+        TouchUnsafe(stmt.ColumnInt64(3));
+    return decompressed_blob;
+}
+
+bool KernDb::StoreRecordUnsafe(const KernelConfig& problem_config)
+{
+    if(filename.empty())
+        return false;
+
+    const auto table       = KernelConfig::table_name();
+    const auto kernel_args = NormalizeKernelArgs(problem_config.kernel_args);
+    const auto md5_sum     = md5(problem_config.kernel_blob);
+
+    if(!has_blob_table)
+    {
+        auto insert_query = has_access_time
+                                ? "INSERT OR REPLACE INTO " + table +
+                                      "(kernel_name, kernel_args, kernel_blob, kernel_hash, "
+                                      "uncompressed_size, last_access) VALUES(?, ?, ?, ?, ?, ?);"
+                                : "INSERT OR REPLACE INTO " + table +
+                                      "(kernel_name, kernel_args, kernel_blob, kernel_hash, "
+                                      "uncompressed_size) VALUES(?, ?, ?, ?, ?);";
+        auto uncompressed_size = problem_config.kernel_blob.size();
+        bool success           = false;
+        auto compressed_blob   = compress_fn(problem_config.kernel_blob, &success);
+        auto stmt              = SQLite::Statement{sql, insert_query};
+        stmt.BindPath(1, problem_config.kernel_name);
+        stmt.BindText(2, kernel_args);
+        if(!success)
+        {
+            stmt.BindBlob(3, problem_config.kernel_blob);
+            stmt.BindInt64(5, 0);
+        }
+        else
+        {
+            stmt.BindBlob(3, compressed_blob);
+            stmt.BindInt64(5, uncompressed_size);
+        }
+        stmt.BindText(4, md5_sum);
+        if(has_access_time)
+            stmt.BindInt64(6, Now());
+
+        auto rc = stmt.Step(sql);
+        if(rc != SQLITE_DONE)
+            MIOPEN_THROW(miopenStatusInternalError, sql.ErrorMessage());
+        return true;
+    }
+
+    TransactionUnsafe([&]() {
+        auto previous = SQLite::Statement{
+            sql,
+            "SELECT kernel_hash FROM " + table + " WHERE (kernel_name = ?) AND (kernel_args = ?);"};
+        previous.BindPath(1, problem_config.kernel_name);
+        previous.BindText(2, kernel_args);
+        const auto previous_hash =
+            previous.Step(sql) == SQLITE_ROW ? previous.ColumnText(0) : std::string{};
+        previous = {};
+
+        // Binaries shared by several kernels are compressed and written only once.
+        if(!BlobExistsUnsafe(md5_sum))
+            StoreBlobUnsafe(md5_sum, problem_config.kernel_blob);
+
+        auto stmt = SQLite::Statement{sql,
+                                      "INSERT OR REPLACE INTO " + table +
+                                          "(kernel_name, kernel_args, kernel_hash, last_access) "
+                                          "VALUES(?, ?, ?, ?);"};
+        stmt.BindPath(1, problem_config.kernel_name);
+        stmt.BindText(2, kernel_args);
+        stmt.BindText(3, md5_sum);
+        stmt.BindInt64(4, Now());
+        if(stmt.Step(sql) != SQLITE_DONE)
+            MIOPEN_THROW(miopenStatusInternalError, sql.ErrorMessage());
+
+        if(!previous_hash.empty() && previous_hash != md5_sum)
+            RemoveUnusedBlobUnsafe(previous_hash);
+    });
+    return true;
+}
+
+bool KernDb::RemoveRecordUnsafe(const KernelConfig& problem_config)
+{
+    if(filename.empty())
+        return true;
+
+    const auto remove = [&]() {
+        for(const auto& args : GetLookupArgs(problem_config.kernel_args))
+        {
+            auto stmt = SQLite::Statement{sql,
+                                          "DELETE FROM " + KernelConfig::table_name() +
+                                              " WHERE (kernel_name = ?) AND (kernel_args = ?);"};
+            stmt.BindPath(1, problem_config.kernel_name);
+            stmt.BindText(2, args);
+            if(stmt.Step(sql) != SQLITE_DONE)
+                MIOPEN_THROW(miopenStatusInternalError, sql.ErrorMessage());
+        }
+    };
+
+    if(!has_blob_table)
+    {
+        remove();
+        return true;
+    }
+
+    TransactionUnsafe([&]() {
+        remove();
+        RemoveUnusedBlobsUnsafe();
+    });
+    return true;
+}
+
+bool KernDb::BlobExistsUnsafe(const std::string& hash)
+{
+    auto stmt = SQLite::Statement{
+        sql, "SELECT 1 FROM " + KernelConfig::blob_table_name() + " WHERE kernel_hash = ?;"};
+    stmt.BindText(1, hash);
+
+    const auto rc = stmt.Step(sql);
+    if(rc != SQLITE_ROW && rc != SQLITE_DONE)
+        MIOPEN_THROW(miopenStatusInternalError, sql.ErrorMessage());
+    return rc == SQLITE_ROW;
+}
+
+void KernDb::StoreBlobUnsafe(const std::string& hash, const std::vector<char>& blob)
+{
+    bool success         = false;
+    auto compressed_blob = compress_fn(blob, &success);
+    auto stmt            = SQLite::Statement{sql,
+                                  "INSERT OR IGNORE INTO " + KernelConfig::blob_table_name() +
+                                      "(kernel_hash, kernel_blob, uncompressed_size) "
+                                      "VALUES(?, ?, ?);"};
+    stmt.BindText(1, hash);
+    stmt.BindBlob(2, success ? compressed_blob : blob);
+    stmt.BindInt64(3, success ? blob.size() : 0);
+
+    if(stmt.Step(sql) != SQLITE_DONE)
+        MIOPEN_THROW(miopenStatusInternalError, sql.ErrorMessage());
+}
+
+void KernDb::RemoveUnusedBlobsUnsafe()
+{
+    const auto blobs = KernelConfig::blob_table_name();
+    sql.Exec("DELETE FROM " + blobs + " WHERE NOT EXISTS (SELECT 1 FROM " +
+             KernelConfig::table_name() + " AS k WHERE k.kernel_hash = " + blobs +
+             ".kernel_hash);");
+}
+
+void KernDb::RemoveUnusedBlobUnsafe(const std::string& hash)
+{
+    const auto table = KernelConfig::table_name();
+    auto stmt        = SQLite::Statement{
+        sql,
+        "DELETE FROM " + KernelConfig::blob_table_name() +
+            " WHERE kernel_hash = ? AND NOT EXISTS (SELECT 1 FROM " + table +
+            " WHERE kernel_hash = ?);"};
+    stmt.BindText(1, hash);
+    stmt.BindText(2, hash);
+
+    if(stmt.Step(sql) != SQLITE_DONE)
+        MIOPEN_THROW(miopenStatusInternalError, sql.ErrorMessage());
+}
+
+void KernDb::UpgradeSchemaUnsafe()
+{
+    const auto table = KernelConfig::table_name();
+
+    try
+    {
+        if(!CheckTableColumns(table, {"last_access"}))
+        {
+            MIOPEN_LOG_I("Adding access times to " << filename);
+            sql.Exec("ALTER TABLE " + table + " ADD COLUMN last_access INT NOT NULL DEFAULT 0;");
+        }
+        sql.Exec("CREATE INDEX IF NOT EXISTS `idx_" + table + "_last_access` ON " + table +
+                 "(last_access);");
+        has_access_time = true;
+    }
+    catch(const Exception& ex)
+    {
+        // Another process may have upgraded the db meanwhile.
+        has_access_time = CheckTableColumns(table, {"last_access"});
+        if(!has_access_time)
+            MIOPEN_LOG_W("Unable to record kernel access times in " << filename << ": "
+                                                                    << ex.what());
+    }
+}
+
+std::int64_t KernDb::Now()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+               std::chrono::system_clock::now().time_since_epoch())
+        .count();
+}
+
+void KernDb::TouchUnsafe(std::int64_t id)
+{
+    auto stmt = SQLite::Statement{
+        sql, "UPDATE " + KernelConfig::table_name() + " SET last_access = ? WHERE id = ?;"};
+    stmt.BindInt64(1, Now());
+    stmt.BindInt64(2, id);
+
+    // A failure to record the access must not fail the lookup.
+    if(stmt.Step(sql) != SQLITE_DONE)
+        MIOPEN_LOG_W("Unable to record kernel access time: " << sql.ErrorMessage());
+}
+
+std::uint64_t KernDb::GetUsedBytesUnsafe()
+{
+    if(filename.empty() || dbInvalid)
+        return 0;
+
+    const auto pragma = [&](const std::string& name) {
+        const auto res = sql.Exec("PRAGMA " + name + ";");
+        return res.empty() ? std::uint64_t{0} : std::stoull(res[0].at(name));
+    };
+
+    const auto pages = pragma("page_count");
+    const auto free  = pragma("freelist_count");
+    return (pages > free ? pages - free : 0) * pragma("page_size");
+}
+
+KernDb::EvictionStats KernDb::EvictUnsafe(std::uint64_t quota)
+{
+    auto stats = EvictionStats{};
+
+    if(quota == 0 || !has_access_time)
+        return stats;
+
+    const auto used = GetUsedBytesUnsafe();
+    if(used <= quota)
+        return stats;
+
+    const auto target = quota / 10 * 9;
+    const auto table  = KernelConfig::table_name();
+    auto victims      = std::vector<std::int64_t>{};
+    auto counted      = std::set<std::string>{};
+    auto estimate     = std::uint64_t{0};
+    // Binaries shared with the kernels which stay are not freed, so the estimate may be too
+    // optimistic. That only leaves the db above the target until the next eviction.
+    const auto query = has_blob_table
+                           ? "SELECT k.id, k.kernel_hash, length(b.kernel_blob) FROM " + table +
+                                 " AS k LEFT JOIN " + KernelConfig::blob_table_name() +
+                                 " AS b ON b.kernel_hash = k.kernel_hash"
+                                 " ORDER BY k.last_access, k.id;"
+                           : "SELECT id, kernel_hash, length(kernel_blob) FROM " + table +
+                                 " ORDER BY last_access, id;";
+    auto stmt = SQLite::Statement{sql, query};
+
+    while(used - estimate > target)
+    {
+        const auto rc = stmt.Step(sql);
+        if(rc == SQLITE_DONE)
+            break;
+        if(rc != SQLITE_ROW)
+            MIOPEN_THROW(miopenStatusInternalError, sql.ErrorMessage());
+
+        victims.push_back(stmt.ColumnInt64(0));
+        if(!has_blob_table || counted.insert(stmt.ColumnText(1)).second)
+            estimate += stmt.ColumnInt64(2);
+    }
+
+    // Release the read cursor before modifying the table.
+    stmt = {};
+
+    TransactionUnsafe([&]() {
+        for(const auto id : victims)
+        {
+            auto remove = SQLite::Statement{sql, "DELETE FROM " + table + " WHERE id = ?;"};
+            remove.BindInt64(1, id);
+            if(remove.Step(sql) != SQLITE_DONE)
+                MIOPEN_THROW(miopenStatusInternalError, sql.ErrorMessage());
+            stats.records += sql.Changes();
+        }
+        if(has_blob_table)
+            RemoveUnusedBlobsUnsafe();
+    });
+
+    const auto remaining = GetUsedBytesUnsafe();
+    stats.bytes          = used > remaining ? used - remaining : 0;
+
+    MIOPEN_LOG_I("Evicted " << stats.records << " kernels (" << stats.bytes << " bytes) from "
+                            << filename << ", quota: " << quota << " bytes");
+
+    CompactUnsafe();
+    return stats;
+}
+
+bool KernDb::CompactUnsafe()
+{
+    if(filename.empty() || dbInvalid || is_system)
+        return false;
+
+    try
+    {
+        const auto res         = sql.Exec("PRAGMA auto_vacuum;");
+        const auto incremental = !res.empty() && res[0].at("auto_vacuum") == "2";
+
+        if(incremental)
+        {
+            sql.Exec("PRAGMA incremental_vacuum;");
+            return true;
+        }
+
+        const auto pages = std::stoull(sql.Exec("PRAGMA page_count;").at(0).at("page_count"));
+        const auto free =
+            std::stoull(sql.Exec("PRAGMA freelist_count;").at(0).at("freelist_count"));
+
+        if(free * 4 < pages)
+            return false;
+
+        MIOPEN_LOG_I("Vacuuming " << filename << ", free pages: " << free << "/" << pages);
+        sql.Exec("VACUUM;");
+        return true;
+    }
+    catch(const Exception& ex)
+    {
+        // E.g. if another process holds the db. The free pages are reused by later stores anyway.
+        MIOPEN_LOG_W("Unable to compact " << filename << ": " << ex.what());
+        return false;
     }
 }
 
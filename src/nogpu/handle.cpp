@@ -28,12 +28,14 @@
 #include <miopen/config.h>
 #include <miopen/handle.hpp>
 #include <miopen/binary_cache.hpp>
+#include <miopen/compile_registry.hpp>
 #include <miopen/target_properties.hpp>
 #include <miopen/errors.hpp>
 #include <miopen/handle_lock.hpp>
 #include <miopen/invoker.hpp>
 #include <miopen/kernel_cache.hpp>
 #include <miopen/logger.hpp>
+#include <miopen/ramdb.hpp>
 #include <miopen/timer.hpp>
 #include <miopen/hipoc_program.hpp>
 
@@ -69,7 +71,7 @@ Handle::Handle() : impl(new HandleImpl())
     MIOPEN_LOG_NQI(*this);
 }
 
-Handle::~Handle() {}
+Handle::~Handle() { RamDb::FlushAll(); }
 
 void Handle::SetStream(miopenAcceleratorQueue_t /* streamID */) const {}
 
@@ -199,26 +201,49 @@ Program Handle::LoadProgram(const fs::path& program_name,
     p.impl           = pgmImpl;
     if(hsaco.empty())
     {
-        // avoid the constructor since it implicitly calls the HIP API
-        pgmImpl->BuildCodeObject(params, kernel_src);
-// auto p = HIPOCProgram{program_name, params, this->GetTargetProperties(), kernel_src};
+        // Threads and handles which need the same program at the same time build it only once.
+        auto built_here   = false;
+        const auto binary = GetCompileRegistry().GetOrBuild(
+            CompileRegistry::MakeKey(program_name, params, this->GetTargetProperties(), kernel_src),
+            [&]() {
+                built_here = true;
+                // avoid the constructor since it implicitly calls the HIP API
+                pgmImpl->BuildCodeObject(params, kernel_src);
+
+                auto code_object = p.IsCodeObjectInMemory()
+                                       ? p.GetCodeObjectBlob()
+                                       : miopen::LoadFile(p.GetCodeObjectPathname());
 
 // Save to cache
 #if MIOPEN_ENABLE_SQLITE_KERN_CACHE
-        miopen::SaveBinary(p.IsCodeObjectInMemory() ? p.GetCodeObjectBlob()
-                                                    : miopen::LoadFile(p.GetCodeObjectPathname()),
-                           this->GetTargetProperties(),
-                           this->GetMaxComputeUnits(),
-                           program_name,
-                           params);
+                miopen::SaveBinary(code_object,
+                                   this->GetTargetProperties(),
+                                   this->GetMaxComputeUnits(),
+                                   program_name,
+                                   params);
 #else
-        auto path = miopen::GetCachePath(false) / boost::filesystem::unique_path().string();
-        if(p.IsCodeObjectInMemory())
-            miopen::WriteFile(p.GetCodeObjectBlob(), path);
-        else
-            fs::copy_file(p.GetCodeObjectPathname(), path);
-        miopen::SaveBinary(path, GetTargetProperties(), program_name, params);
+                auto path =
+                    miopen::GetCachePath(false) / boost::filesystem::unique_path().string();
+                miopen::WriteFile(code_object, path);
+                miopen::SaveBinary(path, GetTargetProperties(), program_name, params);
 #endif
+                return code_object;
+            },
+            [&]() {
+                // Another caller may have finished and cached this program meanwhile.
+#if MIOPEN_ENABLE_SQLITE_KERN_CACHE
+                return miopen::LoadBinary(
+                    GetTargetProperties(), GetMaxComputeUnits(), program_name, params);
+#else
+                const auto path = miopen::LoadBinary(
+                    GetTargetProperties(), GetMaxComputeUnits(), program_name, params);
+                return path.empty() ? CompileRegistry::Binary{} : miopen::LoadFile(path);
+#endif
+            });
+
+        // Built by a concurrent call or found in the binary cache.
+        if(!built_here)
+            pgmImpl->binary = binary;
     }
     else
     {
@@ -282,6 +307,8 @@ std::ostream& Handle::Print(std::ostream& os) const
     return os;
 }
 
+void Handle::SetCurrentDevice() const {}
+
 shared<Data_t> Handle::CreateSubBuffer(Data_t data, std::size_t offset, std::size_t) const
 {
     auto cdata = reinterpret_cast<char*>(data);
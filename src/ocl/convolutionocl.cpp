@@ -41,6 +41,7 @@
 #include <miopen/invoker.hpp>
 #include <miopen/kernel.hpp>
 #include <miopen/solution.hpp>
+#include <miopen/solver_applicability_cache.hpp>
 #include <miopen/tensor_ops.hpp>
 #include <miopen/tensor.hpp>
 #include <miopen/util.hpp>
@@ -104,11 +105,11 @@ Invoker LoadOrPrepareInvoker(const ExecutionContext& ctx,
                              solver::Id solver_id)
 {
     const auto& handle = ctx.GetStream();
-    const auto config  = problem.MakeNetworkConfig();
-    auto invoker       = handle.GetInvoker(config, solver_id);
+    const auto key     = problem.MakeKey();
+    auto invoker       = handle.GetInvoker(key, solver_id);
     if(invoker)
         return *invoker;
-    return PrepareInvoker(ctx, problem, config, solver_id);
+    return PrepareInvoker(ctx, problem, NetworkConfig{key.ToString()}, solver_id);
 }
 
 static void
@@ -482,8 +483,7 @@ void ConvolutionDescriptor::ConvolutionForward(Handle& handle,
 
         const auto algorithm_name = AlgorithmName{ConvolutionAlgoToDirectionalString(
             static_cast<miopenConvAlgorithm_t>(algo), conv::Direction::Forward)};
-        const auto network_config = problem.MakeNetworkConfig();
-        const auto& invoker       = handle.GetInvoker(network_config, {}, algorithm_name);
+        const auto& invoker = handle.GetInvoker(problem.MakeKey(), {}, algorithm_name);
 
         if(invoker)
         {
@@ -598,12 +598,15 @@ ConvolutionDescriptor::GetSolutionsFallback(const ExecutionContext& ctx,
     auto interim = std::vector<miopenConvSolution_t>{};
     interim.reserve(maxSolutionCount); // For speed. In most cases we have less entries than asked.
 
+    // Frameworks with dynamic shapes may get here on each call, so let's not repeat the checks.
+    const auto record = solver::GetApplicabilityRecord(ctx, problem);
+
     // TunaNet Fallback
 #if MIOPEN_ENABLE_AI_IMMED_MODE_FALLBACK
     if(!env::disabled(MIOPEN_DEBUG_ENABLE_AI_IMMED_MODE_FALLBACK))
     {
-        const static std::string arch = ctx.GetStream().GetDeviceName();
-        auto solvers                  = ai::immed_mode::PredictSolver(problem, ctx, arch);
+        const auto arch = ctx.GetStream().GetDeviceName();
+        auto solvers    = ai::immed_mode::PredictSolver(problem, ctx, arch);
         if(!solvers.empty())
         {
             MIOPEN_LOG_I2("Using TunaNet Fallback");
@@ -620,9 +623,10 @@ ConvolutionDescriptor::GetSolutionsFallback(const ExecutionContext& ctx,
                     continue;
                 if(!sol.IsDynamic())
                     continue; // branch should never be taken
-                if(!sol.IsApplicable(ctx, problem))
+                if(!solver::CachedIsApplicable(record.get(), solver_id, sol, ctx, problem))
                     continue;
-                const auto ws = sol.GetWorkspaceSize(ctx, problem);
+                const auto ws =
+                    solver::CachedGetWorkspaceSize(record.get(), solver_id, sol, ctx, problem);
                 if(!conv::IsEnoughWorkspace("GetSolutionsFallback AI", solver_id, ws, invokeParams))
                     continue;
                 interim.emplace_back(
@@ -654,13 +658,15 @@ ConvolutionDescriptor::GetSolutionsFallback(const ExecutionContext& ctx,
                 continue;
             const auto& s = solver_id.GetSolver();
             // Let's allow non-dynamic later, if necessary.
-            if(s.IsEmpty() || !s.IsDynamic() || !s.IsApplicable(ctx, problem))
+            if(s.IsEmpty() || !s.IsDynamic() ||
+               !solver::CachedIsApplicable(record.get(), solver_id, s, ctx, problem))
                 continue;
-            const auto ws = s.GetWorkspaceSize(ctx, problem);
+            const auto ws =
+                solver::CachedGetWorkspaceSize(record.get(), solver_id, s, ctx, problem);
             if(!conv::IsEnoughWorkspace("GetSolutionsFallback WTI", solver_id, ws, invokeParams))
                 continue;
 
-            const auto wti = s.GetWti(ctx, problem);
+            const auto wti = solver::CachedGetWti(record.get(), solver_id, s, ctx, problem);
             MIOPEN_LOG_I2(solver_id.ToString() << " Estimated WTI = " << wti);
             if(wti < 0.0f) // Skip unknown WTIs.
                 continue;
@@ -742,11 +748,13 @@ std::vector<miopenConvSolution_t> GetSolutions(const ExecutionContext& ctx,
     std::sort(begin(interim), end(interim), SolutionTimeComparator{});
     auto out = std::vector<miopenConvSolution_t>{};
     out.reserve(maxSolutionCount);
-    auto n_copied = 0;
+    auto n_copied     = 0;
+    const auto record = solver::GetApplicabilityRecord(ctx, problem);
     for(const auto& s : interim)
     {
         const auto solver_id = solver::Id{s.solution_id};
-        if(!solver_id.GetSolver().IsApplicable(ctx, problem))
+        if(!solver::CachedIsApplicable(
+               record.get(), solver_id, solver_id.GetSolver(), ctx, problem))
             continue;
         if(!conv::IsEnoughWorkspace("GetSolutions", solver_id, s.workspace_size, invokeParams))
             continue;
@@ -974,8 +982,7 @@ void ConvolutionDescriptor::ConvolutionBackwardData(Handle& handle,
         const auto algorithm_name = AlgorithmName{ConvolutionAlgoToDirectionalString(
             static_cast<miopenConvAlgorithm_t>(algo), conv::Direction::BackwardData)};
 
-        const auto network_config = problem.MakeNetworkConfig();
-        const auto& invoker       = handle.GetInvoker(network_config, {}, algorithm_name);
+        const auto& invoker = handle.GetInvoker(problem.MakeKey(), {}, algorithm_name);
 
         if(!invoker)
             MIOPEN_THROW("No invoker was registered for convolution backward. Was find executed?");
@@ -1178,8 +1185,8 @@ void ConvolutionDescriptor::ConvolutionBackwardWeights(const Handle& handle,
 
         decltype(auto) algorithm_name = AlgorithmName{ConvolutionAlgoToDirectionalString(
             static_cast<miopenConvAlgorithm_t>(algo), direction)};
-        decltype(auto) network_config = problem.MakeNetworkConfig();
-        decltype(auto) invoker = handle.GetInvoker(network_config, std::nullopt, algorithm_name);
+        decltype(auto) invoker =
+            handle.GetInvoker(problem.MakeKey(), std::nullopt, algorithm_name);
 
         if(!invoker)
             MIOPEN_THROW("No invoker was registered for convolution weights. Was find executed?");
@@ -27,6 +27,7 @@
 #include <miopen/handle.hpp>
 
 #include <miopen/binary_cache.hpp>
+#include <miopen/compile_registry.hpp>
 #include <miopen/config.h>
 #include <miopen/env.hpp>
 #include <miopen/errors.hpp>
@@ -37,11 +38,13 @@
 #include <miopen/logger.hpp>
 #include <miopen/manage_ptr.hpp>
 #include <miopen/ocldeviceinfo.hpp>
+#include <miopen/ramdb.hpp>
 #include <miopen/timer.hpp>
 
 #include <miopen/filesystem.hpp>
 #include <boost/filesystem/operations.hpp>
 
+#include <mutex>
 #include <string>
 
 #ifndef _WIN32
@@ -83,6 +86,7 @@ struct HandleImpl
     bool enable_profiling  = false;
     float profiling_result = 0.0;
     TargetProperties target_properties;
+    std::mutex max_mem_alloc_size_mutex;
 
     std::string get_device_name() const
     {
@@ -265,7 +269,7 @@ Handle::Handle() : impl(new HandleImpl())
 }
 
 Handle::Handle(Handle&&) noexcept = default;
-Handle::~Handle()                 = default;
+Handle::~Handle() { RamDb::FlushAll(); }
 
 void Handle::SetStream(miopenAcceleratorQueue_t streamID) const
 {
@@ -400,27 +404,56 @@ Program Handle::LoadProgram(const std::string& program_name,
         this->GetTargetProperties(), this->GetMaxComputeUnits(), program_name, params);
     if(hsaco.empty())
     {
-        CompileTimer ct;
-        auto p = miopen::LoadProgram(miopen::GetContext(this->GetStream()),
-                                     miopen::GetDevice(this->GetStream()),
-                                     this->GetTargetProperties(),
-                                     program_name,
-                                     params,
-                                     kernel_src);
-        ct.Log("Kernel", program_name);
-
+        // Threads and handles which need the same program at the same time build it only once.
+        auto p            = ClProgramPtr{};
+        const auto binary = GetCompileRegistry().GetOrBuild(
+            CompileRegistry::MakeKey(program_name, params, this->GetTargetProperties(), kernel_src),
+            [&]() {
+                CompileTimer ct;
+                p = miopen::LoadProgram(miopen::GetContext(this->GetStream()),
+                                        miopen::GetDevice(this->GetStream()),
+                                        this->GetTargetProperties(),
+                                        program_name,
+                                        params,
+                                        kernel_src);
+                ct.Log("Kernel", program_name);
+
+                std::string code_object;
+                miopen::GetProgramBinary(p, code_object);
 // Save to cache
 #if MIOPEN_ENABLE_SQLITE_KERN_CACHE
-        std::string binary;
-        miopen::GetProgramBinary(p, binary);
-        miopen::SaveBinary(
-            binary, this->GetTargetProperties(), this->GetMaxComputeUnits(), program_name, params);
+                miopen::SaveBinary(code_object,
+                                   this->GetTargetProperties(),
+                                   this->GetMaxComputeUnits(),
+                                   program_name,
+                                   params);
 #else
-        auto path = miopen::GetCachePath(false) / boost::filesystem::unique_path().string();
-        miopen::SaveProgramBinary(p, path.string());
-        miopen::SaveBinary(path, this->GetTargetProperties(), program_name, params);
+                auto path =
+                    miopen::GetCachePath(false) / boost::filesystem::unique_path().string();
+                miopen::SaveProgramBinary(p, path.string());
+                miopen::SaveBinary(path, this->GetTargetProperties(), program_name, params);
 #endif
-        return p;
+                return CompileRegistry::Binary{code_object.begin(), code_object.end()};
+            },
+            [&]() {
+                // Another caller may have finished and cached this program meanwhile.
+#if MIOPEN_ENABLE_SQLITE_KERN_CACHE
+                return miopen::LoadBinary(
+                    this->GetTargetProperties(), this->GetMaxComputeUnits(), program_name, params);
+#else
+                const auto path = miopen::LoadBinary(
+                    this->GetTargetProperties(), this->GetMaxComputeUnits(), program_name, params);
+                return path.empty() ? CompileRegistry::Binary{} : miopen::LoadFile(path);
+#endif
+            });
+
+        if(p != nullptr)
+            return p;
+
+        // Built by a concurrent call or found in the binary cache.
+        return LoadBinaryProgram(miopen::GetContext(this->GetStream()),
+                                 miopen::GetDevice(this->GetStream()),
+                                 std::string{binary.begin(), binary.end()});
     }
     else
     {
@@ -482,8 +515,12 @@ std::ostream& Handle::Print(std::ostream& os) const
     return os;
 }
 
+// OpenCL calls take the device explicitly.
+void Handle::SetCurrentDevice() const {}
+
 std::size_t Handle::GetMaxMemoryAllocSize()
 {
+    const std::lock_guard<std::mutex> lock{this->impl->max_mem_alloc_size_mutex};
     if(m_MaxMemoryAllocSizeCached == 0)
         m_MaxMemoryAllocSizeCached = miopen::GetDeviceInfo<CL_DEVICE_MAX_MEM_ALLOC_SIZE>(
             miopen::GetDevice(this->GetStream()));
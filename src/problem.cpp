@@ -40,6 +40,7 @@
 #include <miopen/softmax/solvers.hpp>
 #include <miopen/datatype.hpp>
 #include <miopen/execution_context.hpp>
+#include <miopen/find_db.hpp>
 #include <miopen/fusion_plan.hpp>
 #include <miopen/handle.hpp>
 #include <miopen/mlo_internal.hpp>
@@ -50,6 +51,8 @@
 
 #include <nlohmann/json.hpp>
 
+#include <algorithm>
+
 #include <boost/hof/match.hpp>
 
 namespace miopen::debug {
@@ -229,6 +232,37 @@ const TensorDescriptor& Problem::GetTensorDescriptor(miopenTensorArgumentId_t na
     return found->second;
 }
 
+void Problem::PrefetchDbs(Handle& handle, const std::vector<Problem>& problems)
+{
+    auto conv_problems = std::vector<conv::ProblemDescription>{};
+
+    for(const auto& problem : problems)
+    {
+        // Only convolutions use the perf-db and the find-db.
+        const auto conv_desc = std::get_if<ConvolutionDescriptor>(&problem.operator_descriptor);
+        if(conv_desc == nullptr)
+            continue;
+
+        conv_problems.push_back(conv_desc->mode == miopenTranspose
+                                    ? problem.MakeTransposed().AsConvolution()
+                                    : problem.AsConvolution());
+    }
+
+    if(conv_problems.empty())
+        return;
+
+    MIOPEN_LOG_I("Prefetching databases for " << conv_problems.size() << " problems");
+
+    // Those kept in memory (RamDb, ReadonlyRamDb) load and cache the whole file here, so the
+    // lookups of the later Find calls are served from memory. The SQLite perf-db keeps the
+    // records of the problems which it looks up in batches, so the lookup of each solver during
+    // Find does not run a query of its own.
+    const auto ctx = ExecutionContext{&handle};
+    std::ignore    = GetDb(ctx).FindRecords(conv_problems);
+    FindDbRecord::Prefetch(handle);
+    UserFindDbRecord::Prefetch(handle);
+}
+
 Problem Problem::MakeTransposed() const
 {
     auto transposed = Problem{};
@@ -26,19 +26,38 @@
 
 #include <miopen/ramdb.hpp>
 
+#include <miopen/db_binary.hpp>
+#include <miopen/env.hpp>
 #include <miopen/errors.hpp>
 #include <miopen/lock_file.hpp>
 #include <miopen/logger.hpp>
 
 #include <miopen/filesystem.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
 #include <ctime>
 #include <fstream>
 #include <limits>
 #include <map>
 #include <mutex>
+#include <random>
+#include <set>
+#include <shared_mutex>
 #include <sstream>
+#include <thread>
+
+#include <fcntl.h>
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_DB_WRITE_BEHIND)
+MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_DEBUG_DB_WRITE_BEHIND_PERIOD_MS, 5000)
 
 namespace miopen {
 
@@ -75,6 +94,27 @@ static void UpdateDbModificationTime(const fs::path& path)
     file << time.count();
 }
 
+static std::optional<std::int64_t> GetTimeFileStamp(const fs::path& path)
+{
+#if MIOPEN_WORKAROUND_USE_BOOST_FILESYSTEM
+    boost::system::error_code ec;
+    const auto time = fs::last_write_time(RamDb::GetTimeFilePath(path), ec);
+    if(ec)
+        return std::nullopt;
+    return static_cast<std::int64_t>(time);
+#else
+    std::error_code ec;
+    const auto time = fs::last_write_time(RamDb::GetTimeFilePath(path), ec);
+    if(ec)
+        return std::nullopt;
+    return static_cast<std::int64_t>(time.time_since_epoch().count());
+#endif
+}
+
+// Coarsest write time resolution we expect from a file system (FAT has 2 seconds) plus a margin.
+// Two writes of the .time file closer than that may leave the same write time.
+static std::chrono::seconds GetTimeFileResolution() { return std::chrono::seconds{3}; }
+
 #define MIOPEN_VALIDATE_LOCK(lock)                       \
     do                                                   \
     {                                                    \
@@ -84,11 +124,161 @@ static void UpdateDbModificationTime(const fs::path& path)
 
 static std::chrono::seconds GetLockTimeout() { return std::chrono::seconds{60}; }
 
+/// Writes the contents of a file, or the entries of a directory, through to the disk.
+static bool SyncToDisk(const fs::path& path, bool is_directory)
+{
+#ifdef _WIN32
+    // NTFS journals renames itself and directories can't be opened as files.
+    if(is_directory)
+        return true;
+    const auto fd = _wopen(path.wstring().c_str(), _O_RDWR | _O_BINARY);
+    if(fd < 0)
+        return false;
+    const auto synced = _commit(fd) == 0;
+    _close(fd);
+#else
+    const auto fd = open(path.c_str(), is_directory ? O_RDONLY | O_DIRECTORY : O_WRONLY);
+    if(fd < 0)
+        return false;
+    const auto synced = fsync(fd) == 0;
+    close(fd);
+#endif
+    return synced;
+}
+
 using exclusive_lock = std::unique_lock<LockFile>;
+using shared_lock    = std::shared_lock<LockFile>;
+
+namespace {
+
+/// Background thread which periodically flushes the journals of RamDb instances in the
+/// write-behind mode. The remaining changes are flushed on exit.
+class WriteBehindFlusher
+{
+public:
+    /// Returns nullptr during the static destruction, once the flusher is gone.
+    static WriteBehindFlusher* Get()
+    {
+        // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+        static WriteBehindFlusher instance;
+        return destroyed ? nullptr : &instance;
+    }
+
+    WriteBehindFlusher(const WriteBehindFlusher&) = delete;
+    WriteBehindFlusher& operator=(const WriteBehindFlusher&) = delete;
+
+    ~WriteBehindFlusher()
+    {
+        {
+            const auto lock = std::lock_guard<std::mutex>{mutex};
+            stop            = true;
+        }
+        wakeup.notify_all();
+        thread.join();
+        FlushAll();
+        destroyed = true;
+    }
+
+    void Register(RamDb& db)
+    {
+        const auto lock = std::lock_guard<std::mutex>{mutex};
+        dbs.push_back(&db);
+    }
+
+    void Unregister(RamDb& db)
+    {
+        {
+            const auto lock = std::lock_guard<std::mutex>{mutex};
+            dbs.erase(std::remove(dbs.begin(), dbs.end(), &db), dbs.end());
+        }
+        // Waits for a flush in progress which may still use the db.
+        const auto flush_lock = std::lock_guard<std::mutex>{flush_mutex};
+    }
+
+    void FlushAll()
+    {
+        const auto flush_lock = std::lock_guard<std::mutex>{flush_mutex};
+        const auto snapshot   = [&]() {
+            const auto lock = std::lock_guard<std::mutex>{mutex};
+            return dbs;
+        }();
+
+        for(auto* db : snapshot)
+        {
+            try
+            {
+                db->Flush();
+            }
+            catch(const std::exception& ex)
+            {
+                MIOPEN_LOG_E("Failed to flush pending db changes: " << ex.what());
+            }
+        }
+    }
+
+private:
+    static inline std::atomic<bool> destroyed{false};
+
+    std::mutex mutex;
+    std::mutex flush_mutex;
+    std::condition_variable wakeup;
+    std::vector<RamDb*> dbs;
+    bool stop = false;
+    std::thread thread{[this]() { Run(); }};
+
+    WriteBehindFlusher() = default;
+
+    void Run()
+    {
+        const auto period =
+            std::chrono::milliseconds{env::value(MIOPEN_DEBUG_DB_WRITE_BEHIND_PERIOD_MS)};
+        auto lock = std::unique_lock<std::mutex>{mutex};
+
+        while(!wakeup.wait_for(lock, period, [&]() { return stop; }))
+        {
+            lock.unlock();
+            FlushAll();
+            lock.lock();
+        }
+    }
+};
+
+} // namespace
 
 RamDb::RamDb(DbKinds db_kind_, const fs::path& path, bool is_system)
-    : PlainTextDb(db_kind_, path, is_system)
+    : PlainTextDb(db_kind_, path, is_system),
+      write_behind(!DisableUserDbFileIO && env::enabled(MIOPEN_DEBUG_DB_WRITE_BEHIND))
+{
+    if(!write_behind)
+        return;
+
+    MIOPEN_LOG_I2("Write-behind mode is enabled for " << GetFileName());
+    if(auto* const flusher = WriteBehindFlusher::Get())
+        flusher->Register(*this);
+}
+
+RamDb::~RamDb()
+{
+    if(!write_behind)
+        return;
+
+    if(auto* const flusher = WriteBehindFlusher::Get())
+        flusher->Unregister(*this);
+
+    try
+    {
+        Flush();
+    }
+    catch(const std::exception& ex)
+    {
+        MIOPEN_LOG_E("Failed to flush pending changes to " << GetFileName() << ": " << ex.what());
+    }
+}
+
+void RamDb::FlushAll()
 {
+    if(auto* const flusher = WriteBehindFlusher::Get())
+        flusher->FlushAll();
 }
 
 RamDb& RamDb::GetCached(DbKinds db_kind_, const fs::path& path, bool is_system)
@@ -109,25 +299,101 @@ RamDb& RamDb::GetCached(DbKinds db_kind_, const fs::path& path, bool is_system)
         *instances.emplace(path, std::make_unique<RamDb>(db_kind_, path, is_system)).first->second;
     if constexpr(!DisableUserDbFileIO)
     {
-        const auto prefetch_lock = exclusive_lock(instance.GetLockFile(), GetLockTimeout());
+        const auto prefetch_lock = shared_lock(instance.GetLockFile(), GetLockTimeout());
         MIOPEN_VALIDATE_LOCK(prefetch_lock);
         instance.Prefetch();
     }
     return instance;
 }
 
-boost::optional<DbRecord> RamDb::FindRecord(const std::string& problem)
+template <class TFunc>
+auto RamDb::ReadCache(TFunc&& func)
 {
-    const auto lock = exclusive_lock(GetLockFile(), GetLockTimeout());
-    MIOPEN_VALIDATE_LOCK(lock);
+    {
+        const auto cache_lock = std::shared_lock<std::shared_mutex>{cache_mutex};
+        if(IsCacheFreshUnsafe())
+            return func();
+    }
+
+    return RefreshCache(func);
+}
 
-    if(!ValidateUnsafe())
+template <class TFunc>
+auto RamDb::WriteCache(TFunc&& func)
+{
     {
-        MIOPEN_LOG_I2("RamDb file is newer than cache, prefetching");
-        Prefetch();
+        const auto cache_lock = std::unique_lock<std::shared_mutex>{cache_mutex};
+        if(IsCacheFreshUnsafe())
+            return func();
     }
 
-    return FindRecordUnsafe(problem);
+    return RefreshCache(func);
+}
+
+template <class TFunc>
+auto RamDb::RefreshCache(TFunc&& func)
+{
+    // The exclusive lock is intentional: readers that keep taking the shared file lock while the
+    // timestamp settles after a write would starve the writers.
+    const auto lock = exclusive_lock(GetLockFile(), GetLockTimeout());
+    MIOPEN_VALIDATE_LOCK(lock);
+    const auto cache_lock = std::unique_lock<std::shared_mutex>{cache_mutex};
+    RefreshCacheUnsafe();
+    return func();
+}
+
+boost::optional<DbRecord> RamDb::FindRecord(const std::string& problem)
+{
+    return ReadCache([&]() { return FindRecordUnsafe(problem); });
+}
+
+std::vector<boost::optional<DbRecord>> RamDb::FindRecords(const std::vector<std::string>& keys)
+{
+    return ReadCache([&]() {
+        auto records = std::vector<boost::optional<DbRecord>>{};
+        records.reserve(keys.size());
+        for(const auto& key : keys)
+            records.push_back(FindRecordUnsafe(key));
+        return records;
+    });
+}
+
+bool RamDb::VisitRecord(const std::string& key,
+                        const std::function<bool(const DbRecordView&)>& visitor)
+{
+    return ReadCache([&]() {
+        MIOPEN_LOG_I2("Looking for key " << key << " in cache for file " << GetFileName());
+        const auto it = cache.find(key);
+
+        if(it == cache.end())
+            return false;
+
+        return visitor(DbRecordView{it->first, it->second.content});
+    });
+}
+
+void RamDb::ForEachRecord(const std::function<void(const DbRecordView&)>& func)
+{
+    ReadCache([&]() {
+        for(const auto& [key, item] : cache)
+            func(DbRecordView{key, item.content});
+    });
+}
+
+void RamDb::VisitNearest(NearestRecords& nearest)
+{
+    ReadCache([&]() {
+        // Lookups share the cache, so the index has a lock of its own.
+        const auto index_lock = std::lock_guard<std::mutex>{nearest_index_mutex};
+        if(nearest_index_version != cache_version)
+        {
+            nearest_index.Clear();
+            for(const auto& [key, item] : cache)
+                nearest_index.Add(DbRecordView{key, item.content});
+            nearest_index_version = cache_version;
+        }
+        nearest.Visit(nearest_index);
+    });
 }
 
 bool RamDb::StoreRecord(const DbRecord& record)
@@ -135,8 +401,13 @@ bool RamDb::StoreRecord(const DbRecord& record)
     const auto& key = record.GetKey();
     MIOPEN_LOG_I2("Trying to store record at key " << key << " in cache for file "
                                                    << GetFileName());
+    if(write_behind)
+        return StoreRecordDeferred(record);
+
     const auto lock = exclusive_lock(GetLockFile(), GetLockTimeout());
     MIOPEN_VALIDATE_LOCK(lock);
+    const auto cache_lock = std::unique_lock<std::shared_mutex>{cache_mutex};
+    time_file_stamp_trusted = false;
 
     if constexpr(!DisableUserDbFileIO)
     {
@@ -158,8 +429,13 @@ bool RamDb::UpdateRecord(DbRecord& record)
     const auto& key = record.GetKey();
     MIOPEN_LOG_I2("Trying to update record at key " << key << " in cache for file "
                                                     << GetFileName());
+    if(write_behind)
+        return UpdateRecordDeferred(record);
+
     const auto lock = exclusive_lock(GetLockFile(), GetLockTimeout());
     MIOPEN_VALIDATE_LOCK(lock);
+    const auto cache_lock = std::unique_lock<std::shared_mutex>{cache_mutex};
+    time_file_stamp_trusted = false;
 
     if constexpr(!DisableUserDbFileIO)
     {
@@ -180,8 +456,13 @@ bool RamDb::RemoveRecord(const std::string& key)
 {
     MIOPEN_LOG_I2("Trying to remove record at key " << key << " from cache for file "
                                                     << GetFileName());
+    if(write_behind)
+        return RemoveRecordDeferred(key);
+
     const auto lock = exclusive_lock(GetLockFile(), GetLockTimeout());
     MIOPEN_VALIDATE_LOCK(lock);
+    const auto cache_lock = std::unique_lock<std::shared_mutex>{cache_mutex};
+    time_file_stamp_trusted = false;
 
 #if MIOPEN_DB_CACHE_WRITE_THROUGH
     const auto is_valid = ValidateUnsafe();
@@ -198,6 +479,7 @@ bool RamDb::RemoveRecord(const std::string& key)
     if(is_valid)
     {
         cache.erase(key);
+        ++cache_version;
         file_read_time = ramdb_clock::now();
     }
 #else
@@ -211,8 +493,13 @@ bool RamDb::Remove(const std::string& key, const std::string& id)
 {
     MIOPEN_LOG_I2("Trying to remove value at key " << key << " and id " << id
                                                    << " from cache for file " << GetFileName());
+    if(write_behind)
+        return RemoveDeferred(key, id);
+
     const auto lock = exclusive_lock(GetLockFile(), GetLockTimeout());
     MIOPEN_VALIDATE_LOCK(lock);
+    const auto cache_lock = std::unique_lock<std::shared_mutex>{cache_mutex};
+    time_file_stamp_trusted = false;
 
 #if MIOPEN_DB_CACHE_WRITE_THROUGH
     const auto is_valid = ValidateUnsafe();
@@ -245,6 +532,7 @@ bool RamDb::Remove(const std::string& key, const std::string& id)
             it->second.content = ss.str();
         }
 
+        ++cache_version;
         file_read_time = ramdb_clock::now();
     }
 #else
@@ -301,11 +589,50 @@ bool RamDb::ValidateUnsafe()
     return validation_result;
 }
 
+bool RamDb::IsCacheFreshUnsafe() const
+{
+    if(DisableUserDbFileIO)
+        return true;
+    return time_file_stamp_trusted && GetTimeFileStamp(GetFileName()) == time_file_stamp;
+}
+
+void RamDb::RefreshCacheUnsafe()
+{
+    if(DisableUserDbFileIO)
+        return;
+
+    const auto now   = ramdb_clock::now();
+    const auto stamp = GetTimeFileStamp(GetFileName());
+
+    if(stamp != time_file_stamp)
+    {
+        time_file_stamp      = stamp;
+        time_file_stamp_seen = now;
+    }
+
+    auto is_valid = ValidateUnsafe();
+
+    if(!is_valid)
+    {
+        MIOPEN_LOG_I2("RamDb file is newer than cache, prefetching");
+        Prefetch();
+        is_valid = ValidateUnsafe();
+    }
+
+    // Writers hold the exclusive file lock, so the .time file can't change while we are here.
+    // Its write time is only guaranteed to change on the next write once the resolution has
+    // passed since the last write, otherwise two writes may leave the same stamp.
+    time_file_stamp_trusted =
+        is_valid && (now - time_file_stamp_seen >= GetTimeFileResolution() ||
+                     now - GetDbModificationTime(GetFileName()) >= GetTimeFileResolution());
+}
+
 void RamDb::Prefetch()
 {
     if(DisableUserDbFileIO)
         MIOPEN_THROW("Prefetch should never happen with disabled File IO");
 
+    ++cache_version;
     Measure("Prefetch", [this]() {
         auto file = std::ifstream{GetFileName()};
 
@@ -317,6 +644,12 @@ void RamDb::Prefetch()
             return;
         }
 
+        if(DbBinary::IsBinary(file))
+        {
+            MIOPEN_LOG_E("Binary dbs are only supported as system dbs: " << GetFileName());
+            return;
+        }
+
         cache.clear();
         auto line   = std::string{};
         auto n_line = 0;
@@ -346,6 +679,8 @@ void RamDb::Prefetch()
 
         file_read_time = ramdb_clock::now();
     });
+
+    ApplyJournalUnsafe();
 }
 
 #if MIOPEN_DB_CACHE_WRITE_THROUGH
@@ -372,9 +707,290 @@ void RamDb::UpdateCacheEntryUnsafe(const DbRecord& record)
         {
             cache.emplace(key, CacheItem{-1, ss.str()});
         }
+        ++cache_version;
         file_read_time = ramdb_clock::now();
     }
 }
 #endif
 
+bool RamDb::StoreRecordDeferred(const DbRecord& record)
+{
+    return WriteCache([&]() {
+        auto& item   = journal[record.GetKey()];
+        item.replace = true;
+        item.values.clear();
+        for(const auto& [id, values] : record.map)
+            item.values.emplace(id, values);
+        SetCacheEntryUnsafe(record);
+        return true;
+    });
+}
+
+bool RamDb::UpdateRecordDeferred(DbRecord& record)
+{
+    return WriteCache([&]() {
+        auto& item = journal[record.GetKey()];
+
+        // Only the provided values are journaled, the ones from the file are merged on flush.
+        for(const auto& [id, values] : record.map)
+            item.values[id] = values;
+
+        if(const auto cached = FindRecordUnsafe(record.GetKey()))
+            record.Merge(*cached);
+
+        SetCacheEntryUnsafe(record);
+        return true;
+    });
+}
+
+bool RamDb::RemoveRecordDeferred(const std::string& key)
+{
+    return WriteCache([&]() {
+        auto& item   = journal[key];
+        item.replace = true;
+        item.values.clear();
+        cache.erase(key);
+        ++cache_version;
+        return true;
+    });
+}
+
+bool RamDb::RemoveDeferred(const std::string& key, const std::string& id)
+{
+    return WriteCache([&]() {
+        auto record = FindRecordUnsafe(key);
+
+        if(!record || !record->EraseValues(id))
+            return false;
+
+        journal[key].values[id] = std::nullopt;
+        SetCacheEntryUnsafe(*record);
+        return true;
+    });
+}
+
+void RamDb::SetCacheEntryUnsafe(const DbRecord& record)
+{
+    const auto& key = record.GetKey();
+    ++cache_version;
+
+    if(record.GetSize() == 0)
+    {
+        cache.erase(key);
+        return;
+    }
+
+    auto ss = std::ostringstream{};
+    record.WriteIdsAndValues(ss);
+    auto content = ss.str();
+
+    // WriteIdsAndValues() terminates the line.
+    if(!content.empty() && content.back() == '\n')
+        content.pop_back();
+
+    const auto it = cache.find(key);
+    if(it != cache.end())
+        it->second.content = std::move(content);
+    else
+        cache.emplace(key, CacheItem{-1, std::move(content)});
+}
+
+void RamDb::ApplyJournalItem(DbRecord& record, const JournalItem& item)
+{
+    if(item.replace)
+        record.map.clear();
+
+    for(const auto& [id, values] : item.values)
+    {
+        if(values)
+            record.map[id] = *values;
+        else
+            record.map.erase(id);
+    }
+}
+
+void RamDb::ApplyJournalUnsafe()
+{
+    for(const auto& [key, item] : journal)
+    {
+        auto record   = DbRecord{key};
+        const auto it = cache.find(key);
+
+        if(!item.replace && it != cache.end() && !record.ParseContents(it->second.content))
+            record = DbRecord{key};
+
+        ApplyJournalItem(record, item);
+        SetCacheEntryUnsafe(record);
+    }
+}
+
+bool RamDb::Flush()
+{
+    if(!write_behind)
+        return true;
+
+    {
+        // Also keeps the file lock untouched at exit, when the flusher has already written all.
+        const auto cache_lock = std::shared_lock<std::shared_mutex>{cache_mutex};
+        if(journal.empty())
+            return true;
+    }
+
+    const auto lock = exclusive_lock(GetLockFile(), GetLockTimeout());
+    MIOPEN_VALIDATE_LOCK(lock);
+
+    auto changes  = Journal{};
+    auto is_valid = false;
+
+    {
+        const auto cache_lock = std::unique_lock<std::shared_mutex>{cache_mutex};
+        if(journal.empty())
+            return true;
+        changes.swap(journal);
+        is_valid = ValidateUnsafe();
+    }
+
+    // The cache is left unlocked during the I/O, so lookups and further deferred writes proceed.
+    // The cache already holds the changes and no other process can write while we hold the file
+    // lock, so the stamp stays trusted until the .time file is written. Refreshes of the cache
+    // need the file lock and wait for us.
+    const auto written = WriteJournal(changes);
+    if(written)
+        UpdateDbModificationTime(GetFileName());
+
+    const auto cache_lock   = std::unique_lock<std::shared_mutex>{cache_mutex};
+    time_file_stamp_trusted = false;
+
+    if(!written)
+    {
+        // Put the changes back, under the ones made meanwhile.
+        for(auto& [key, item] : changes)
+        {
+            const auto newer = journal.find(key);
+            if(newer == journal.end())
+            {
+                journal.emplace(key, std::move(item));
+                continue;
+            }
+            if(newer->second.replace)
+                continue;
+            for(auto& [id, values] : newer->second.values)
+                item.values[id] = std::move(values);
+            newer->second = std::move(item);
+        }
+        return false;
+    }
+
+    if(is_valid)
+        file_read_time = ramdb_clock::now();
+    return true;
+}
+
+bool RamDb::WriteJournal(const Journal& changes)
+{
+    const auto& filename = GetFileName();
+    const auto temp_name = filename + ".temp" + std::to_string(std::random_device{}());
+
+    {
+        auto from = std::ifstream{filename, std::ios::binary};
+
+        if(from && DbBinary::IsBinary(from))
+        {
+            MIOPEN_LOG_E("Binary dbs are only supported as system dbs: " << filename);
+            return false;
+        }
+
+        auto to      = std::ofstream{temp_name, std::ios::binary};
+        auto written = std::set<std::string, std::less<>>{};
+        auto line    = std::string{};
+
+        if(!to)
+        {
+            MIOPEN_LOG_E("Temp file is unwritable: " << temp_name);
+            return false;
+        }
+
+        while(from && std::getline(from, line))
+        {
+            const auto key_size = line.find('=');
+            const auto it       = key_size == std::string::npos
+                                      ? changes.end()
+                                      : changes.find(std::string_view{line}.substr(0, key_size));
+
+            if(it == changes.end())
+            {
+                to << line << '\n';
+                continue;
+            }
+
+            // Later records under the same key are shadowed by the first one, drop them.
+            if(!written.insert(it->first).second)
+                continue;
+
+            auto record = DbRecord{it->first};
+            if(!it->second.replace && !record.ParseContents(line.substr(key_size + 1)))
+            {
+                MIOPEN_LOG_E("Error parsing payload under the key: " << it->first << " form file "
+                                                                     << filename);
+                record = DbRecord{it->first};
+            }
+
+            ApplyJournalItem(record, it->second);
+            record.WriteContents(to);
+        }
+
+        for(const auto& [key, item] : changes)
+        {
+            if(written.find(key) != written.end())
+                continue;
+
+            auto record = DbRecord{key};
+            ApplyJournalItem(record, item);
+            record.WriteContents(to);
+        }
+
+        if(!to.flush())
+        {
+            MIOPEN_LOG_E("Failed to write temp file: " << temp_name);
+            to.close();
+            fs::remove(temp_name);
+            return false;
+        }
+    }
+
+#if MIOPEN_WORKAROUND_USE_BOOST_FILESYSTEM
+    boost::system::error_code ec;
+#else
+    std::error_code ec;
+#endif
+    // The contents have to reach the disk before the rename does, otherwise a crash may leave the
+    // new name pointing at an empty file.
+    if(!SyncToDisk(temp_name, false))
+    {
+        MIOPEN_LOG_E("Failed to sync temp file: " << temp_name);
+        fs::remove(temp_name, ec);
+        return false;
+    }
+
+    // Readers of the file either see the old or the new contents, never a partial write.
+    fs::rename(temp_name, filename, ec);
+    if(ec)
+    {
+        MIOPEN_LOG_E("Failed to rename " << temp_name << " to " << filename << ": "
+                                         << ec.message());
+        fs::remove(temp_name, ec);
+        return false;
+    }
+    fs::permissions(filename, FS_ENUM_PERMS_ALL, ec);
+
+    // Persists the rename itself. The new contents are in place already, so a failure here is not
+    // reported as a failed flush.
+    const auto directory = filename.has_parent_path() ? filename.parent_path() : fs::path{"."};
+    if(!SyncToDisk(directory, true))
+        MIOPEN_LOG_W("Failed to sync directory: " << directory);
+
+    MIOPEN_LOG_I2("Flushed " << changes.size() << " pending records to " << filename);
+    return true;
+}
+
 } // namespace miopen
@@ -25,6 +25,10 @@
  *******************************************************************************/
 
 #include <miopen/readonlyramdb.hpp>
+#include <miopen/bz2.hpp>
+#include <miopen/db_binary.hpp>
+#include <miopen/db.hpp>
+#include <miopen/env.hpp>
 #include <miopen/logger.hpp>
 #include <miopen/errors.hpp>
 #include <miopen/filesystem.hpp>
@@ -33,10 +37,18 @@
 #include <miopen_data.hpp>
 #endif
 
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
 #include <fstream>
+#include <functional>
 #include <mutex>
 #include <sstream>
 #include <map>
+#include <thread>
+#include <vector>
+
+MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_DISABLE_DB_INDEX)
 
 namespace miopen {
 
@@ -49,8 +61,81 @@ bool& rordb_embed_fs_override()
 }
 } // namespace debug
 
-ReadonlyRamDb&
-ReadonlyRamDb::GetCached(DbKinds db_kind_, const fs::path& path, bool warn_if_unreadable)
+namespace {
+
+/// Background threads which load system dbs ahead of their first use.
+class PrefetchPool
+{
+public:
+    static PrefetchPool& Get()
+    {
+        // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+        static PrefetchPool instance;
+        return instance;
+    }
+
+    PrefetchPool(const PrefetchPool&) = delete;
+    PrefetchPool& operator=(const PrefetchPool&) = delete;
+
+    ~PrefetchPool()
+    {
+        {
+            const auto lock = std::lock_guard<std::mutex>{mutex};
+            stop            = true;
+            // There is no point in loading dbs at exit.
+            tasks.clear();
+        }
+        wakeup.notify_all();
+        for(auto& worker : workers)
+            worker.join();
+    }
+
+    void Push(std::function<void()> task)
+    {
+        {
+            const auto lock = std::lock_guard<std::mutex>{mutex};
+            if(workers.empty())
+            {
+                const auto num_workers = std::clamp(std::thread::hardware_concurrency(), 1u, 4u);
+                for(auto i = 0u; i < num_workers; ++i)
+                    workers.emplace_back([this]() { Run(); });
+            }
+            tasks.push_back(std::move(task));
+        }
+        wakeup.notify_one();
+    }
+
+private:
+    std::mutex mutex;
+    std::condition_variable wakeup;
+    std::deque<std::function<void()>> tasks;
+    std::vector<std::thread> workers;
+    bool stop = false;
+
+    PrefetchPool() = default;
+
+    void Run()
+    {
+        auto lock = std::unique_lock<std::mutex>{mutex};
+
+        while(true)
+        {
+            wakeup.wait(lock, [&]() { return stop || !tasks.empty(); });
+            if(stop)
+                return;
+
+            auto task = std::move(tasks.front());
+            tasks.pop_front();
+            lock.unlock();
+            task();
+            lock.lock();
+        }
+    }
+};
+
+} // namespace
+
+ReadonlyRamDb& ReadonlyRamDb::GetInstance(DbKinds db_kind_, const fs::path& path)
 {
     // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
     static std::mutex mutex;
@@ -64,12 +149,40 @@ ReadonlyRamDb::GetCached(DbKinds db_kind_, const fs::path& path, bool warn_if_un
     if(it != instances.end())
         return *it->second;
 
-    auto& instance =
-        *instances.emplace(path, std::make_unique<ReadonlyRamDb>(db_kind_, path)).first->second;
-    instance.Prefetch(warn_if_unreadable);
+    return *instances.emplace(path, std::make_unique<ReadonlyRamDb>(db_kind_, path))
+                .first->second;
+}
+
+ReadonlyRamDb&
+ReadonlyRamDb::GetCached(DbKinds db_kind_, const fs::path& path, bool warn_if_unreadable)
+{
+    auto& instance = GetInstance(db_kind_, path);
+    // The db is loaded outside of the instances lock, so other dbs stay available meanwhile.
+    std::call_once(instance.prefetched, [&]() { instance.Prefetch(warn_if_unreadable); });
     return instance;
 }
 
+void ReadonlyRamDb::PrefetchAsync(DbKinds db_kind_, const fs::path& path)
+{
+    if(path.empty())
+        return;
+
+    // Created before the pool, so the pool is destroyed first and its workers are joined while
+    // the instances are still alive.
+    auto& instance = GetInstance(db_kind_, path);
+
+    PrefetchPool::Get().Push([&instance]() {
+        try
+        {
+            std::call_once(instance.prefetched, [&]() { instance.Prefetch(true); });
+        }
+        catch(const std::exception& ex)
+        {
+            MIOPEN_LOG_W("Failed to prefetch " << instance.db_path << ": " << ex.what());
+        }
+    });
+}
+
 template <class TFunc>
 static auto Measure(const std::string& funcName, TFunc&& func)
 {
@@ -83,6 +196,75 @@ static auto Measure(const std::string& funcName, TFunc&& func)
                                    << " ms");
 }
 
+boost::optional<ReadonlyRamDb::ItemView> ReadonlyRamDb::FindItem(const std::string& problem) const
+{
+    if(index)
+    {
+        const auto item = index->Find(problem);
+        if(!item)
+            return boost::none;
+        return ItemView{item->line, item->key, item->content};
+    }
+
+    const auto it = cache.find(problem);
+    if(it == cache.end())
+        return boost::none;
+    return ItemView{it->second.line, it->first, it->second.content};
+}
+
+void ReadonlyRamDb::ForEachRecord(const std::function<void(const DbRecordView&)>& func) const
+{
+    if(index)
+    {
+        index->ForEach(
+            [&](const DbIndex::Item& item) { func(DbRecordView{item.key, item.content}); });
+        return;
+    }
+
+    for(const auto& [key, item] : cache)
+        func(DbRecordView{key, item.content});
+}
+
+void ReadonlyRamDb::VisitNearest(NearestRecords& nearest) const
+{
+    std::call_once(nearest_indexed, [this]() {
+        ForEachRecord([this](const DbRecordView& record) { nearest_index.Add(record); });
+    });
+    nearest.Visit(nearest_index);
+}
+
+const std::unordered_map<std::string, ReadonlyRamDb::CacheItem>& ReadonlyRamDb::GetCacheMap() const
+{
+    std::call_once(cache_materialized, [this]() {
+        if(!index)
+            return;
+        index->ForEach([this](const DbIndex::Item& item) {
+            cache.emplace(item.key, CacheItem{item.line, std::string{item.content}});
+        });
+    });
+    return cache;
+}
+
+bool ReadonlyRamDb::TryLoadIndex()
+{
+    if(DisableUserDbFileIO || env::enabled(MIOPEN_DEBUG_DISABLE_DB_INDEX))
+        return false;
+
+    const auto source =
+        fs::exists(db_path) ? db_path : fs::path{GetCompressedPath(db_path)};
+    const auto stamp = DbIndex::SourceStamp::Get(source);
+    if(!stamp)
+        return false;
+
+    const auto index_path = DbIndex::GetIndexPath(source);
+    index                 = DbIndex::Open(index_path, stamp);
+
+    if(!index && DbIndex::Build(source, index_path))
+        index = DbIndex::Open(index_path, stamp);
+
+    return index != nullptr;
+}
+
 void ReadonlyRamDb::ParseAndLoadDb(std::istream& input_stream, bool warn_if_unreadable)
 {
     if(!input_stream)
@@ -93,6 +275,18 @@ void ReadonlyRamDb::ParseAndLoadDb(std::istream& input_stream, bool warn_if_unre
         return;
     }
 
+    if(DbBinary::IsBinary(input_stream))
+    {
+        auto n_record = 0;
+        const auto ok =
+            DbBinary::Read(input_stream, [&](std::string&& key, std::string&& contents) {
+                cache.emplace(std::move(key), CacheItem{++n_record, std::move(contents)});
+            });
+        if(!ok)
+            MIOPEN_LOG_E("Malformed binary db: " << db_path << "#" << n_record);
+        return;
+    }
+
     auto line   = std::string{};
     auto n_line = 0;
 
@@ -145,7 +339,24 @@ void ReadonlyRamDb::Prefetch(bool warn_if_unreadable)
         }
         else
         {
-            auto input_stream = std::ifstream{db_path};
+            if(TryLoadIndex())
+                return;
+
+            const auto compressed_path = GetCompressedPath(db_path);
+            if(!fs::exists(db_path) && fs::exists(compressed_path))
+            {
+                MIOPEN_LOG_I2("Loading compressed db: " << compressed_path);
+                auto file         = std::ifstream{compressed_path, std::ios::binary};
+                auto input_stream = Bz2InputStream{file};
+                ParseAndLoadDb(input_stream, warn_if_unreadable);
+                if(input_stream.bad())
+                    MIOPEN_LOG_E("Failed to decompress " << compressed_path);
+                return;
+            }
+
+            const auto mode   = DbBinary::IsBinary(db_path) ? std::ios::in | std::ios::binary
+                                                                : std::ios::in;
+            auto input_stream = std::ifstream{db_path, mode};
             ParseAndLoadDb(input_stream, warn_if_unreadable);
         }
     });
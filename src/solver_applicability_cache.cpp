@@ -0,0 +1,184 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/solver_applicability_cache.hpp>
+
+#include <miopen/conv/problem_description.hpp>
+#include <miopen/env.hpp>
+#include <miopen/execution_context.hpp>
+#include <miopen/handle.hpp>
+
+#include <sstream>
+
+MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_DEBUG_APPLICABILITY_CACHE_SIZE, 1024)
+
+namespace miopen {
+namespace solver {
+
+std::optional<bool> ApplicabilityRecord::IsApplicable(Id id) const
+{
+    const auto idx = id.Value();
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    if(idx >= checked.size() || !checked[idx])
+        return std::nullopt;
+    return applicable_solvers[idx];
+}
+
+void ApplicabilityRecord::SetApplicable(Id id, bool applicable)
+{
+    const auto idx = id.Value();
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    if(idx >= checked.size())
+    {
+        checked.resize(idx + 1);
+        applicable_solvers.resize(idx + 1);
+    }
+    checked[idx]            = true;
+    applicable_solvers[idx] = applicable;
+}
+
+std::optional<std::size_t> ApplicabilityRecord::GetWorkspaceSize(Id id) const
+{
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    const auto it = estimates.find(id.Value());
+    return it != estimates.end() ? it->second.workspace_size : std::nullopt;
+}
+
+void ApplicabilityRecord::SetWorkspaceSize(Id id, std::size_t size)
+{
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    estimates[id.Value()].workspace_size = size;
+}
+
+std::optional<float> ApplicabilityRecord::GetWti(Id id) const
+{
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    const auto it = estimates.find(id.Value());
+    return it != estimates.end() ? it->second.wti : std::nullopt;
+}
+
+void ApplicabilityRecord::SetWti(Id id, float wti)
+{
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    estimates[id.Value()].wti = wti;
+}
+
+ApplicabilityCache::ApplicabilityCache(std::size_t capacity_) : capacity(capacity_) {}
+
+std::shared_ptr<ApplicabilityRecord> ApplicabilityCache::Get(const std::string& key)
+{
+    if(capacity == 0)
+        return nullptr;
+
+    const auto env_generation = env::getEnvironmentGeneration();
+    std::lock_guard<std::mutex> lock(mutex);
+
+    const auto it = index.find(key);
+    if(it != index.end())
+    {
+        if(it->second->env_generation == env_generation)
+        {
+            ++stats.hits;
+            lru.splice(lru.begin(), lru, it->second);
+            return it->second->record;
+        }
+        lru.erase(it->second);
+        index.erase(it);
+    }
+
+    ++stats.misses;
+    lru.push_front(Entry{key, env_generation, std::make_shared<ApplicabilityRecord>()});
+    index.emplace(key, lru.begin());
+
+    while(lru.size() > capacity)
+    {
+        index.erase(lru.back().key);
+        lru.pop_back();
+        ++stats.evictions;
+    }
+
+    return lru.front().record;
+}
+
+ApplicabilityCacheStats ApplicabilityCache::GetStats() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    auto ret    = stats;
+    ret.entries = lru.size();
+    return ret;
+}
+
+void ApplicabilityCache::ResetStats()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    stats = {};
+}
+
+void ApplicabilityCache::Clear()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    index.clear();
+    lru.clear();
+}
+
+ApplicabilityCache& GetApplicabilityCache()
+{
+    static ApplicabilityCache cache{env::value(MIOPEN_DEBUG_APPLICABILITY_CACHE_SIZE)};
+    return cache;
+}
+
+std::string MakeApplicabilityKey(const ExecutionContext& ctx, const NetworkConfig& network_config)
+{
+    auto& handle = ctx.GetStream();
+    std::ostringstream ss;
+    ss << network_config.ToString();
+    ss << '|' << handle.GetDeviceName() << '|' << handle.GetDbBasename();
+    ss << '|' << ctx.use_asm_kernels << ctx.use_hip_kernels << ctx.use_opencl_convolutions
+       << ctx.use_dynamic_solutions_only << ctx.disable_perfdb_access << ctx.rmv.getValue();
+    ss << '|' << ctx.general_compile_options;
+    return ss.str();
+}
+
+std::string MakeApplicabilityKey(const ExecutionContext& ctx,
+                                 const miopen::conv::ProblemDescription& problem)
+{
+    std::ostringstream ss;
+    ss << MakeApplicabilityKey(ctx, problem.MakeNetworkConfig());
+    for(const auto* tensor : {&problem.GetIn(), &problem.GetWeights(), &problem.GetOut()})
+    {
+        ss << '|';
+        for(const auto stride : tensor->GetStrides())
+            ss << stride << ',';
+    }
+    const auto& attribute = problem.GetConv().attribute;
+    ss << '|' << attribute.gfx90aFp16alt.GetFwd() << attribute.gfx90aFp16alt.GetBwd()
+       << attribute.gfx90aFp16alt.GetWrW() << attribute.deterministic.Get()
+       << static_cast<int>(attribute.fp8rounding_mode.Get());
+    return ss.str();
+}
+
+} // namespace solver
+} // namespace miopen
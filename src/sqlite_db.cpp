@@ -39,8 +39,10 @@
 #include <boost/none.hpp>
 #include <boost/optional.hpp>
 
+#include <map>
 #include <memory>
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <chrono>
 #include <cstdio>
@@ -49,12 +51,33 @@
 #include <mutex>
 #include <shared_mutex>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 extern "C" {
 int miopen_sqlite3_memvfs_init(sqlite3* db, char** pzErrMsg, const sqlite3_api_routines* pApi);
 }
 namespace miopen {
 
+using sqlite3_stmt_ptr = MIOPEN_MANAGE_PTR(sqlite3_stmt*, sqlite3_finalize);
+
+namespace {
+
+struct StatementCounters
+{
+    std::atomic<std::uint64_t> prepared{0};
+    std::atomic<std::uint64_t> reused{0};
+};
+
+StatementCounters& GetStatementCounters()
+{
+    // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+    static StatementCounters counters;
+    return counters;
+}
+
+} // namespace
+
 class SQLite::impl
 {
     struct SQLiteCloser
@@ -187,8 +210,46 @@ public:
             sqlite3_busy_timeout(ptrDb.get(), MIOPEN_SQL_BUSY_TIMEOUT_MS);
     }
 
+    /// Takes a prepared statement for the query from the pool.
+    /// Returns nullptr if there is no idle one.
+    sqlite3_stmt_ptr TakeStatement(const std::string& query)
+    {
+        const std::lock_guard<std::mutex> lock{statements_mutex};
+        const auto it = statements.find(query);
+        if(it == statements.end() || it->second.empty())
+            return nullptr;
+        auto stmt = std::move(it->second.back());
+        it->second.pop_back();
+        return stmt;
+    }
+
+    /// Resets the statement and returns it to the pool, so later statements with the same query
+    /// don't have to compile it again.
+    void ReturnStatement(const std::string& query, sqlite3_stmt_ptr stmt)
+    {
+        sqlite3_reset(stmt.get());
+        sqlite3_clear_bindings(stmt.get());
+
+        const std::lock_guard<std::mutex> lock{statements_mutex};
+        auto it = statements.find(query);
+        if(it == statements.end())
+        {
+            // Queries are expected to have their values bound, so the number of distinct ones is
+            // small. The limit only guards against callers which inline values.
+            if(statements.size() >= MaxCachedQueries)
+                return;
+            it = statements.emplace(query, std::vector<sqlite3_stmt_ptr>{}).first;
+        }
+        it->second.push_back(std::move(stmt));
+    }
+
+    static constexpr std::size_t MaxCachedQueries = 64;
+
     sqlite3_ptr ptrDb = nullptr;
     bool isValid;
+    // Declared after the connection, so statements are finalized before it is closed.
+    std::mutex statements_mutex;
+    std::unordered_map<std::string, std::vector<sqlite3_stmt_ptr>> statements;
 };
 
 static int find_callback(void* _res, int argc, char** argv, char** azColName)
@@ -273,6 +334,15 @@ int SQLite::Retry(std::function<int()> f) const
     return SQLite::Retry(f, filename);
 }
 
+SQLite::StatementStats SQLite::GetStatementStats()
+{
+    const auto& counters = GetStatementCounters();
+    auto stats           = StatementStats{};
+    stats.prepared       = counters.prepared;
+    stats.reused         = counters.reused;
+    return stats;
+}
+
 int SQLite::Changes() const { return sqlite3_changes(pImpl->ptrDb.get()); }
 
 std::string SQLite::ErrorMessage() const
@@ -284,11 +354,18 @@ bool SQLite::Valid() const { return pImpl->isValid; }
 
 class SQLite::Statement::impl
 {
-    using sqlite3_stmt_ptr = MIOPEN_MANAGE_PTR(sqlite3_stmt*, sqlite3_finalize);
     sqlite3_stmt_ptr Prepare(const SQLite& sql, const std::string& query)
     {
-        sqlite3_stmt* ptr = nullptr;
         MIOPEN_LOG_I2(query);
+        auto cached = sql.pImpl->TakeStatement(query);
+        if(cached)
+        {
+            ++GetStatementCounters().reused;
+            return cached;
+        }
+        ++GetStatementCounters().prepared;
+
+        sqlite3_stmt* ptr = nullptr;
         auto rc =
             sqlite3_prepare_v2(sql.pImpl->ptrDb.get(), query.c_str(), query.size(), &ptr, nullptr);
         if(rc != SQLITE_OK)
@@ -300,10 +377,14 @@ class SQLite::Statement::impl
     }
 
 public:
-    impl(const SQLite& sql, const std::string& query) { ptrStmt = Prepare(sql, query); }
-    impl(const SQLite& sql, const std::string& query, const std::vector<std::string>& vals)
+    impl(const SQLite& sql, const std::string& query_) : owner(sql.pImpl.get()), query(query_)
     {
         ptrStmt = Prepare(sql, query);
+    }
+
+    impl(const SQLite& sql, const std::string& query_, const std::vector<std::string>& vals)
+        : impl(sql, query_)
+    {
         int cnt = 1;
         for(auto& kinder : vals)
         {
@@ -315,6 +396,19 @@ public:
         MIOPEN_LOG_I2("[" << JoinStrings(vals, ",") << "]");
     }
 
+    impl(const impl&) = delete;
+    impl(impl&&)      = delete;
+    impl& operator=(const impl&) = delete;
+    impl& operator=(impl&&) = delete;
+
+    ~impl()
+    {
+        if(ptrStmt)
+            owner->ReturnStatement(query, std::move(ptrStmt));
+    }
+
+    SQLite::impl* owner;
+    std::string query;
     sqlite3_stmt_ptr ptrStmt = nullptr;
 };
 
@@ -385,9 +479,26 @@ int SQLite::Statement::BindInt64(int idx, const int64_t num)
     return 0;
 }
 
+SQLitePerfDb::PrefetchedRecords& SQLitePerfDb::GetPrefetchedRecords(const fs::path& path)
+{
+    // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+    static std::mutex mutex;
+    const std::lock_guard<std::mutex> lock{mutex};
+
+    // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+    static auto instances = std::map<fs::path, std::unique_ptr<PrefetchedRecords>>{};
+    auto& instance        = instances[path];
+    if(!instance)
+        instance = std::make_unique<PrefetchedRecords>();
+    return *instance;
+}
+
 SQLitePerfDb::SQLitePerfDb(DbKinds db_kind, const fs::path& filename_, bool is_system_)
     : SQLiteBase(db_kind, filename_, is_system_)
 {
+    if(is_system && !dbInvalid)
+        prefetched = &GetPrefetchedRecords(filename);
+
     if(DisableUserDbFileIO && !is_system)
         return;
 
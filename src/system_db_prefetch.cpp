@@ -0,0 +1,65 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/system_db_prefetch.hpp>
+#include <miopen/env.hpp>
+#include <miopen/execution_context.hpp>
+#include <miopen/find_db.hpp>
+#include <miopen/handle.hpp>
+#include <miopen/logger.hpp>
+#include <miopen/readonlyramdb.hpp>
+
+MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_DISABLE_SYSDB_PREFETCH)
+
+namespace miopen {
+
+void PrefetchSystemDbs(Handle& handle)
+{
+#if !MIOPEN_DISABLE_SYSDB
+    if(env::enabled(MIOPEN_DEBUG_DISABLE_SYSDB_PREFETCH))
+        return;
+
+    try
+    {
+#if MIOPEN_DEBUG_FIND_DB_CACHING
+        if(!env::enabled(MIOPEN_DEBUG_DISABLE_FIND_DB))
+            ReadonlyRamDb::PrefetchAsync(DbKinds::FindDb,
+                                         FindDbRecord::GetInstalledPath(handle, ""));
+#endif
+#if !(MIOPEN_ENABLE_SQLITE && MIOPEN_USE_SQLITE_PERFDB)
+        ReadonlyRamDb::PrefetchAsync(DbKinds::PerfDb, ExecutionContext{&handle}.GetPerfDbPath());
+#endif
+    }
+    catch(const std::exception& ex)
+    {
+        MIOPEN_LOG_W("Failed to start loading system dbs: " << ex.what());
+    }
+#else
+    std::ignore = handle;
+#endif
+}
+
+} // namespace miopen
@@ -363,12 +363,14 @@ TensorDescriptor::TensorDescriptor(miopenDataType_t t,
                                    const std::vector<std::size_t>& lens_in,
                                    const std::vector<std::size_t>& strides_in,
                                    bool use_strides)
-    : lens(lens_in),
-      strides(use_strides ? strides_in : std::vector<std::size_t>()),
-      type(t),
-      tensorLayout(layout_in)
+    : type(t), tensorLayout(layout_in)
 {
-    this->CheckArgsAndInit(use_strides);
+    auto new_shape  = std::make_shared<Shape>();
+    new_shape->lens = lens_in;
+    if(use_strides)
+        new_shape->strides = strides_in;
+    shape = new_shape;
+    this->CheckArgsAndInit(*new_shape, use_strides);
 }
 
 TensorDescriptor::TensorDescriptor(miopenDataType_t t,
@@ -376,16 +378,21 @@ TensorDescriptor::TensorDescriptor(miopenDataType_t t,
                                    std::vector<std::size_t>&& lens_in,
                                    std::vector<std::size_t>&& strides_in,
                                    bool use_strides)
-    : lens(std::move(lens_in)),
-      strides(use_strides ? std::move(strides_in) : std::vector<std::size_t>()),
-      type(t),
-      tensorLayout(layout_in)
+    : type(t), tensorLayout(layout_in)
 {
-    this->CheckArgsAndInit(use_strides);
+    auto new_shape  = std::make_shared<Shape>();
+    new_shape->lens = std::move(lens_in);
+    if(use_strides)
+        new_shape->strides = std::move(strides_in);
+    shape = new_shape;
+    this->CheckArgsAndInit(*new_shape, use_strides);
 }
 
-void TensorDescriptor::CheckArgsAndInit(bool use_strides)
+void TensorDescriptor::CheckArgsAndInit(Shape& new_shape, bool use_strides)
 {
+    auto& lens    = new_shape.lens;
+    auto& strides = new_shape.strides;
+
     if(!IsDataTypeSupported(type))
         MIOPEN_THROW(miopenStatusBadParm, "Unsupported data type");
 
@@ -498,14 +505,22 @@ TensorDescriptor TensorDescriptor::MakeDescriptor(miopenDataType_t t,
 
 bool TensorDescriptor::IsVectorized() const { return vector_length > 1; }
 
-const std::vector<std::size_t>& TensorDescriptor::GetLengths() const { return lens; }
+const TensorDescriptor::Shape& TensorDescriptor::GetShape() const
+{
+    // Default constructed and moved from descriptors have no shape.
+    static const Shape empty;
+    return shape ? *shape : empty;
+}
+
+const std::vector<std::size_t>& TensorDescriptor::GetLengths() const { return GetShape().lens; }
 
-const std::vector<std::size_t>& TensorDescriptor::GetStrides() const { return strides; }
+const std::vector<std::size_t>& TensorDescriptor::GetStrides() const { return GetShape().strides; }
 
-unsigned TensorDescriptor::GetNumDims() const { return lens.size(); }
+unsigned TensorDescriptor::GetNumDims() const { return GetShape().lens.size(); }
 
 std::size_t TensorDescriptor::GetElementSize() const
 {
+    const auto& lens = GetLengths();
     return std::accumulate(lens.begin(), lens.end(), vector_length, std::multiplies<std::size_t>());
 }
 
@@ -597,6 +612,8 @@ std::size_t TensorDescriptor::GetVectorLength() const { return this->vector_leng
 
 std::size_t TensorDescriptor::GetIndex(std::initializer_list<int> l) const
 {
+    const auto& strides = GetStrides();
+
     // l is in NCHW order (MIOpen implicit logic)
     if(tensorLayout == miopenTensorCHWNc4 || tensorLayout == miopenTensorCHWNc8)
     {
@@ -626,6 +643,8 @@ std::size_t TensorDescriptor::GetIndex(std::initializer_list<int> l) const
 
 std::size_t TensorDescriptor::GetElementSpace() const
 {
+    const auto& lens    = GetLengths();
+    const auto& strides = GetStrides();
     std::vector<std::size_t> maxIndices(lens.size());
     std::transform(lens.begin(),
                    lens.end(),
@@ -670,7 +689,7 @@ bool TensorDescriptor::IsPossibleLayout(const std::string& storage_layout,
         const auto pos = storage_layout.find(cur_char);
         if(pos == std::string::npos)
             MIOPEN_THROW(miopenStatusInternalError, "wrong layout format");
-        return strides[pos];
+        return GetStrides()[pos];
     };
 
     std::vector<std::size_t> layout_strides(base_layout.size());
@@ -727,7 +746,7 @@ std::string TensorDescriptor::GetLayout(std::string storage_layout) const
 
     const std::string base_storage_layout =
         is_vectorized_sl ? storage_layout.substr(0, storage_layout.size() - 1) : storage_layout;
-    if(base_storage_layout.size() != strides.size())
+    if(base_storage_layout.size() != GetStrides().size())
     {
         MIOPEN_THROW("Invalid storage_layout size. storage_layout size must be equavalent to the "
                      "stride size");
@@ -737,9 +756,12 @@ std::string TensorDescriptor::GetLayout(std::string storage_layout) const
     // and is faster than calling push_back in transform.
     auto result = base_storage_layout;
 
-    if(cached_permutation.size() == 0)
-        cached_permutation = find_permutation(lens, strides);
-    const auto& p = cached_permutation;
+    // The permutation only depends on the shape, so it is computed once for all the copies.
+    const auto& shape_ = GetShape();
+    std::call_once(shape_.permutation_computed, [&]() {
+        shape_.permutation = find_permutation(shape_.lens, shape_.strides);
+    });
+    const auto& p = shape_.permutation;
 
     std::transform(
         p.cbegin(), p.cend(), result.begin(), [&](auto i) { return base_storage_layout[i]; });
@@ -760,6 +782,8 @@ bool TensorDescriptor::IsPacked() const { return this->packed; }
 
 bool TensorDescriptor::IsContiguous() const
 {
+    const auto& lens     = GetLengths();
+    const auto& strides  = GetStrides();
     size_t plane_size    = 1;
     size_t dims_of_shape = lens.size();
 
@@ -777,7 +801,7 @@ bool TensorDescriptor::IsContiguous() const
 bool TensorDescriptor::AllLengthsFitIntoInt() const
 {
     if(!cached_lengths_fit_into_int)
-        cached_lengths_fit_into_int = CheckDimsFitIntoInt(lens);
+        cached_lengths_fit_into_int = CheckDimsFitIntoInt(GetLengths());
 
     return cached_lengths_fit_into_int.value();
 }
@@ -788,15 +812,19 @@ bool TensorDescriptor::AllDimsFitIntoInt() const
         return false;
 
     if(!cached_strides_fit_into_int)
-        cached_strides_fit_into_int = CheckDimsFitIntoInt(strides);
+        cached_strides_fit_into_int = CheckDimsFitIntoInt(GetStrides());
 
     return cached_strides_fit_into_int.value();
 }
 
 bool TensorDescriptor::operator==(const TensorDescriptor& rhs) const
 {
-    assert(this->lens.size() == rhs.strides.size());
-    return this->type == rhs.type && this->lens == rhs.lens && this->strides == rhs.strides;
+    assert(this->GetLengths().size() == rhs.GetStrides().size());
+    if(this->type != rhs.type)
+        return false;
+    // Copies share the shape.
+    return this->shape == rhs.shape || (this->GetLengths() == rhs.GetLengths() &&
+                                        this->GetStrides() == rhs.GetStrides());
 }
 
 bool TensorDescriptor::operator!=(const TensorDescriptor& rhs) const { return !(*this == rhs); }
@@ -816,9 +844,9 @@ bool TensorDescriptor::operator>(const TensorDescriptor& rhs) const
 std::string TensorDescriptor::ToString() const
 {
     std::string result;
-    if(this->lens.empty())
+    if(this->GetLengths().empty())
         return result;
-    for(auto i : this->lens)
+    for(auto i : this->GetLengths())
     {
         result += std::to_string(i) + ", ";
     }
@@ -827,8 +855,8 @@ std::string TensorDescriptor::ToString() const
 
 std::ostream& operator<<(std::ostream& stream, const TensorDescriptor& t)
 {
-    LogRange(stream << "{", t.lens, ", ") << "}, ";
-    LogRange(stream << "{", t.strides, ", ") << "}, ";
+    LogRange(stream << "{", t.GetLengths(), ", ") << "}, ";
+    LogRange(stream << "{", t.GetStrides(), ", ") << "}, ";
     if(t.packed)
     {
         stream << "packed"
@@ -853,8 +881,8 @@ std::ostream& operator<<(std::ostream& stream, const TensorDescriptor& t)
 void to_json(nlohmann::json& j, const TensorDescriptor& descriptor)
 {
     j = nlohmann::json{
-        {"lengths", descriptor.lens},
-        {"strides", descriptor.strides},
+        {"lengths", descriptor.GetLengths()},
+        {"strides", descriptor.GetStrides()},
         {"packed", descriptor.packed},
         {"type", descriptor.type},
     };
@@ -862,8 +890,10 @@ void to_json(nlohmann::json& j, const TensorDescriptor& descriptor)
 
 void from_json(const nlohmann::json& j, TensorDescriptor& descriptor)
 {
-    j.at("lengths").get_to(descriptor.lens);
-    j.at("strides").get_to(descriptor.strides);
+    auto shape = std::make_shared<TensorDescriptor::Shape>();
+    j.at("lengths").get_to(shape->lens);
+    j.at("strides").get_to(shape->strides);
+    descriptor.shape = std::move(shape);
     j.at("packed").get_to(descriptor.packed);
     j.at("type").get_to(descriptor.type);
 }
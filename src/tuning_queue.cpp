@@ -0,0 +1,432 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/tuning_queue.hpp>
+#include <miopen/errors.hpp>
+#include <miopen/lock_file.hpp>
+#include <miopen/logger.hpp>
+
+#include <algorithm>
+#include <condition_variable>
+#include <fstream>
+#include <mutex>
+#include <shared_mutex>
+#include <sstream>
+#include <string_view>
+#include <thread>
+
+namespace miopen {
+namespace solver {
+
+namespace {
+
+constexpr std::string_view signature = "MIOpenTuningQueue";
+constexpr int version                = 2;
+constexpr std::string_view none      = "-";
+
+std::chrono::seconds GetLockTimeout() { return std::chrono::seconds{60}; }
+
+std::int64_t Now()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+               std::chrono::system_clock::now().time_since_epoch())
+        .count();
+}
+
+constexpr const char* ToCString(TuningQueue::State state)
+{
+    switch(state)
+    {
+    case TuningQueue::State::Pending: return "pending";
+    case TuningQueue::State::Claimed: return "claimed";
+    case TuningQueue::State::Done: return "done";
+    case TuningQueue::State::Failed: return "failed";
+    }
+    return "";
+}
+
+std::optional<TuningQueue::State> ParseState(std::string_view str)
+{
+    for(const auto state : {TuningQueue::State::Pending,
+                            TuningQueue::State::Claimed,
+                            TuningQueue::State::Done,
+                            TuningQueue::State::Failed})
+    {
+        if(str == ToCString(state))
+            return state;
+    }
+    return std::nullopt;
+}
+
+/// <id> <state> <attempts> <lease end> <shard> <shards> <solver> <key> <worker> <time> <config>
+/// <problem>
+/// Missing values are written as "-". The problem takes the rest of the line, as it may contain
+/// spaces.
+void WriteEntry(std::ostream& out, const TuningQueue::Entry& entry)
+{
+    out << entry.id << ' ' << ToCString(entry.state) << ' ' << entry.attempts << ' '
+        << entry.lease_end << ' ' << entry.item.shard << ' ' << entry.item.n_shards << ' '
+        << entry.item.solver << ' ' << entry.item.key << ' '
+        << (entry.worker.empty() ? none : entry.worker) << ' ';
+    if(entry.result)
+        out << entry.result->time << ' ' << entry.result->config;
+    else
+        out << none << ' ' << none;
+    out << ' ' << (entry.item.problem.empty() ? none : entry.item.problem) << '\n';
+}
+
+std::optional<TuningQueue::Entry> ReadEntry(const std::string& line)
+{
+    auto in     = std::istringstream{line};
+    auto entry  = TuningQueue::Entry{};
+    auto state  = std::string{};
+    auto time   = std::string{};
+    auto config = std::string{};
+
+    if(!(in >> entry.id >> state >> entry.attempts >> entry.lease_end >> entry.item.shard >>
+         entry.item.n_shards >> entry.item.solver >> entry.item.key >> entry.worker >> time >>
+         config) ||
+       !std::getline(in >> std::ws, entry.item.problem))
+        return std::nullopt;
+
+    const auto parsed = ParseState(state);
+    if(!parsed)
+        return std::nullopt;
+    entry.state = *parsed;
+    if(entry.worker == none)
+        entry.worker.clear();
+    if(entry.item.problem == none)
+        entry.item.problem.clear();
+    if(time != none)
+        entry.result = TuningResult{config, std::stof(time)};
+    return entry;
+}
+
+} // namespace
+
+std::vector<TuningWorkItem> ShardTuningWork(const TuningWorkItem& item, std::size_t n_shards)
+{
+    n_shards   = std::max<std::size_t>(n_shards, 1);
+    auto items = std::vector<TuningWorkItem>(n_shards, item);
+    for(std::size_t shard = 0; shard < n_shards; ++shard)
+    {
+        items[shard].shard    = shard;
+        items[shard].n_shards = n_shards;
+    }
+    return items;
+}
+
+TuningQueue::TuningQueue(const fs::path& path_,
+                         std::chrono::milliseconds lease_,
+                         std::size_t max_attempts_)
+    : path(path_),
+      lock_file(LockFile::Get(LockFilePath(path_))),
+      lease(lease_),
+      max_attempts(std::max<std::size_t>(max_attempts_, 1))
+{
+}
+
+template <class TFunc>
+auto TuningQueue::Modify(TFunc&& func)
+{
+    const auto lock = std::unique_lock<LockFile>(lock_file, GetLockTimeout());
+    if(!lock)
+        MIOPEN_THROW("Tuning queue lock has failed to lock.");
+    auto entries   = LoadUnsafe();
+    const auto ret = func(entries);
+    SaveUnsafe(entries);
+    return ret;
+}
+
+std::vector<TuningQueue::Entry> TuningQueue::LoadUnsafe() const
+{
+    auto entries = std::vector<Entry>{};
+    auto in      = std::ifstream{path};
+    if(!in)
+        return entries;
+
+    auto line = std::string{};
+    auto sig  = std::string{};
+    auto ver  = 0;
+    if(!std::getline(in, line) || !(std::istringstream{line} >> sig >> ver) || sig != signature ||
+       ver != version)
+    {
+        MIOPEN_THROW("Unknown tuning queue: " + path.string());
+    }
+
+    while(std::getline(in, line))
+    {
+        auto entry = ReadEntry(line);
+        if(!entry)
+            MIOPEN_THROW("Corrupt tuning queue: " + path.string() + ": " + line);
+        entries.push_back(std::move(*entry));
+    }
+    return entries;
+}
+
+void TuningQueue::SaveUnsafe(const std::vector<Entry>& entries) const
+{
+    // Renaming is atomic, so the queue is never left half-written.
+    const auto tmp = fs::path{path.string() + ".tmp"};
+    {
+        auto out = std::ofstream{tmp, std::ios::trunc};
+        out << signature << ' ' << version << '\n';
+        for(const auto& entry : entries)
+            WriteEntry(out, entry);
+        if(!out)
+            MIOPEN_THROW("Failed to write tuning queue: " + tmp.string());
+    }
+    fs::rename(tmp, path);
+}
+
+void TuningQueue::ReclaimUnsafe(std::vector<Entry>& entries) const
+{
+    const auto now = Now();
+    for(auto& entry : entries)
+    {
+        if(entry.state != State::Claimed || entry.lease_end > now)
+            continue;
+
+        MIOPEN_LOG_W("Tuning of " << entry.item.solver << " " << entry.item.key << " ("
+                                  << entry.item.shard << "/" << entry.item.n_shards
+                                  << ") by worker " << entry.worker << " has timed out");
+        entry.state = entry.attempts < max_attempts ? State::Pending : State::Failed;
+    }
+}
+
+void TuningQueue::Post(const std::vector<TuningWorkItem>& items)
+{
+    if(!path.parent_path().empty())
+        fs::create_directories(path.parent_path());
+
+    Modify([&](auto& entries) {
+        auto id = entries.empty() ? std::size_t{0} : entries.back().id + 1;
+        for(const auto& item : items)
+        {
+            auto entry = Entry{};
+            entry.id   = id++;
+            entry.item = item;
+            entries.push_back(std::move(entry));
+        }
+        return true;
+    });
+}
+
+std::optional<TuningQueue::Entry> TuningQueue::Claim(const std::string& worker)
+{
+    return Modify([&](auto& entries) -> std::optional<Entry> {
+        ReclaimUnsafe(entries);
+        const auto it = std::find_if(entries.begin(), entries.end(), [](const auto& entry) {
+            return entry.state == State::Pending;
+        });
+        if(it == entries.end())
+            return std::nullopt;
+
+        it->state     = State::Claimed;
+        it->worker    = worker;
+        it->lease_end = Now() + lease.count();
+        ++it->attempts;
+        return *it;
+    });
+}
+
+bool TuningQueue::Renew(std::size_t id, const std::string& worker)
+{
+    return Modify([&](auto& entries) {
+        for(auto& entry : entries)
+        {
+            if(entry.id != id)
+                continue;
+            if(entry.state != State::Claimed || entry.worker != worker)
+                return false;
+            entry.lease_end = Now() + lease.count();
+            return true;
+        }
+        return false;
+    });
+}
+
+bool TuningQueue::Complete(std::size_t id, const std::optional<TuningResult>& result)
+{
+    return Modify([&](auto& entries) {
+        for(auto& entry : entries)
+        {
+            if(entry.id != id)
+                continue;
+            if(entry.state == State::Done)
+                return false;
+            entry.state  = State::Done;
+            entry.result = result;
+            return true;
+        }
+        return false;
+    });
+}
+
+void TuningQueue::Abandon(std::size_t id, const std::string& worker)
+{
+    Modify([&](auto& entries) {
+        for(auto& entry : entries)
+        {
+            if(entry.id != id || entry.state != State::Claimed || entry.worker != worker)
+                continue;
+            entry.state = entry.attempts < max_attempts ? State::Pending : State::Failed;
+        }
+        return true;
+    });
+}
+
+TuningQueue::Counts TuningQueue::Reclaim()
+{
+    return Modify([&](auto& entries) {
+        ReclaimUnsafe(entries);
+        auto counts = Counts{};
+        for(const auto& entry : entries)
+        {
+            switch(entry.state)
+            {
+            case State::Pending: ++counts.pending; break;
+            case State::Claimed: ++counts.claimed; break;
+            case State::Done: ++counts.done; break;
+            case State::Failed: ++counts.failed; break;
+            }
+        }
+        return counts;
+    });
+}
+
+std::vector<TuningQueue::Entry> TuningQueue::GetEntries() const
+{
+    const auto lock = std::shared_lock<LockFile>(lock_file, GetLockTimeout());
+    if(!lock)
+        MIOPEN_THROW("Tuning queue lock has failed to lock.");
+    return LoadUnsafe();
+}
+
+std::map<std::pair<std::string, std::string>, TuningQueue::Entry>
+TuningQueue::GetBestResults() const
+{
+    auto best = std::map<std::pair<std::string, std::string>, Entry>{};
+    for(auto& entry : GetEntries())
+    {
+        if(!entry.result)
+            continue;
+        const auto key = std::make_pair(entry.item.key, entry.item.solver);
+        const auto it  = best.find(key);
+        if(it == best.end() || entry.result->time < it->second.result->time)
+            best[key] = std::move(entry);
+    }
+    return best;
+}
+
+std::size_t RunTuningWorker(TuningQueue& queue,
+                            const std::string& worker,
+                            const TuningFunction& tune,
+                            std::chrono::milliseconds poll_period)
+{
+    std::size_t n_tuned = 0;
+
+    while(true)
+    {
+        const auto entry = queue.Claim(worker);
+        if(!entry)
+        {
+            // Items claimed by others may come back if the workers die.
+            if(queue.Reclaim().IsFinished())
+                break;
+            std::this_thread::sleep_for(poll_period);
+            continue;
+        }
+
+        MIOPEN_LOG_I("Worker " << worker << " is tuning " << entry->item.solver << " "
+                               << entry->item.key << " (" << entry->item.shard << "/"
+                               << entry->item.n_shards << ")");
+
+        // Keeps the lease while the item is being tuned.
+        auto mutex    = std::mutex{};
+        auto cond_var = std::condition_variable{};
+        auto done     = false;
+        auto renewer  = std::thread{[&]() {
+            auto lock = std::unique_lock<std::mutex>{mutex};
+            while(!cond_var.wait_for(lock, queue.GetLease() / 3, [&]() { return done; }))
+            {
+                if(!queue.Renew(entry->id, worker))
+                    MIOPEN_LOG_W("Worker " << worker << " has lost item " << entry->id);
+            }
+        }};
+        const auto stop_renewer = [&]() {
+            {
+                const auto lock = std::lock_guard<std::mutex>{mutex};
+                done            = true;
+            }
+            cond_var.notify_one();
+            renewer.join();
+        };
+
+        try
+        {
+            const auto result = tune(entry->item);
+            stop_renewer();
+            if(queue.Complete(entry->id, result))
+                ++n_tuned;
+        }
+        catch(const std::exception& ex)
+        {
+            stop_renewer();
+            MIOPEN_LOG_E("Worker " << worker << " has failed to tune item " << entry->id << ": "
+                                   << ex.what());
+            queue.Abandon(entry->id, worker);
+        }
+    }
+
+    return n_tuned;
+}
+
+bool WaitForTuning(TuningQueue& queue,
+                   std::chrono::milliseconds timeout,
+                   std::chrono::milliseconds poll_period)
+{
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    while(true)
+    {
+        const auto counts = queue.Reclaim();
+        if(counts.IsFinished())
+        {
+            if(counts.failed > 0)
+                MIOPEN_LOG_W(counts.failed << " tuning items have failed");
+            return true;
+        }
+        if(std::chrono::steady_clock::now() >= deadline)
+        {
+            MIOPEN_LOG_W("Tuning has timed out, " << counts.pending << " items pending, "
+                                                  << counts.claimed << " in progress");
+            return false;
+        }
+        std::this_thread::sleep_for(poll_period);
+    }
+}
+
+} // namespace solver
+} // namespace miopen
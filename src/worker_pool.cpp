@@ -0,0 +1,155 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/worker_pool.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+
+namespace miopen {
+
+struct WorkerPool::Job
+{
+    const std::function<void(std::size_t)>* f;
+    std::size_t n;
+    std::atomic<std::size_t> next{0};
+    std::atomic<std::size_t> n_done{0};
+
+    std::mutex mutex;
+    std::condition_variable done;
+    std::exception_ptr error;
+
+    Job(const std::function<void(std::size_t)>& f_, std::size_t n_) : f(&f_), n(n_) {}
+};
+
+WorkerPool::WorkerPool(std::size_t n_threads)
+{
+    threads.reserve(n_threads);
+    for(auto i = std::size_t{0}; i < n_threads; ++i)
+        threads.emplace_back([this]() { Work(); });
+}
+
+WorkerPool::~WorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stop = true;
+    }
+    has_jobs.notify_all();
+    for(auto& thread : threads)
+        thread.join();
+}
+
+void WorkerPool::Run(Job& job)
+{
+    for(auto i = job.next++; i < job.n; i = job.next++)
+    {
+        try
+        {
+            (*job.f)(i);
+        }
+        catch(...)
+        {
+            std::lock_guard<std::mutex> lock(job.mutex);
+            if(!job.error)
+                job.error = std::current_exception();
+        }
+
+        if(++job.n_done == job.n)
+        {
+            std::lock_guard<std::mutex> lock(job.mutex);
+            job.done.notify_all();
+        }
+    }
+}
+
+void WorkerPool::Work()
+{
+    while(true)
+    {
+        auto job = std::shared_ptr<Job>{};
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            has_jobs.wait(lock, [&]() { return stop || !jobs.empty(); });
+            if(stop)
+                return;
+            job = jobs.front();
+            // All the iterations are taken, so the job does not need more threads.
+            if(job->next >= job->n)
+            {
+                jobs.pop_front();
+                continue;
+            }
+        }
+        Run(*job);
+    }
+}
+
+void WorkerPool::ParallelFor(std::size_t n, const std::function<void(std::size_t)>& f)
+{
+    if(n == 0)
+        return;
+
+    if(threads.empty() || n == 1)
+    {
+        for(auto i = std::size_t{0}; i < n; ++i)
+            f(i);
+        return;
+    }
+
+    const auto job = std::make_shared<Job>(f, n);
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        jobs.push_back(job);
+    }
+    has_jobs.notify_all();
+
+    Run(*job);
+
+    {
+        std::unique_lock<std::mutex> lock(job->mutex);
+        job->done.wait(lock, [&]() { return job->n_done == job->n; });
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        const auto it = std::find(jobs.begin(), jobs.end(), job);
+        if(it != jobs.end())
+            jobs.erase(it);
+    }
+
+    if(job->error)
+        std::rethrow_exception(job->error);
+}
+
+WorkerPool& GetWorkerPool()
+{
+    static WorkerPool pool{std::max(1u, std::thread::hardware_concurrency()) - 1};
+    return pool;
+}
+
+} // namespace miopen
@@ -0,0 +1,129 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/bz2.hpp>
+#include <miopen/readonlyramdb.hpp>
+#include <miopen/tmp_dir.hpp>
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <tuple>
+
+namespace {
+
+std::string Compress(const std::string& text)
+{
+    const auto compressed = miopen::compress({text.begin(), text.end()});
+    return {compressed.begin(), compressed.end()};
+}
+
+std::string ReadAll(std::istream& stream)
+{
+    auto result = std::string{};
+    char buffer[4096];
+    while(stream.read(buffer, sizeof(buffer)) || stream.gcount() > 0)
+        result.append(buffer, stream.gcount());
+    return result;
+}
+
+std::string MakeDbText(int records)
+{
+    auto text = std::ostringstream{};
+    for(auto i = 0; i < records; ++i)
+        text << "key" << i << "=id1:" << i << ",2,3;id2:" << i * 7 << '\n';
+    return text.str();
+}
+
+} // namespace
+
+TEST(CPU_Bz2InputStream_NONE, Decompress)
+{
+    // Large enough to span several internal buffers.
+    const auto text  = MakeDbText(20000);
+    auto source      = std::istringstream{Compress(text)};
+    auto decompressed = miopen::Bz2InputStream{source};
+
+    EXPECT_EQ(ReadAll(decompressed), text);
+    EXPECT_FALSE(decompressed.bad());
+}
+
+TEST(CPU_Bz2InputStream_NONE, ConcatenatedStreams)
+{
+    const auto first  = MakeDbText(100);
+    const auto second = MakeDbText(200);
+    auto source       = std::istringstream{Compress(first) + Compress(second)};
+    auto stream       = miopen::Bz2InputStream{source};
+
+    EXPECT_EQ(ReadAll(stream), first + second);
+    EXPECT_FALSE(stream.bad());
+}
+
+TEST(CPU_Bz2InputStream_NONE, Peek)
+{
+    const auto text = "header:" + MakeDbText(100);
+    auto source     = std::istringstream{Compress(text)};
+    auto stream     = miopen::Bz2InputStream{source};
+
+    char header[6];
+    const auto start = stream.tellg();
+    ASSERT_TRUE(stream.read(header, sizeof(header)));
+    EXPECT_EQ(std::string(header, sizeof(header)), "header");
+    ASSERT_TRUE(stream.seekg(start));
+    EXPECT_EQ(ReadAll(stream), text);
+}
+
+TEST(CPU_Bz2InputStream_NONE, RejectsTruncated)
+{
+    const auto compressed = Compress(MakeDbText(100));
+    auto source           = std::istringstream{compressed.substr(0, compressed.size() / 2)};
+    auto stream           = miopen::Bz2InputStream{source};
+
+    std::ignore = ReadAll(stream);
+    EXPECT_TRUE(stream.bad());
+}
+
+TEST(CPU_Bz2InputStream_NONE, LoadCompressedReadonlyRamDb)
+{
+    const auto dir  = miopen::TmpDir{"bz2_stream"};
+    const auto path = dir / "compressed.db.txt";
+
+    {
+        auto file = std::ofstream{miopen::ReadonlyRamDb::GetCompressedPath(path), std::ios::binary};
+        file << Compress(MakeDbText(10));
+    }
+
+    miopen::ReadonlyRamDb::PrefetchAsync(miopen::DbKinds::PerfDb, path);
+    const auto& db = miopen::ReadonlyRamDb::GetCached(miopen::DbKinds::PerfDb, path, false);
+
+    const auto view = db.FindRecordView(std::string{"key7"});
+    ASSERT_TRUE(view);
+    EXPECT_EQ(view->GetValues("id2"), std::string_view{"49"});
+    EXPECT_FALSE(db.FindRecordView(std::string{"key10"}));
+}
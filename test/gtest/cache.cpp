@@ -26,6 +26,7 @@
 
 #include <miopen/binary_cache.hpp>
 #include <miopen/bz2.hpp>
+#include <miopen/env.hpp>
 #include <miopen/kern_db.hpp>
 #include <miopen/temp_file.hpp>
 #include <algorithm>
@@ -36,6 +37,8 @@
 #include <gtest/gtest.h>
 
 #if MIOPEN_ENABLE_SQLITE
+MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_CACHE_SIZE_LIMIT_MB, 0)
+
 std::vector<char> random_bytes(size_t length)
 {
     auto randchar = []() -> char {
@@ -133,6 +136,185 @@ TEST(CPU_Cache_NONE, check_kern_db)
         EXPECT_TRUE(err_db.RemoveRecordUnsafe(cfg0));
     }
 }
+
+TEST(CPU_Cache_NONE, check_kern_db_bound_keys)
+{
+    miopen::TempFile temp_file("tmp-kerndb");
+    miopen::KernDb db(miopen::DbKinds::KernelDb, temp_file, false);
+
+    std::vector<miopen::KernelConfig> cfgs(4);
+    for(std::size_t i = 0; i < cfgs.size(); ++i)
+    {
+        cfgs[i].kernel_name = "kernel" + std::to_string(i);
+        // Quotes used to break the query when keys were inlined into it
+        cfgs[i].kernel_args = "-DNAME='x' -DARG=\"" + std::to_string(i) + "\"";
+        cfgs[i].kernel_blob = random_bytes(256);
+        EXPECT_TRUE(db.StoreRecordUnsafe(cfgs[i]));
+    }
+
+    // Repeated lookups reuse prepared statements, which must not leak bindings or results
+    for(auto pass = 0; pass < 2; ++pass)
+    {
+        for(const auto& cfg : cfgs)
+        {
+            auto readout = db.FindRecordUnsafe(cfg);
+            ASSERT_TRUE(readout);
+            EXPECT_TRUE(readout.get() == cfg.kernel_blob);
+        }
+    }
+
+    auto missing        = cfgs[0];
+    missing.kernel_args = "' OR '1' = '1";
+    EXPECT_FALSE(db.FindRecordUnsafe(missing));
+
+    EXPECT_TRUE(db.RemoveRecordUnsafe(cfgs[1]));
+    EXPECT_FALSE(db.FindRecordUnsafe(cfgs[1]));
+    EXPECT_TRUE(db.FindRecordUnsafe(cfgs[2]));
+}
+
+TEST(CPU_Cache_NONE, check_kern_db_cached_statements)
+{
+    miopen::TempFile temp_file("tmp-kerndb");
+    auto& db = miopen::KernDb::GetCached(miopen::DbKinds::KernelDb, temp_file, false);
+    EXPECT_EQ(&db, &miopen::KernDb::GetCached(miopen::DbKinds::KernelDb, temp_file, false));
+
+    miopen::KernelConfig cfg;
+    cfg.kernel_name = "kernel";
+    cfg.kernel_args = "-DARG=1";
+    cfg.kernel_blob = random_bytes(256);
+    EXPECT_TRUE(db.StoreRecord(cfg));
+    ASSERT_TRUE(db.FindRecord(cfg));
+
+    // Later lookups through the cached instance take the compiled statement from its pool
+    const auto before = miopen::SQLite::GetStatementStats();
+    auto& again       = miopen::KernDb::GetCached(miopen::DbKinds::KernelDb, temp_file, false);
+    auto readout      = again.FindRecord(cfg);
+    ASSERT_TRUE(readout);
+    EXPECT_TRUE(readout.get() == cfg.kernel_blob);
+    const auto after = miopen::SQLite::GetStatementStats();
+    EXPECT_EQ(after.prepared, before.prepared);
+    EXPECT_GT(after.reused, before.reused);
+}
+
+TEST(CPU_Cache_NONE, check_kern_db_eviction)
+{
+    miopen::TempFile temp_file("tmp-kerndb");
+    miopen::KernDb db(miopen::DbKinds::KernelDb, temp_file, false);
+
+    std::vector<miopen::KernelConfig> cfgs(8);
+    for(std::size_t i = 0; i < cfgs.size(); ++i)
+    {
+        cfgs[i].kernel_name = "kernel" + std::to_string(i);
+        cfgs[i].kernel_args = "-DARG=" + std::to_string(i);
+        cfgs[i].kernel_blob = random_bytes(64 * 1024);
+        EXPECT_TRUE(db.StoreRecordUnsafe(cfgs[i]));
+    }
+
+    // Make the order of stores the order of accesses. Accesses are not recorded without a limit.
+    db.sql.Exec("UPDATE kern_db SET last_access = id;");
+    ASSERT_TRUE(db.FindRecordUnsafe(cfgs[0]));
+    EXPECT_EQ(db.sql.Exec("SELECT last_access FROM kern_db WHERE id = 1;")[0].at("last_access"),
+              "1");
+
+    // Access the oldest kernel again
+    miopen::env::update(MIOPEN_CACHE_SIZE_LIMIT_MB, 1);
+    ASSERT_TRUE(db.FindRecordUnsafe(cfgs[0]));
+    miopen::env::clear(MIOPEN_CACHE_SIZE_LIMIT_MB);
+
+    EXPECT_EQ(db.EvictUnsafe(0).records, 0);
+    EXPECT_EQ(db.EvictUnsafe(db.GetUsedBytesUnsafe()).records, 0);
+
+    const auto quota = db.GetUsedBytesUnsafe() / 2;
+    const auto stats = db.Evict(quota);
+    EXPECT_GT(stats.records, 0);
+    EXPECT_LE(db.GetUsedBytesUnsafe(), quota);
+    EXPECT_LE(miopen::fs::file_size(temp_file.Path()), quota + 64 * 1024);
+
+    EXPECT_TRUE(db.FindRecordUnsafe(cfgs[0]));
+    EXPECT_FALSE(db.FindRecordUnsafe(cfgs[1]));
+    EXPECT_TRUE(db.FindRecordUnsafe(cfgs.back()));
+}
+
+TEST(CPU_Cache_NONE, check_kern_args_normalization)
+{
+    EXPECT_EQ(miopen::NormalizeKernelArgs("  -DB=1   -O3 -D A=2 "), "-DA=2 -O3 -DB=1");
+    EXPECT_EQ(miopen::NormalizeKernelArgs("-DA=2 -O3 -DB=1"), "-DA=2 -O3 -DB=1");
+    EXPECT_EQ(miopen::NormalizeKernelArgs("-DS='a  b' -DR"), "-DR -DS='a  b'");
+    // The order of defines matters if a macro is redefined or undefined
+    EXPECT_EQ(miopen::NormalizeKernelArgs("-DB=1 -DA -DB=2"), "-DB=1 -DA -DB=2");
+    EXPECT_EQ(miopen::NormalizeKernelArgs("-DB -UB -DA"), "-DB -UB -DA");
+    EXPECT_EQ(miopen::NormalizeKernelArgs(""), "");
+}
+
+TEST(CPU_Cache_NONE, check_kern_db_dedup)
+{
+    miopen::TempFile temp_file("tmp-kerndb");
+    miopen::KernDb db(miopen::DbKinds::KernelDb, temp_file, false);
+
+    const auto blob = random_bytes(4096);
+    std::vector<miopen::KernelConfig> cfgs(3);
+    for(std::size_t i = 0; i < cfgs.size(); ++i)
+    {
+        cfgs[i].kernel_name = "kernel" + std::to_string(i);
+        cfgs[i].kernel_args = "-DB=1 -DA=" + std::to_string(i);
+        cfgs[i].kernel_blob = blob;
+        EXPECT_TRUE(db.StoreRecordUnsafe(cfgs[i]));
+    }
+
+    const auto count_blobs = [&]() {
+        return db.sql.Exec("SELECT kernel_hash FROM kern_blob;").size();
+    };
+    EXPECT_EQ(count_blobs(), 1);
+
+    // Another spelling of the same options hits the cache
+    auto respelled        = cfgs[1];
+    respelled.kernel_args = "-D A=1  -DB=1";
+    respelled.kernel_blob = {};
+    auto readout          = db.FindRecordUnsafe(respelled);
+    ASSERT_TRUE(readout);
+    EXPECT_TRUE(readout.get() == blob);
+
+    // Replacing the binary of a kernel keeps the shared one
+    auto replaced        = cfgs[2];
+    replaced.kernel_blob = random_bytes(4096);
+    EXPECT_TRUE(db.StoreRecordUnsafe(replaced));
+    EXPECT_EQ(count_blobs(), 2);
+    EXPECT_TRUE(db.FindRecordUnsafe(cfgs[2]).get() == replaced.kernel_blob);
+
+    EXPECT_TRUE(db.RemoveRecordUnsafe(cfgs[0]));
+    EXPECT_TRUE(db.RemoveRecordUnsafe(cfgs[2]));
+    EXPECT_EQ(count_blobs(), 1);
+    EXPECT_TRUE(db.FindRecordUnsafe(cfgs[1]));
+    EXPECT_TRUE(db.RemoveRecordUnsafe(respelled));
+    EXPECT_EQ(count_blobs(), 0);
+}
+
+TEST(CPU_Cache_NONE, check_kern_db_upgrade)
+{
+    miopen::TempFile temp_file("tmp-kerndb");
+
+    {
+        auto sql = miopen::SQLite{temp_file.Path(), false};
+        sql.Exec("CREATE TABLE `kern_db` (`id` INTEGER PRIMARY KEY ASC,"
+                 "`kernel_name` TEXT NOT NULL,`kernel_args` TEXT NOT NULL,"
+                 "`kernel_blob` BLOB NOT NULL,`kernel_hash` TEXT NOT NULL,"
+                 "`uncompressed_size` INT NOT NULL);"
+                 "CREATE UNIQUE INDEX `idx_kern_db` ON kern_db(kernel_name, kernel_args);");
+    }
+
+    miopen::KernelConfig cfg;
+    cfg.kernel_name = "kernel";
+    cfg.kernel_args = "args";
+    cfg.kernel_blob = random_bytes(1024);
+
+    miopen::KernDb db(miopen::DbKinds::KernelDb, temp_file, false);
+    EXPECT_TRUE(db.StoreRecordUnsafe(cfg));
+    EXPECT_TRUE(db.FindRecordUnsafe(cfg));
+
+    const auto res = db.sql.Exec("SELECT last_access FROM kern_db;");
+    ASSERT_EQ(res.size(), 1);
+    EXPECT_NE(res[0].at("last_access"), "0");
+}
 #endif
 
 TEST(CPU_Cache_NONE, check_cache_file)
@@ -0,0 +1,169 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/compile_registry.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using miopen::CompileRegistry;
+
+namespace {
+
+// Stands in for the compiler: blocks until all the requesters have arrived, so that they find
+// the build in flight.
+struct MockBuilder
+{
+    std::atomic<int>& n_builds;
+    const std::atomic<int>& n_arrived;
+    int n_requesters;
+    char value;
+
+    CompileRegistry::Binary operator()() const
+    {
+        ++n_builds;
+        while(n_arrived < n_requesters)
+            std::this_thread::yield();
+        std::this_thread::sleep_for(std::chrono::milliseconds{100});
+        return CompileRegistry::Binary(16, value);
+    }
+};
+
+} // namespace
+
+TEST(CPU_CompileRegistry_NONE, ConcurrentRequestsBuildOnce)
+{
+    constexpr auto n_threads = 8;
+    auto registry            = CompileRegistry{};
+    auto n_builds            = std::atomic<int>{0};
+    auto n_arrived           = std::atomic<int>{0};
+    auto results             = std::vector<CompileRegistry::Binary>(n_threads);
+
+    auto threads = std::vector<std::thread>{};
+    for(auto i = 0; i < n_threads; ++i)
+    {
+        threads.emplace_back([&, i]() {
+            ++n_arrived;
+            results[i] = registry.GetOrBuild(
+                "kernel.s|-mcpu=gfx90a", MockBuilder{n_builds, n_arrived, n_threads, 'a'});
+        });
+    }
+    for(auto& thread : threads)
+        thread.join();
+
+    EXPECT_EQ(n_builds, 1);
+    for(const auto& result : results)
+        EXPECT_EQ(result, CompileRegistry::Binary(16, 'a'));
+
+    const auto stats = registry.GetStats();
+    EXPECT_EQ(stats.compilations, 1u);
+    EXPECT_EQ(stats.saved_compilations, n_threads - 1u);
+}
+
+TEST(CPU_CompileRegistry_NONE, DifferentKeys)
+{
+    auto registry  = CompileRegistry{};
+    auto n_builds  = std::atomic<int>{0};
+    auto n_arrived = std::atomic<int>{1};
+
+    EXPECT_EQ(registry.GetOrBuild("a", MockBuilder{n_builds, n_arrived, 1, 'a'}),
+              CompileRegistry::Binary(16, 'a'));
+    EXPECT_EQ(registry.GetOrBuild("b", MockBuilder{n_builds, n_arrived, 1, 'b'}),
+              CompileRegistry::Binary(16, 'b'));
+    // Finished builds are left to the binary cache.
+    EXPECT_EQ(registry.GetOrBuild("a", MockBuilder{n_builds, n_arrived, 1, 'c'}),
+              CompileRegistry::Binary(16, 'c'));
+
+    EXPECT_EQ(n_builds, 3);
+    EXPECT_EQ(registry.GetStats().compilations, 3u);
+    EXPECT_EQ(registry.GetStats().saved_compilations, 0u);
+}
+
+TEST(CPU_CompileRegistry_NONE, LookupBeforeBuild)
+{
+    auto registry   = CompileRegistry{};
+    auto n_builds   = std::atomic<int>{0};
+    auto n_arrived  = std::atomic<int>{1};
+    const auto miss = []() { return CompileRegistry::Binary{}; };
+    const auto hit  = []() { return CompileRegistry::Binary(16, 'b'); };
+
+    // The requester which missed the binary cache while the build was running finds its result.
+    EXPECT_EQ(registry.GetOrBuild("a", MockBuilder{n_builds, n_arrived, 1, 'a'}, miss),
+              CompileRegistry::Binary(16, 'a'));
+    EXPECT_EQ(registry.GetOrBuild("a", MockBuilder{n_builds, n_arrived, 1, 'a'}, hit),
+              CompileRegistry::Binary(16, 'b'));
+
+    EXPECT_EQ(n_builds, 1);
+    EXPECT_EQ(registry.GetStats().compilations, 1u);
+    EXPECT_EQ(registry.GetStats().saved_compilations, 1u);
+}
+
+TEST(CPU_CompileRegistry_NONE, BuildError)
+{
+    auto registry = CompileRegistry{};
+    auto started  = std::atomic<bool>{false};
+    auto release  = std::atomic<bool>{false};
+
+    auto leader = std::thread{[&]() {
+        EXPECT_THROW(registry.GetOrBuild("a",
+                                         [&]() -> CompileRegistry::Binary {
+                                             started = true;
+                                             while(!release)
+                                                 std::this_thread::yield();
+                                             throw std::runtime_error("build failed");
+                                         }),
+                     std::runtime_error);
+    }};
+    while(!started)
+        std::this_thread::yield();
+
+    auto waiter = std::thread{[&]() {
+        EXPECT_THROW(registry.GetOrBuild("a", []() { return CompileRegistry::Binary{}; }),
+                     std::runtime_error);
+    }};
+    // Give the waiter the time to find the build in flight.
+    std::this_thread::sleep_for(std::chrono::milliseconds{100});
+    release = true;
+    leader.join();
+    waiter.join();
+
+    // A failed build is not remembered.
+    EXPECT_EQ(registry.GetOrBuild("a", []() { return CompileRegistry::Binary(1, 'a'); }),
+              CompileRegistry::Binary(1, 'a'));
+}
+
+TEST(CPU_CompileRegistry_NONE, GlobalStats)
+{
+    const auto before = miopen::GetCompileRegistry().GetStats();
+    std::ignore       = miopen::GetCompileRegistry().GetOrBuild(
+        "CPU_CompileRegistry_NONE.GlobalStats", []() { return CompileRegistry::Binary{}; });
+    EXPECT_EQ(miopen::GetCompileRegistry().GetStats().compilations, before.compilations + 1);
+}
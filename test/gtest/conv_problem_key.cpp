@@ -0,0 +1,142 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/conv/problem_description.hpp>
+#include <miopen/conv/problem_key.hpp>
+#include <miopen/invoker_cache.hpp>
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace {
+
+using miopen::conv::Direction;
+using miopen::conv::ProblemDescription;
+
+ProblemDescription MakeProblem2d(Direction direction = Direction::Forward, int stride = 1)
+{
+    const auto conv    = miopen::ConvolutionDescriptor{{1, 1}, {stride, stride}, {1, 1}};
+    const auto in      = miopen::TensorDescriptor{miopenFloat, {8, 64, 56, 56}};
+    const auto weights = miopen::TensorDescriptor{miopenFloat, {128, 64, 3, 3}};
+    const auto out     = conv.GetForwardOutputTensor(in, weights);
+    return {in, weights, out, conv, direction};
+}
+
+ProblemDescription MakeProblem3dGroup()
+{
+    const auto conv = miopen::ConvolutionDescriptor{
+        3, miopenConvolution, miopenPaddingDefault, {0, 1, 1}, {1, 2, 2}, {1, 1, 1}, {0, 0, 0}, 2};
+    const auto x = miopen::TensorDescriptor{miopenHalf, miopenTensorNDHWC, {4, 32, 8, 16, 16}};
+    const auto w = miopen::TensorDescriptor{miopenHalf, miopenTensorNDHWC, {64, 16, 1, 3, 3}};
+    const auto y = miopen::TensorDescriptor{miopenHalf, miopenTensorNDHWC, {4, 64, 8, 8, 8}};
+    return {y, w, x, conv, Direction::BackwardData};
+}
+
+std::string DbKey(const ProblemDescription& problem)
+{
+    std::ostringstream ss;
+    problem.Serialize(ss);
+    return ss.str();
+}
+
+} // namespace
+
+TEST(CPU_ConvProblemKey_NONE, Strings)
+{
+    const auto problem = MakeProblem2d();
+    EXPECT_EQ(problem.MakeNetworkConfig().ToString(),
+              "64x56x56x3x3x128x56x56x8xNCHWxFP32x1x1x1x1x1x1x1xFxDefault");
+    EXPECT_EQ(DbKey(problem), "64-56-56-3x3-128-56-56-8-1x1-1x1-1x1-0-NCHW-FP32-F");
+    EXPECT_EQ(problem.MakeKey().ToString(), problem.MakeNetworkConfig().ToString());
+    EXPECT_EQ(problem.MakeKey().ToDbKey(), DbKey(problem));
+
+    const auto problem_3d = MakeProblem3dGroup();
+    EXPECT_EQ(problem_3d.MakeNetworkConfig().ToString(),
+              "64x8x8x8x1x3x3x32x8x16x16x4xNDHWCxNDHWCxNDHWCxFP16x0x1x1x1x2x2x1x1x1x2xBxDefault");
+    EXPECT_EQ(DbKey(problem_3d),
+              "64-8-8-8-1x3x3-32-8-16-16-4-0x1x1-1x2x2-1x1x1-0-NDHWC-NDHWC-NDHWC-FP16-B_g2");
+}
+
+TEST(CPU_ConvProblemKey_NONE, CastTypes)
+{
+    auto in            = miopen::TensorDescriptor{miopenFloat, {8, 64, 56, 56}};
+    const auto weights = miopen::TensorDescriptor{miopenFloat, {128, 64, 3, 3}};
+    const auto conv    = miopen::ConvolutionDescriptor{{1, 1}, {1, 1}, {1, 1}};
+    const auto out     = conv.GetForwardOutputTensor(in, weights);
+    in.SetCastType(miopenFloat8);
+    const auto problem = ProblemDescription{in, weights, out, conv, Direction::Forward};
+
+    EXPECT_EQ(problem.MakeNetworkConfig().ToString(),
+              "64x56x56x3x3x128x56x56x8xNCHWxFP32xciFP8x1x1x1x1x1x1x1xFxDefault");
+    EXPECT_EQ(DbKey(problem), "64-56-56-3x3-128-56-56-8-1x1-1x1-1x1-0-NCHW-FP32-F_ciFP8");
+    EXPECT_NE(problem.MakeKey(), MakeProblem2d().MakeKey());
+}
+
+TEST(CPU_ConvProblemKey_NONE, Compare)
+{
+    const auto key = MakeProblem2d().MakeKey();
+    EXPECT_EQ(key, MakeProblem2d().MakeKey());
+    EXPECT_EQ(key.hash, MakeProblem2d().MakeKey().hash);
+
+    EXPECT_NE(key, MakeProblem2d(Direction::BackwardWeights).MakeKey());
+    EXPECT_NE(key, MakeProblem2d(Direction::Forward, 2).MakeKey());
+    EXPECT_NE(key, MakeProblem3dGroup().MakeKey());
+    EXPECT_NE(key.hash, MakeProblem2d(Direction::Forward, 2).MakeKey().hash);
+}
+
+TEST(CPU_ConvProblemKey_NONE, InvokerCache)
+{
+    const auto problem = MakeProblem2d();
+    const auto config  = problem.MakeNetworkConfig().ToString();
+    auto cache         = miopen::InvokerCache{};
+
+    EXPECT_FALSE(cache.Get(problem.MakeKey(), "solver"));
+
+    // Registered by the network config, looked up by the key.
+    cache.Register({config, "solver"}, [](auto&&, auto&&) {});
+    cache.SetAsFound1_0(config, "algorithm", "solver");
+
+    for(auto i = 0; i < 2; ++i)
+    {
+        const auto invoker = cache.Get(problem.MakeKey(), "solver");
+        ASSERT_TRUE(invoker);
+        const auto found = cache.GetFound1_0(problem.MakeKey(), "algorithm");
+        ASSERT_TRUE(found);
+    }
+
+    EXPECT_FALSE(cache.Get(problem.MakeKey(), "other_solver"));
+    EXPECT_FALSE(cache.GetFound1_0(problem.MakeKey(), "other_algorithm"));
+    EXPECT_FALSE(cache.Get(MakeProblem2d(Direction::BackwardData).MakeKey(), "solver"));
+
+    // The items cached by key stay valid in a moved cache.
+    static_assert(!std::is_copy_constructible_v<miopen::InvokerCache>);
+    const auto moved = std::move(cache);
+    EXPECT_TRUE(moved.Get(problem.MakeKey(), "solver"));
+}
@@ -0,0 +1,206 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/db.hpp>
+#include <miopen/db_binary.hpp>
+#include <miopen/db_index.hpp>
+#include <miopen/readonlyramdb.hpp>
+#include <miopen/tmp_dir.hpp>
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+using Records = std::vector<miopen::DbBinary::Record>;
+
+Records RoundTrip(const Records& records)
+{
+    auto stream = std::stringstream{};
+    EXPECT_TRUE(miopen::DbBinary::Write(stream, records));
+    EXPECT_TRUE(miopen::DbBinary::IsBinary(stream));
+
+    auto decoded = Records{};
+    EXPECT_TRUE(miopen::DbBinary::Read(stream, [&](std::string&& key, std::string&& content) {
+        decoded.push_back({std::move(key), std::move(content)});
+    }));
+    return decoded;
+}
+
+} // namespace
+
+TEST(CPU_DbBinary_NONE, RoundTrip)
+{
+    const auto records = Records{
+        {"1-224-224-3x3-64-112-112-1-0x0-2x2-1x1-0-NCHW-FP32-F",
+         "ConvDirect:0.0123,0,miopenConvolutionFwdAlgoDirect;"
+         "GemmFwd1x1:1.5,4096,miopenConvolutionFwdAlgoGEMM"},
+        {"3x224x224x3x3x64", "ConvAsm:16,-1,007,-0,123456789012345678901,,x"},
+        {"empty", ""},
+        {"empty values", "ConvAsm:;Other:1"},
+        {"ill-formed", "no colon;ConvAsm:1"},
+        {"trailing", "ConvAsm:1;"},
+    };
+
+    const auto decoded = RoundTrip(records);
+
+    ASSERT_EQ(decoded.size(), records.size());
+    for(std::size_t i = 0; i < records.size(); ++i)
+    {
+        EXPECT_EQ(decoded[i].key, records[i].key);
+        EXPECT_EQ(decoded[i].content, records[i].content);
+    }
+}
+
+TEST(CPU_DbBinary_NONE, RejectsMalformed)
+{
+    auto stream = std::stringstream{};
+    ASSERT_TRUE(miopen::DbBinary::Write(stream, {{"key", "ConvAsm:1,2,3"}}));
+    const auto encoded = stream.str();
+
+    const auto read = [](const std::string& data) {
+        auto input = std::istringstream{data};
+        return miopen::DbBinary::Read(input, [](std::string&&, std::string&&) {});
+    };
+
+    EXPECT_TRUE(read(encoded));
+    EXPECT_FALSE(read(encoded.substr(0, encoded.size() - 1)));
+    EXPECT_FALSE(read("key=ConvAsm:1,2,3\n"));
+
+    auto other_version = encoded;
+    other_version[8]   = 2;
+    EXPECT_FALSE(read(other_version));
+
+    // A corrupt length of an inline string fails the read instead of allocating it.
+    auto inline_string = std::stringstream{};
+    ASSERT_TRUE(miopen::DbBinary::Write(inline_string, {{"key", "ConvAsm:abc"}}));
+    auto huge_length = inline_string.str();
+    ASSERT_EQ(huge_length.substr(huge_length.size() - 4), "\x0f" "abc");
+    huge_length.resize(huge_length.size() - 4);
+    huge_length += "\x83\x80\x80\x80\x80\x80\x80\x10";
+    EXPECT_FALSE(read(huge_length));
+
+    auto text = std::istringstream{"key=ConvAsm:1,2,3\n"};
+    EXPECT_FALSE(miopen::DbBinary::IsBinary(text));
+    EXPECT_EQ(text.tellg(), 0);
+}
+
+TEST(CPU_DbBinary_NONE, ConvertAndLoad)
+{
+    const auto dir    = miopen::TmpDir{"db_binary"};
+    const auto text   = dir / "test.fdb.txt";
+    const auto binary = dir / "binary.fdb.txt";
+
+    {
+        auto file = std::ofstream{text};
+        file << "key1=ConvDirect:0.5,0,miopenConvolutionFwdAlgoDirect\n"
+                "ill-formed line\n"
+                "key2=ConvAsm:1,2,3;GemmFwd1x1:0.25,64,miopenConvolutionFwdAlgoGEMM\n"
+                "key1=ConvDirect:duplicate\n";
+    }
+
+    ASSERT_TRUE(miopen::DbBinary::Convert(text, binary));
+    ASSERT_TRUE(miopen::DbBinary::IsBinary(binary));
+    EXPECT_FALSE(miopen::DbBinary::IsBinary(text));
+    EXPECT_LT(miopen::fs::file_size(binary), miopen::fs::file_size(text));
+
+    using miopen::ReadonlyRamDb;
+    const auto& from_text   = ReadonlyRamDb::GetCached(miopen::DbKinds::FindDb, text, false);
+    const auto& from_binary = ReadonlyRamDb::GetCached(miopen::DbKinds::FindDb, binary, false);
+
+    for(const auto key : {"key1", "key2", "key3"})
+    {
+        const auto expected = from_text.FindRecordView(std::string{key});
+        const auto actual   = from_binary.FindRecordView(std::string{key});
+        ASSERT_EQ(static_cast<bool>(actual), static_cast<bool>(expected)) << key;
+        if(expected)
+            EXPECT_EQ(actual->GetContents(), expected->GetContents()) << key;
+    }
+}
+
+TEST(CPU_DbBinary_NONE, IndexFromBinary)
+{
+    const auto dir    = miopen::TmpDir{"db_binary"};
+    const auto text   = dir / "test.db.txt";
+    const auto binary = dir / "binary.db.txt";
+
+    {
+        auto file = std::ofstream{text};
+        file << "key1=ConvAsm:1,2,3\n"
+                "key2=ConvDirect:0.5,0,miopenConvolutionFwdAlgoDirect\n"
+                "key1=ConvAsm:duplicate\n";
+    }
+
+    ASSERT_TRUE(miopen::DbBinary::Convert(text, binary));
+
+    const auto text_index   = dir / "text.idx";
+    const auto binary_index = dir / "binary.idx";
+    ASSERT_TRUE(miopen::DbIndex::Build(text, text_index));
+    ASSERT_TRUE(miopen::DbIndex::Build(binary, binary_index));
+
+    const auto from_text =
+        miopen::DbIndex::Open(text_index, miopen::DbIndex::SourceStamp::Get(text));
+    const auto from_binary =
+        miopen::DbIndex::Open(binary_index, miopen::DbIndex::SourceStamp::Get(binary));
+    ASSERT_TRUE(from_text);
+    ASSERT_TRUE(from_binary);
+    EXPECT_EQ(from_binary->Size(), from_text->Size());
+
+    for(const auto key : {"key1", "key2", "key3"})
+    {
+        const auto expected = from_text->Find(key);
+        const auto actual   = from_binary->Find(key);
+        ASSERT_EQ(static_cast<bool>(actual), static_cast<bool>(expected)) << key;
+        if(expected)
+            EXPECT_EQ(actual->content, expected->content) << key;
+    }
+}
+
+TEST(CPU_DbBinary_NONE, UserDbRejectsBinary)
+{
+    const auto dir    = miopen::TmpDir{"db_binary"};
+    const auto text   = dir / "test.ufdb.txt";
+    const auto binary = dir / "binary.ufdb.txt";
+
+    {
+        auto file = std::ofstream{text};
+        file << "key1=ConvAsm:1,2,3\n";
+    }
+
+    ASSERT_TRUE(miopen::DbBinary::Convert(text, binary));
+    const auto size = miopen::fs::file_size(binary);
+
+    auto db = miopen::PlainTextDb{miopen::DbKinds::FindDb, binary, false};
+    EXPECT_FALSE(db.FindRecord(std::string{"key1"}));
+    EXPECT_FALSE(db.RemoveRecord(std::string{"key1"}));
+
+    EXPECT_TRUE(miopen::DbBinary::IsBinary(binary));
+    EXPECT_EQ(miopen::fs::file_size(binary), size);
+}
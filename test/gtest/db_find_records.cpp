@@ -0,0 +1,219 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/config.hpp>
+#include <miopen/db.hpp>
+#include <miopen/ramdb.hpp>
+#include <miopen/readonlyramdb.hpp>
+#include <miopen/tmp_dir.hpp>
+#if MIOPEN_ENABLE_SQLITE
+#include <miopen/conv/problem_description.hpp>
+#include <miopen/sqlite_db.hpp>
+#endif
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+void WriteTextDb(const miopen::fs::path& path, const std::string& contents)
+{
+    auto file = std::ofstream{path};
+    file << contents;
+}
+
+struct TestValue
+{
+    std::string value;
+
+    void Serialize(std::ostream& stream) const { stream << value; }
+
+    bool Deserialize(const std::string& str)
+    {
+        value = str;
+        return true;
+    }
+};
+
+std::string GetValue(const boost::optional<miopen::DbRecord>& record, const std::string& id)
+{
+    auto value = TestValue{};
+    if(!record || !record->GetValues(id, value))
+        return "<none>";
+    return value.value;
+}
+
+const auto keys = std::vector<std::string>{"key2", "key3", "key1", "key2"};
+
+template <class TDb>
+void CheckRecords(TDb& db)
+{
+    const auto records = db.FindRecords(keys);
+
+    ASSERT_EQ(records.size(), keys.size());
+    EXPECT_EQ(GetValue(records[0], "id2"), "2");
+    EXPECT_FALSE(records[1]);
+    EXPECT_EQ(GetValue(records[2], "id1"), "1");
+    EXPECT_EQ(GetValue(records[3], "id2"), "2");
+    EXPECT_TRUE(db.FindRecords(std::vector<std::string>{}).empty());
+}
+
+} // namespace
+
+TEST(CPU_DbFindRecords_NONE, PlainTextDb)
+{
+    const auto dir  = miopen::TmpDir{"db_find_records"};
+    const auto path = dir / "test.udb.txt";
+    WriteTextDb(path, "key1=id1:1\nkey2=id2:2\nkey1=id1:duplicate\n");
+
+    auto db = miopen::PlainTextDb{miopen::DbKinds::PerfDb, path};
+    CheckRecords(db);
+}
+
+TEST(CPU_DbFindRecords_NONE, RamDb)
+{
+    const auto dir  = miopen::TmpDir{"db_find_records"};
+    const auto path = dir / "test.udb.txt";
+    WriteTextDb(path, "key1=id1:1\nkey2=id2:2\n");
+
+    CheckRecords(miopen::RamDb::GetCached(miopen::DbKinds::PerfDb, path, false));
+}
+
+TEST(CPU_DbFindRecords_NONE, ReadonlyRamDb)
+{
+    const auto dir  = miopen::TmpDir{"db_find_records"};
+    const auto path = dir / "test.db.txt";
+    WriteTextDb(path, "key1=id1:1\nkey2=id2:2\n");
+
+    CheckRecords(miopen::ReadonlyRamDb::GetCached(miopen::DbKinds::PerfDb, path, false));
+}
+
+TEST(CPU_DbFindRecords_NONE, MultiFileDb)
+{
+    const auto dir       = miopen::TmpDir{"db_find_records"};
+    const auto installed = dir / "test.db.txt";
+    const auto user      = dir / "test.udb.txt";
+    WriteTextDb(installed, "key1=id1:1;id2:installed\nkey2=id2:2\n");
+    WriteTextDb(user, "key1=id2:user\nkey3=id3:3\n");
+
+    const auto problems = std::vector<std::string>{"key1", "key2", "key3", "key4"};
+
+    {
+        auto db = miopen::MultiFileDb<miopen::ReadonlyRamDb, miopen::RamDb, true>{
+            miopen::DbKinds::PerfDb, installed, user};
+        const auto records = db.FindRecords(problems);
+
+        ASSERT_EQ(records.size(), problems.size());
+        EXPECT_EQ(GetValue(records[0], "id1"), "1");
+        EXPECT_EQ(GetValue(records[0], "id2"), "user");
+        EXPECT_EQ(GetValue(records[1], "id2"), "2");
+        EXPECT_EQ(GetValue(records[2], "id3"), "3");
+        EXPECT_FALSE(records[3]);
+    }
+
+    {
+        auto db = miopen::MultiFileDb<miopen::ReadonlyRamDb, miopen::RamDb, false>{
+            miopen::DbKinds::PerfDb, installed, user};
+        const auto records = db.FindRecords(problems);
+
+        ASSERT_EQ(records.size(), problems.size());
+        EXPECT_EQ(GetValue(records[0], "id1"), "<none>");
+        EXPECT_EQ(GetValue(records[0], "id2"), "user");
+        EXPECT_EQ(GetValue(records[1], "id2"), "2");
+        EXPECT_EQ(GetValue(records[2], "id3"), "3");
+        EXPECT_FALSE(records[3]);
+    }
+}
+
+#if MIOPEN_ENABLE_SQLITE
+namespace {
+
+miopen::conv::ProblemDescription MakeConvProblem(int batch)
+{
+    const auto in      = miopen::TensorDescriptor{miopenFloat, {batch, 16, 8, 8}};
+    const auto weights = miopen::TensorDescriptor{miopenFloat, {32, 16, 3, 3}};
+    const auto out     = miopen::TensorDescriptor{miopenFloat, {batch, 32, 6, 6}};
+    const auto conv    = miopen::ConvolutionDescriptor{{0, 0}, {1, 1}, {1, 1}};
+    return {in, weights, out, conv, miopen::conv::Direction::Forward};
+}
+
+} // namespace
+
+TEST(CPU_DbFindRecords_NONE, SQLitePerfDb)
+{
+    const auto dir  = miopen::TmpDir{"db_find_records"};
+    const auto path = dir / "test.udb";
+
+    // More than a batch, so the last one is partial. Every third problem is missing.
+    constexpr auto num_problems = 20;
+    auto problems               = std::vector<miopen::conv::ProblemDescription>{};
+    auto user                   = miopen::SQLitePerfDb{miopen::DbKinds::PerfDb, path, false};
+
+    for(auto i = 0; i < num_problems; ++i)
+    {
+        problems.push_back(MakeConvProblem(i + 1));
+        if(i % 3 != 1)
+            ASSERT_TRUE(user.Update(problems.back(), "id1", TestValue{std::to_string(i)}));
+    }
+    ASSERT_TRUE(user.Update(problems[0], "id2", TestValue{"second"}));
+    problems.push_back(problems[2]);
+
+    const auto check = [&](const std::vector<boost::optional<miopen::DbRecord>>& records) {
+        ASSERT_EQ(records.size(), problems.size());
+        for(auto i = 0; i < num_problems; ++i)
+        {
+            if(i % 3 != 1)
+                EXPECT_EQ(GetValue(records[i], "id1"), std::to_string(i));
+            else
+                EXPECT_FALSE(records[i]);
+        }
+        EXPECT_EQ(GetValue(records[0], "id2"), "second");
+        EXPECT_EQ(GetValue(records[num_problems], "id1"), "2");
+    };
+
+    check(user.FindRecords(problems));
+    EXPECT_TRUE(user.FindRecords(std::vector<miopen::conv::ProblemDescription>{}).empty());
+
+    // A system db keeps the records it has looked up in batches, so they are not queried again.
+    auto installed = miopen::SQLitePerfDb{miopen::DbKinds::PerfDb, path, true};
+    check(installed.FindRecords(problems));
+
+    ASSERT_TRUE(user.Update(problems[0], "id1", TestValue{"changed"}));
+    ASSERT_TRUE(user.Update(problems[1], "id1", TestValue{"added"}));
+    const auto other = MakeConvProblem(num_problems + 1);
+    ASSERT_TRUE(user.Update(other, "id1", TestValue{"other"}));
+
+    EXPECT_EQ(GetValue(installed.FindRecord(problems[0]), "id1"), "0");
+    EXPECT_FALSE(installed.FindRecord(problems[1]));
+    EXPECT_EQ(GetValue(installed.FindRecord(other), "id1"), "other");
+
+    // User dbs are always queried.
+    EXPECT_EQ(GetValue(user.FindRecord(problems[0]), "id1"), "changed");
+}
+#endif
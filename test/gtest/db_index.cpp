@@ -0,0 +1,135 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/db_index.hpp>
+#include <miopen/tmp_dir.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+
+namespace {
+
+void WriteTextDb(const miopen::fs::path& path, const std::string& contents)
+{
+    auto file = std::ofstream{path};
+    file << contents;
+}
+
+} // namespace
+
+TEST(CPU_DbIndex_NONE, BuildAndFind)
+{
+    const auto dir    = miopen::TmpDir{"db_index"};
+    const auto source = dir / "test.fdb.txt";
+    const auto index  = dir / "test.fdb.txt.idx";
+
+    WriteTextDb(source,
+                "key1=id1:1,2,3;id2:4,5\n"
+                "\n"
+                "ill-formed line\n"
+                "key2=id3:6\n"
+                "key1=id1:duplicate\n");
+
+    ASSERT_TRUE(miopen::DbIndex::Build(source, index));
+
+    const auto db = miopen::DbIndex::Open(index, miopen::DbIndex::SourceStamp::Get(source));
+    ASSERT_TRUE(db);
+    EXPECT_EQ(db->Size(), 2);
+
+    const auto key1 = db->Find("key1");
+    ASSERT_TRUE(key1);
+    EXPECT_EQ(key1->content, "id1:1,2,3;id2:4,5");
+    EXPECT_EQ(key1->line, 1);
+
+    const auto key2 = db->Find("key2");
+    ASSERT_TRUE(key2);
+    EXPECT_EQ(key2->content, "id3:6");
+    EXPECT_EQ(key2->line, 4);
+
+    EXPECT_FALSE(db->Find("key3"));
+    EXPECT_FALSE(db->Find(""));
+
+    auto visited = 0;
+    db->ForEach([&](const miopen::DbIndex::Item& item) {
+        EXPECT_TRUE(item.key == "key1" || item.key == "key2");
+        ++visited;
+    });
+    EXPECT_EQ(visited, 2);
+}
+
+TEST(CPU_DbIndex_NONE, RejectsOutdatedIndex)
+{
+    const auto dir    = miopen::TmpDir{"db_index"};
+    const auto source = dir / "test.db.txt";
+    const auto index  = dir / "test.db.txt.idx";
+
+    WriteTextDb(source, "key1=id1:1\n");
+    ASSERT_TRUE(miopen::DbIndex::Build(source, index));
+
+    WriteTextDb(source, "key1=id1:1\nkey2=id2:2\n");
+    EXPECT_FALSE(miopen::DbIndex::Open(index, miopen::DbIndex::SourceStamp::Get(source)));
+}
+
+TEST(CPU_DbIndex_NONE, RejectsCorruptIndex)
+{
+    const auto dir   = miopen::TmpDir{"db_index"};
+    const auto index = dir / "corrupt.idx";
+
+    WriteTextDb(index, "this is not an index");
+    EXPECT_FALSE(miopen::DbIndex::Open(index, std::nullopt));
+    EXPECT_FALSE(miopen::DbIndex::Open(dir / "missing.idx", std::nullopt));
+}
+
+TEST(CPU_DbIndex_NONE, RejectsOutOfBoundsEntries)
+{
+    const auto dir    = miopen::TmpDir{"db_index"};
+    const auto source = dir / "test.db.txt";
+    const auto index  = dir / "test.db.txt.idx";
+
+    WriteTextDb(source, "key1=id1:1\nkey2=id2:2\n");
+    ASSERT_TRUE(miopen::DbIndex::Build(source, index));
+    ASSERT_TRUE(miopen::DbIndex::Open(index, std::nullopt));
+
+    const auto size = miopen::fs::file_size(index);
+
+    // Truncating the blob leaves the entries pointing past the end of the file.
+    miopen::fs::resize_file(index, size - 1);
+    EXPECT_FALSE(miopen::DbIndex::Open(index, std::nullopt));
+
+    // The header is intact, but the key of the first entry points past the blob.
+    ASSERT_TRUE(miopen::DbIndex::Build(source, index));
+    {
+        // Header is 64 bytes, Entry::key_offset follows the 8 bytes of Entry::hash.
+        auto file = std::fstream{index, std::ios::binary | std::ios::in | std::ios::out};
+        const auto offset = std::uint64_t{1} << 40;
+        file.seekp(64 + 8);
+        file.write(reinterpret_cast<const char*>(&offset), sizeof(offset));
+    }
+    EXPECT_FALSE(miopen::DbIndex::Open(index, std::nullopt));
+}
@@ -0,0 +1,96 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/db_nearest.hpp>
+#include <miopen/db_record.hpp>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+using miopen::NearestRecords;
+using miopen::ProblemKeyFeatures;
+
+TEST(CPU_DbNearest_NONE, Distance)
+{
+    const auto features = ProblemKeyFeatures{"2x64x56x56x1x3x3x1x64x32x1x1x0xNCHWxFP32xF"};
+
+    EXPECT_EQ(features.Distance("2x64x56x56x1x3x3x1x64x32x1x1x0xNCHWxFP32xF"), 0.0f);
+
+    // Batch 16 is as far from 32 as 64 is.
+    const auto smaller = features.Distance("2x64x56x56x1x3x3x1x64x16x1x1x0xNCHWxFP32xF");
+    const auto larger  = features.Distance("2x64x56x56x1x3x3x1x64x64x1x1x0xNCHWxFP32xF");
+    ASSERT_TRUE(smaller && larger);
+    EXPECT_NEAR(*smaller, *larger, 0.05f);
+    EXPECT_LT(*larger, *features.Distance("2x64x56x56x1x3x3x1x64x256x1x1x0xNCHWxFP32xF"));
+
+    // Other data type, direction, or number of fields.
+    EXPECT_FALSE(features.Distance("2x64x56x56x1x3x3x1x64x32x1x1x0xNCHWxFP16xF"));
+    EXPECT_FALSE(features.Distance("2x64x56x56x1x3x3x1x64x32x1x1x0xNCHWxFP32xB"));
+    EXPECT_FALSE(features.Distance("2x64x56x56x1x3x3x1x64x32x1x1xNCHWxFP32xF"));
+    EXPECT_FALSE(features.Distance("2x64x56x56x1x3x3x1x64x32x1x1x0xNCHWxFP32xFx1"));
+    EXPECT_FALSE(features.Distance(""));
+}
+
+TEST(CPU_DbNearest_NONE, NearestRecords)
+{
+    const auto records = std::vector<std::pair<std::string, std::string>>{
+        {"64x56x56x32xNCHWxF", "ConvSolver:exact"},
+        {"64x56x56x64xNCHWxF", "ConvSolver:batch64;Other:x"},
+        {"64x56x56x16xNCHWxF", "ConvSolver:batch16"},
+        {"64x56x56x1024xNCHWxF", "ConvSolver:batch1024"},
+        {"64x28x28x32xNCHWxF", "ConvSolver:batch64"},
+        {"64x56x56x33xNCHWxF", "Other:close"},
+        {"64x56x56x32xNHWCxF", "ConvSolver:nhwc"},
+    };
+
+    auto nearest = NearestRecords{"64x56x56x32xNCHWxF", "ConvSolver", 3};
+    auto index   = miopen::NearestIndex{};
+    for(const auto& [key, contents] : records)
+    {
+        nearest.Visit(miopen::DbRecordView{key, contents});
+        index.Add(miopen::DbRecordView{key, contents});
+    }
+
+    // The key itself, other solvers and other layouts are skipped, equal values come once.
+    const auto values = nearest.GetValues();
+    EXPECT_EQ(values, (std::vector<std::string>{"batch16", "batch64"}));
+
+    // The index yields the same.
+    auto indexed = NearestRecords{"64x56x56x32xNCHWxF", "ConvSolver", 3};
+    indexed.Visit(index);
+    EXPECT_EQ(indexed.GetValues(), values);
+
+    auto other_solver = NearestRecords{"64x56x56x32xNCHWxF", "Other", 3};
+    other_solver.Visit(index);
+    EXPECT_EQ(other_solver.GetValues(), (std::vector<std::string>{"close", "x"}));
+
+    auto none = NearestRecords{"64x56x56x32xNCHWxF", "ConvSolver", 0};
+    for(const auto& [key, contents] : records)
+        none.Visit(miopen::DbRecordView{key, contents});
+    EXPECT_TRUE(none.GetValues().empty());
+}
@@ -0,0 +1,127 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/db_record.hpp>
+#include <miopen/ramdb.hpp>
+#include <miopen/readonlyramdb.hpp>
+#include <miopen/tmp_dir.hpp>
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct TestValue
+{
+    std::string value;
+
+    void Serialize(std::ostream& stream) const { stream << value; }
+
+    bool Deserialize(const std::string& str)
+    {
+        if(str.empty())
+            return false;
+        value = str;
+        return true;
+    }
+};
+
+} // namespace
+
+TEST(CPU_DbRecordView_NONE, GetValues)
+{
+    const auto view = miopen::DbRecordView{"key", "id1:1,2;id12:3;id2:;bad;id1:dup"};
+
+    EXPECT_EQ(view.GetKey(), "key");
+    EXPECT_EQ(view.GetValues("id1"), std::string_view{"1,2"});
+    EXPECT_EQ(view.GetValues("id12"), std::string_view{"3"});
+    EXPECT_EQ(view.GetValues("id2"), std::string_view{""});
+    EXPECT_FALSE(view.GetValues("id"));
+    EXPECT_FALSE(view.GetValues("bad"));
+    EXPECT_FALSE(view.GetValues("id3"));
+
+    auto value = TestValue{};
+    EXPECT_TRUE(view.GetValues("id12", value));
+    EXPECT_EQ(value.value, "3");
+    EXPECT_FALSE(view.GetValues("id2", value));
+}
+
+TEST(CPU_DbRecordView_NONE, ForEach)
+{
+    const auto view = miopen::DbRecordView{"key", "id1:1;;bad;id2:2"};
+    auto items      = std::vector<std::pair<std::string, std::string>>{};
+
+    view.ForEach([&](std::string_view id, std::string_view values) {
+        items.emplace_back(id, values);
+    });
+
+    ASSERT_EQ(items.size(), 2);
+    EXPECT_EQ(items[0], std::make_pair(std::string{"id1"}, std::string{"1"}));
+    EXPECT_EQ(items[1], std::make_pair(std::string{"id2"}, std::string{"2"}));
+}
+
+TEST(CPU_DbRecordView_NONE, LoadFromReadonlyRamDb)
+{
+    const auto dir  = miopen::TmpDir{"db_record_view"};
+    const auto path = dir / "test.db.txt";
+
+    {
+        auto file = std::ofstream{path};
+        file << "key1=id1:value1;id2:value2\n";
+    }
+
+    const auto& db = miopen::ReadonlyRamDb::GetCached(miopen::DbKinds::PerfDb, path, false);
+    auto value     = TestValue{};
+
+    EXPECT_TRUE(db.Load(std::string{"key1"}, "id2", value));
+    EXPECT_EQ(value.value, "value2");
+    EXPECT_FALSE(db.Load(std::string{"key1"}, "id3", value));
+    EXPECT_FALSE(db.Load(std::string{"key2"}, "id1", value));
+
+    const auto view = db.FindRecordView(std::string{"key1"});
+    ASSERT_TRUE(view);
+    EXPECT_EQ(view->GetKey(), "key1");
+    EXPECT_EQ(view->GetContents(), "id1:value1;id2:value2");
+}
+
+TEST(CPU_DbRecordView_NONE, LoadFromRamDb)
+{
+    const auto dir = miopen::TmpDir{"db_record_view"};
+    auto& db       = miopen::RamDb::GetCached(miopen::DbKinds::PerfDb, dir / "test.udb.txt", false);
+
+    auto record = miopen::DbRecord{miopen::DbKinds::PerfDb, std::string{"key1"}};
+    record.SetValues("id1", TestValue{"value1"});
+    ASSERT_TRUE(db.StoreRecord(record));
+
+    auto value = TestValue{};
+    EXPECT_TRUE(db.Load(std::string{"key1"}, "id1", value));
+    EXPECT_EQ(value.value, "value1");
+    EXPECT_FALSE(db.Load(std::string{"key1"}, "id2", value));
+    EXPECT_FALSE(db.Load(std::string{"key2"}, "id1", value));
+}
@@ -32,6 +32,7 @@
 #include <miopen/execution_context.hpp>
 
 #include <miopen/find_db.hpp>
+#include <miopen/kern_db.hpp>
 #include <miopen/tensor.hpp>
 #include <miopen/conv/problem_description.hpp>
 #include <miopen/conv_algo_name.hpp>
@@ -427,7 +428,9 @@ bool CheckKDBObjects(const fs::path& filename,
                      const std::string& kernel_args)
 {
     static const auto kdb_cache = LoadKDBObjects(filename);
-    return kdb_cache.find(KDBKey{kernel_name, kernel_args}) != kdb_cache.end();
+    // Kernels cached by newer versions are keyed with normalized args
+    return kdb_cache.find(KDBKey{kernel_name, kernel_args}) != kdb_cache.end() ||
+           kdb_cache.find(KDBKey{kernel_name, NormalizeKernelArgs(kernel_args)}) != kdb_cache.end();
 }
 
 bool CheckKDBForTargetID(const fs::path& filename)
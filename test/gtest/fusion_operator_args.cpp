@@ -0,0 +1,58 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/fusion.hpp>
+#include <miopen/fusion/fusion_invoke_params.hpp>
+
+#include <gtest/gtest.h>
+
+using miopen::OperatorArgs;
+using miopen::fusion::BiasOpInvokeParam;
+using miopen::fusion::ConvolutionOpInvokeParam;
+
+TEST(CPU_FusionOperatorArgs_NONE, ReusesSlots)
+{
+    auto args          = OperatorArgs{};
+    const auto weights = reinterpret_cast<ConstData_t>(0x100);
+    const auto bias    = reinterpret_cast<ConstData_t>(0x200);
+
+    args.EmplaceArg<BiasOpInvokeParam>(1, bias);
+    args.EmplaceArg<ConvolutionOpInvokeParam>(0, 1.0f, 0.0f, weights);
+    ASSERT_EQ(args.params.size(), std::size_t{2});
+    const auto* const conv = args.params[0].get();
+
+    // Same type in the slot: the object is updated in place.
+    args.EmplaceArg<ConvolutionOpInvokeParam>(0, 2.0f, 1.0f, bias);
+    ASSERT_EQ(args.params[0].get(), conv);
+    const auto& conv_args = dynamic_cast<const ConvolutionOpInvokeParam&>(*args.params[0]);
+    EXPECT_EQ(conv_args.alpha, 2.0f);
+    EXPECT_EQ(conv_args.beta, 1.0f);
+    EXPECT_EQ(conv_args.weights, bias);
+
+    // Another type in the slot: the object is replaced.
+    args.EmplaceArg<ConvolutionOpInvokeParam>(1, 1.0f, 0.0f, weights);
+    EXPECT_NE(dynamic_cast<const ConvolutionOpInvokeParam*>(args.params[1].get()), nullptr);
+}
@@ -0,0 +1,149 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/generic_search_checkpoint.hpp>
+#include <miopen/tmp_dir.hpp>
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <future>
+#include <string>
+
+using miopen::solver::TuningCheckpoint;
+
+TEST(CPU_GenericSearchCheckpoint_NONE, Resume)
+{
+    const auto dir  = miopen::TmpDir{"generic_search_checkpoint"};
+    const auto path = dir / "tuning" / "checkpoint.txt";
+
+    {
+        auto checkpoint = TuningCheckpoint{path, "ConvSolver 1x2x3"};
+        EXPECT_TRUE(checkpoint.IsEnabled());
+        EXPECT_FALSE(checkpoint.GetSeed());
+        EXPECT_TRUE(checkpoint.Resume(42, 100, "RANDOM").empty());
+        checkpoint.Record("16,4,1", 0.125f);
+        checkpoint.Record("32,4,1", std::nullopt);
+        checkpoint.Record("8,2,0", 0.3333333f);
+        // Killed by now.
+    }
+
+    {
+        auto checkpoint = TuningCheckpoint{path, "ConvSolver 1x2x3"};
+        EXPECT_EQ(checkpoint.GetSeed(), 42);
+
+        const auto measurements = checkpoint.Resume(42, 100, "RANDOM");
+        ASSERT_EQ(measurements.size(), 3);
+        EXPECT_EQ(measurements[0].config, "16,4,1");
+        EXPECT_EQ(measurements[0].time, 0.125f);
+        EXPECT_EQ(measurements[1].config, "32,4,1");
+        EXPECT_FALSE(measurements[1].time);
+        EXPECT_EQ(measurements[2].config, "8,2,0");
+        EXPECT_EQ(measurements[2].time, 0.3333333f);
+
+        // Only the measurements recorded again are kept.
+        checkpoint.Record(measurements[2].config, measurements[2].time);
+    }
+
+    {
+        auto checkpoint         = TuningCheckpoint{path, "ConvSolver 1x2x3"};
+        const auto measurements = checkpoint.Resume(42, 100, "RANDOM");
+        ASSERT_EQ(measurements.size(), 1);
+        EXPECT_EQ(measurements[0].config, "8,2,0");
+        checkpoint.Finish();
+    }
+
+    EXPECT_FALSE(miopen::fs::exists(path));
+}
+
+TEST(CPU_GenericSearchCheckpoint_NONE, Mismatch)
+{
+    const auto dir  = miopen::TmpDir{"generic_search_checkpoint"};
+    const auto path = dir / "checkpoint.txt";
+
+    {
+        auto checkpoint = TuningCheckpoint{path, "ConvSolver 1x2x3"};
+        std::ignore     = checkpoint.Resume(42, 100, "RANDOM");
+        checkpoint.Record("16,4,1", 0.125f);
+    }
+
+    // Another problem.
+    EXPECT_FALSE(TuningCheckpoint(path, "ConvSolver 1x2x4").GetSeed());
+    // Another set of configs.
+    EXPECT_TRUE(TuningCheckpoint(path, "ConvSolver 1x2x3").Resume(42, 99, "RANDOM").empty());
+    // The file has been rewritten by the previous attempt.
+    EXPECT_TRUE(TuningCheckpoint(path, "ConvSolver 1x2x3").Resume(42, 99, "RANDOM").empty());
+}
+
+TEST(CPU_GenericSearchCheckpoint_NONE, IncompleteLine)
+{
+    const auto dir  = miopen::TmpDir{"generic_search_checkpoint"};
+    const auto path = dir / "checkpoint.txt";
+
+    {
+        auto file = std::ofstream{path};
+        file << "MIOpenTuningCheckpoint 1\n"
+                "ConvSolver 1x2x3\n"
+                "7 10 BAYES\n"
+                "0.5 1,2\n"
+                "0.2";
+    }
+
+    auto checkpoint         = TuningCheckpoint{path, "ConvSolver 1x2x3"};
+    const auto measurements = checkpoint.Resume(7, 10, "BAYES");
+    ASSERT_EQ(measurements.size(), 1);
+    EXPECT_EQ(measurements[0].config, "1,2");
+    EXPECT_EQ(measurements[0].time, 0.5f);
+}
+
+TEST(CPU_GenericSearchCheckpoint_NONE, Locked)
+{
+    const auto dir  = miopen::TmpDir{"generic_search_checkpoint"};
+    const auto path = dir / "checkpoint.txt";
+
+    auto owner  = TuningCheckpoint{path, "ConvSolver 1x2x3"};
+    std::ignore = owner.Resume(42, 100, "RANDOM");
+    owner.Record("16,4,1", 0.125f);
+
+    // Another session of the same problem neither reads, rewrites nor removes the file.
+    const auto other = [&]() {
+        auto checkpoint    = TuningCheckpoint{path, "ConvSolver 1x2x3"};
+        const auto enabled = checkpoint.IsEnabled();
+        EXPECT_TRUE(checkpoint.Resume(42, 100, "RANDOM").empty());
+        checkpoint.Record("32,4,1", 0.5f);
+        checkpoint.Finish();
+        return enabled;
+    };
+    EXPECT_FALSE(std::async(std::launch::async, other).get());
+    ASSERT_TRUE(miopen::fs::exists(path));
+
+    owner.Record("8,2,0", 0.25f);
+    owner.Finish();
+    EXPECT_FALSE(miopen::fs::exists(path));
+
+    // Released once finished.
+    EXPECT_TRUE(std::async(std::launch::async, other).get());
+}
@@ -0,0 +1,419 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/generic_search.hpp>
+#include <miopen/generic_search_controls.hpp>
+#include <miopen/generic_search_strategy.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace {
+
+using miopen::solver::SearchStrategyKind;
+
+/// A grid of configs shaped like a typical tuning space: powers of two, small integer ranges
+/// and a categorical field, with part of the grid invalid. The objective is smooth with a bit
+/// of ruggedness so that greedy descent alone is not enough.
+struct SyntheticSpace
+{
+    std::vector<std::string> configs;
+    std::vector<float> times;
+
+    SyntheticSpace()
+    {
+        const std::string kinds[] = {"NN", "NT", "TN"};
+
+        for(int a = 1; a <= 256; a *= 2)
+            for(int b = 1; b <= 16; ++b)
+                for(int c = 0; c < 10; ++c)
+                    for(int k = 0; k < 3; ++k)
+                    {
+                        if(a * b > 2048)
+                            continue;
+                        configs.push_back(std::to_string(a) + "," + std::to_string(b) + "," +
+                                          std::to_string(c) + "," + kinds[k]);
+
+                        const auto la = std::log2(static_cast<double>(a));
+                        const auto t  = 1.0 + 0.3 * (la - 5) * (la - 5) + 0.05 * (b - 11) * (b - 11) +
+                                       0.2 * std::abs(c - 3) + (k == 1 ? 0.0 : 0.5) +
+                                       0.1 * ((a + b * 7 + c * 13) % 5);
+                        times.push_back(static_cast<float>(t));
+                    }
+    }
+
+    float Best() const { return *std::min_element(times.begin(), times.end()); }
+};
+
+struct CountingContext
+{
+    std::size_t* n_validations;
+};
+
+struct CountingProblem
+{
+};
+
+/// Odd values of 0..99 are valid.
+struct CountingConfig
+{
+    int value = 0;
+
+    CountingConfig() = default;
+    CountingConfig(bool) {}
+
+    bool SetNextValue(const CountingProblem&) { return ++value < 100; }
+    bool IsValid(const CountingContext& ctx, const CountingProblem&) const
+    {
+        ++*ctx.n_validations;
+        return value % 2 == 1;
+    }
+    bool operator==(const CountingConfig& other) const { return value == other.value; }
+};
+
+float RunSearch(miopen::solver::SearchStrategy& strategy,
+                const SyntheticSpace& space,
+                std::size_t batch,
+                std::set<std::size_t>& proposed)
+{
+    auto best    = std::numeric_limits<float>::max();
+    auto pending = std::vector<std::size_t>{};
+    auto done    = false;
+
+    while(!done || !pending.empty())
+    {
+        // Candidates are compiled ahead of the measurements in GenericSearch.
+        while(!done && pending.size() < batch)
+        {
+            const auto next = strategy.Next();
+            if(!next)
+            {
+                done = true;
+                break;
+            }
+            EXPECT_LT(*next, space.configs.size());
+            EXPECT_TRUE(proposed.insert(*next).second) << "Proposed twice: " << *next;
+            pending.push_back(*next);
+        }
+
+        if(pending.empty())
+            break;
+
+        const auto candidate = pending.front();
+        pending.erase(pending.begin());
+        best = std::min(best, space.times[candidate]);
+        strategy.Report(candidate, space.times[candidate]);
+    }
+
+    return best;
+}
+
+} // namespace
+
+TEST(CPU_GenericSearchStrategy_NONE, ParseKind)
+{
+    for(const auto kind : {SearchStrategyKind::Random,
+                           SearchStrategyKind::Annealing,
+                           SearchStrategyKind::Genetic,
+                           SearchStrategyKind::Bayes})
+        EXPECT_EQ(miopen::solver::ParseSearchStrategyKind(miopen::solver::ToCString(kind)), kind);
+
+    EXPECT_EQ(miopen::solver::ParseSearchStrategyKind("bayes"), SearchStrategyKind::Bayes);
+    EXPECT_FALSE(miopen::solver::ParseSearchStrategyKind("exhaustive"));
+    EXPECT_FALSE(miopen::solver::ParseSearchStrategyKind(""));
+}
+
+TEST(CPU_GenericSearchStrategy_NONE, SelectByEnvironment)
+{
+    using miopen::solver::GetSearchStrategyKind;
+
+    miopen::env::clear(MIOPEN_TUNING_STRATEGY);
+    EXPECT_EQ(GetSearchStrategyKind("SolverA", SearchStrategyKind::Genetic),
+              SearchStrategyKind::Genetic);
+
+    miopen::env::update(MIOPEN_TUNING_STRATEGY, "annealing;SolverA:BAYES;SolverAB:genetic");
+    EXPECT_EQ(GetSearchStrategyKind("SolverA", SearchStrategyKind::Random),
+              SearchStrategyKind::Bayes);
+    EXPECT_EQ(GetSearchStrategyKind("SolverAB", SearchStrategyKind::Random),
+              SearchStrategyKind::Genetic);
+    EXPECT_EQ(GetSearchStrategyKind("SolverB", SearchStrategyKind::Random),
+              SearchStrategyKind::Annealing);
+
+    miopen::env::update(MIOPEN_TUNING_STRATEGY, "SolverA:BAYES;unknown");
+    EXPECT_EQ(GetSearchStrategyKind("SolverB", SearchStrategyKind::Genetic),
+              SearchStrategyKind::Genetic);
+
+    miopen::env::clear(MIOPEN_TUNING_STRATEGY);
+}
+
+TEST(CPU_GenericSearchStrategy_NONE, Budget)
+{
+    miopen::env::clear(MIOPEN_TUNING_STRATEGY_BUDGET);
+    EXPECT_EQ(miopen::solver::GetSearchBudget(SearchStrategyKind::Random, 5000), 5000);
+    EXPECT_EQ(miopen::solver::GetSearchBudget(SearchStrategyKind::Bayes, 5000), 625);
+    EXPECT_EQ(miopen::solver::GetSearchBudget(SearchStrategyKind::Bayes, 50), 50);
+
+    miopen::env::update(MIOPEN_TUNING_STRATEGY_BUDGET, 100);
+    EXPECT_EQ(miopen::solver::GetSearchBudget(SearchStrategyKind::Genetic, 5000), 100);
+    EXPECT_EQ(miopen::solver::GetSearchBudget(SearchStrategyKind::Random, 5000), 5000);
+    miopen::env::clear(MIOPEN_TUNING_STRATEGY_BUDGET);
+}
+
+TEST(CPU_GenericSearchStrategy_NONE, RandomVisitsAll)
+{
+    const auto space = SyntheticSpace{};
+    auto proposed    = std::set<std::size_t>{};
+    const auto strategy =
+        miopen::solver::MakeSearchStrategy(SearchStrategyKind::Random, space.configs, 1000000, 1);
+
+    EXPECT_EQ(RunSearch(*strategy, space, 4, proposed), space.Best());
+    EXPECT_EQ(proposed.size(), space.configs.size());
+}
+
+TEST(CPU_GenericSearchStrategy_NONE, ModelGuidedFindsNearBest)
+{
+    const auto space = SyntheticSpace{};
+    // About 5% of the configs.
+    const auto budget = space.configs.size() / 20;
+
+    for(const auto kind :
+        {SearchStrategyKind::Annealing, SearchStrategyKind::Genetic, SearchStrategyKind::Bayes})
+    {
+        auto near_best = 0;
+        for(std::uint64_t seed = 0; seed < 10; ++seed)
+        {
+            auto proposed = std::set<std::size_t>{};
+            const auto strategy =
+                miopen::solver::MakeSearchStrategy(kind, space.configs, budget, seed);
+            const auto best = RunSearch(*strategy, space, 8, proposed);
+
+            EXPECT_EQ(proposed.size(), budget) << miopen::solver::ToCString(kind);
+            if(best <= 1.05f * space.Best())
+                ++near_best;
+        }
+        EXPECT_GE(near_best, 8) << miopen::solver::ToCString(kind);
+    }
+}
+
+TEST(CPU_GenericSearchStrategy_NONE, ToleratesFailures)
+{
+    const auto configs = std::vector<std::string>{"1,a", "2,a", "3,a", "1,b", "2,b", "3,b"};
+
+    for(const auto kind :
+        {SearchStrategyKind::Annealing, SearchStrategyKind::Genetic, SearchStrategyKind::Bayes})
+    {
+        const auto strategy = miopen::solver::MakeSearchStrategy(kind, configs, 100, 3);
+        auto proposed       = std::set<std::size_t>{};
+
+        while(const auto next = strategy->Next())
+        {
+            EXPECT_TRUE(proposed.insert(*next).second);
+            strategy->Report(*next, std::nullopt);
+        }
+        EXPECT_EQ(proposed.size(), configs.size()) << miopen::solver::ToCString(kind);
+    }
+}
+
+TEST(CPU_GenericSearchStrategy_NONE, MeasurementStats)
+{
+    auto stats = miopen::solver::MeasurementStats{};
+    stats.Add(2.0f);
+    EXPECT_EQ(stats.Count(), 1);
+    EXPECT_FLOAT_EQ(stats.Mean(), 2.0f);
+    EXPECT_TRUE(std::isinf(stats.Margin()));
+
+    for(const auto time : {4.0f, 4.0f, 4.0f, 5.0f, 5.0f, 7.0f, 9.0f})
+        stats.Add(time);
+    EXPECT_EQ(stats.Count(), 8);
+    EXPECT_FLOAT_EQ(stats.Mean(), 5.0f);
+    EXPECT_NEAR(stats.StdDev(), 2.138f, 1e-3f);
+    // t(0.975, 7) * stddev / sqrt(8)
+    EXPECT_NEAR(stats.Margin(), 2.365f * 2.138f / std::sqrt(8.0f), 1e-3f);
+}
+
+TEST(CPU_GenericSearchStrategy_NONE, SelectSurvivors)
+{
+    const auto make = [](std::initializer_list<float> times) {
+        auto stats = miopen::solver::MeasurementStats{};
+        for(const auto time : times)
+            stats.Add(time);
+        return stats;
+    };
+
+    EXPECT_TRUE(miopen::solver::SelectSurvivors({}).empty());
+    EXPECT_EQ(miopen::solver::SelectSurvivors({make({1.0f})}), std::vector<std::size_t>{0});
+
+    // The fastest half, fastest first, while the ranking is uncertain.
+    const auto noisy = std::vector<miopen::solver::MeasurementStats>{
+        make({1.4f, 1.2f}), make({1.0f, 1.2f}), make({1.6f, 1.2f}), make({1.3f, 1.1f})};
+    EXPECT_EQ(miopen::solver::SelectSurvivors(noisy), (std::vector<std::size_t>{1, 3}));
+
+    // Configs confidently slower than the fastest one are dropped.
+    const auto stable = std::vector<miopen::solver::MeasurementStats>{
+        make({2.0f, 2.01f, 2.0f}), make({1.0f, 1.01f, 1.0f}), make({1.02f, 1.0f, 1.01f}),
+        make({1.5f, 1.51f, 1.5f}), make({3.0f, 3.0f, 3.01f})};
+    EXPECT_EQ(miopen::solver::SelectSurvivors(stable), (std::vector<std::size_t>{1, 2}));
+}
+
+TEST(CPU_GenericSearchStrategy_NONE, SampleConfigs)
+{
+    using Container =
+        miopen::solver::ComputedContainer<CountingConfig, CountingContext, CountingProblem>;
+
+    auto n_validations = std::size_t{0};
+    const auto configs = Container{CountingContext{&n_validations}, CountingProblem{}};
+
+    auto [all, n_all] = miopen::solver::SampleConfigs(configs, 1000, 0, 1);
+    EXPECT_EQ(n_validations, 100);
+    EXPECT_EQ(n_all, 50);
+    ASSERT_EQ(all.size(), 50);
+    for(std::size_t i = 0; i < all.size(); ++i)
+        EXPECT_EQ(all[i].value, static_cast<int>(2 * i + 1));
+
+    auto hits = std::vector<int>(100, 0);
+    for(std::uint64_t seed = 0; seed < 1000; ++seed)
+    {
+        const auto [sample, n_configs] = miopen::solver::SampleConfigs(configs, 10, 50, seed);
+        EXPECT_EQ(n_configs, 50);
+        ASSERT_EQ(sample.size(), 10);
+
+        auto unique = std::set<int>{};
+        for(const auto& config : sample)
+        {
+            EXPECT_EQ(config.value % 2, 1);
+            unique.insert(config.value);
+            ++hits[config.value];
+        }
+        EXPECT_EQ(unique.size(), sample.size());
+    }
+
+    // Each config is sampled 200 times on average.
+    for(int value = 1; value < 100; value += 2)
+    {
+        EXPECT_GT(hits[value], 140) << value;
+        EXPECT_LT(hits[value], 260) << value;
+    }
+}
+
+TEST(CPU_GenericSearchStrategy_NONE, SampleShards)
+{
+    using Container =
+        miopen::solver::ComputedContainer<CountingConfig, CountingContext, CountingProblem>;
+
+    auto n_validations = std::size_t{0};
+    const auto configs = Container{CountingContext{&n_validations}, CountingProblem{}};
+
+    // The shards split the configs without overlaps.
+    auto all     = std::set<int>{};
+    auto n_total = std::size_t{0};
+    for(std::size_t index = 0; index < 3; ++index)
+    {
+        const auto shard = miopen::solver::TuningShard{index, 3, std::nullopt};
+        const auto [sample, n_configs] =
+            miopen::solver::SampleConfigs(configs, 1000, 50, 1, shard);
+        EXPECT_EQ(n_configs, index < 2 ? 17 : 16);
+        ASSERT_EQ(sample.size(), n_configs);
+        for(const auto& config : sample)
+            EXPECT_TRUE(all.insert(config.value).second) << config.value;
+        n_total += n_configs;
+    }
+    EXPECT_EQ(n_total, 50);
+    EXPECT_EQ(all.size(), 50);
+}
+
+TEST(CPU_GenericSearchStrategy_NONE, Restore)
+{
+    const auto space = SyntheticSpace{};
+    const auto budget = std::size_t{50};
+
+    for(const auto kind : {SearchStrategyKind::Random,
+                           SearchStrategyKind::Annealing,
+                           SearchStrategyKind::Genetic,
+                           SearchStrategyKind::Bayes})
+    {
+        // Interrupted after 20 measurements.
+        auto measured = std::vector<std::size_t>{};
+        {
+            const auto strategy =
+                miopen::solver::MakeSearchStrategy(kind, space.configs, budget, 5);
+            for(auto i = 0; i < 20; ++i)
+            {
+                const auto next = strategy->Next();
+                ASSERT_TRUE(next);
+                measured.push_back(*next);
+                strategy->Report(*next, space.times[*next]);
+            }
+        }
+
+        const auto strategy = miopen::solver::MakeSearchStrategy(kind, space.configs, budget, 5);
+        for(const auto i : measured)
+            strategy->Restore(i, space.times[i]);
+
+        auto proposed = std::set<std::size_t>{measured.begin(), measured.end()};
+        while(const auto next = strategy->Next())
+        {
+            EXPECT_TRUE(proposed.insert(*next).second) << miopen::solver::ToCString(kind);
+            strategy->Report(*next, space.times[*next]);
+        }
+        EXPECT_EQ(proposed.size(), budget) << miopen::solver::ToCString(kind);
+    }
+}
+
+TEST(CPU_GenericSearchStrategy_NONE, Prioritize)
+{
+    const auto space  = SyntheticSpace{};
+    const auto budget = std::size_t{50};
+    const auto hints  = std::vector<std::size_t>{7, 3, 7, 11};
+
+    for(const auto kind : {SearchStrategyKind::Random,
+                           SearchStrategyKind::Annealing,
+                           SearchStrategyKind::Genetic,
+                           SearchStrategyKind::Bayes})
+    {
+        const auto strategy = miopen::solver::MakeSearchStrategy(kind, space.configs, budget, 5);
+        strategy->Restore(11, space.times[11]);
+        for(const auto i : hints)
+            strategy->Prioritize(i);
+
+        // Hints go first, except for the restored one, and count towards the budget.
+        auto proposed = std::vector<std::size_t>{};
+        while(const auto next = strategy->Next())
+        {
+            proposed.push_back(*next);
+            strategy->Report(*next, space.times[*next]);
+        }
+        ASSERT_GE(proposed.size(), 2) << miopen::solver::ToCString(kind);
+        EXPECT_EQ(proposed[0], 7) << miopen::solver::ToCString(kind);
+        EXPECT_EQ(proposed[1], 3) << miopen::solver::ToCString(kind);
+        EXPECT_EQ(std::set<std::size_t>(proposed.begin(), proposed.end()).size(), proposed.size())
+            << miopen::solver::ToCString(kind);
+        EXPECT_EQ(proposed.size() + 1, budget) << miopen::solver::ToCString(kind);
+    }
+}
@@ -27,6 +27,8 @@
 #include <miopen/mt_queue.hpp>
 #include <thread>
 #include <chrono>
+#include <memory>
+#include <tuple>
 
 #include "random.hpp"
 
@@ -79,3 +81,66 @@ TEST(CPU_UtilMultiThreadQueue_NONE, Basic)
         std::cout << tmp << std::endl;
     EXPECT_EQ(num_prod, num_cons);
 }
+
+TEST(CPU_UtilMultiThreadQueue_NONE, MoveOnly)
+{
+    ThreadSafeQueue<std::unique_ptr<int>> queue;
+    EXPECT_TRUE(queue.push(std::make_unique<int>(1)));
+    EXPECT_TRUE(queue.push(std::make_unique<int>(2)));
+    EXPECT_EQ(*queue.pop(), 1);
+    EXPECT_EQ(*queue.pop(), 2);
+}
+
+TEST(CPU_UtilMultiThreadQueue_NONE, Bounded)
+{
+    constexpr std::size_t capacity = 4;
+    constexpr int n_items          = 100;
+
+    ThreadSafeQueue<int> queue{capacity};
+    std::atomic<int> n_pushed{};
+    std::atomic<int> n_popped{};
+    std::atomic<int> max_ahead{};
+
+    std::vector<std::thread> producers;
+    for(auto idx = 0u; idx < total_producers; idx++)
+    {
+        producers.emplace_back([&]() {
+            for(auto i = 0; i < n_items; ++i)
+            {
+                EXPECT_TRUE(queue.push(int{i}));
+                const auto ahead = ++n_pushed - n_popped;
+                auto prev        = max_ahead.load();
+                while(ahead > prev && !max_ahead.compare_exchange_weak(prev, ahead)) {}
+            }
+        });
+    }
+
+    for(auto i = 0; i < n_items * static_cast<int>(total_producers); ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::microseconds(10));
+        std::ignore = queue.pop();
+        ++n_popped;
+    }
+
+    for(auto& prod : producers)
+        prod.join();
+
+    // Pushes and pops are counted outside of the queue, so a few items may be counted twice.
+    EXPECT_LE(max_ahead, capacity + total_producers);
+    EXPECT_EQ(n_pushed, n_popped);
+}
+
+TEST(CPU_UtilMultiThreadQueue_NONE, Close)
+{
+    ThreadSafeQueue<int> queue{1};
+    EXPECT_TRUE(queue.push(1));
+
+    // Blocks until the queue is closed.
+    auto producer = std::thread{[&]() { EXPECT_FALSE(queue.push(2)); }};
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    queue.close();
+    producer.join();
+
+    EXPECT_FALSE(queue.push(3));
+    EXPECT_EQ(queue.pop(), 1);
+}
@@ -0,0 +1,221 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/env.hpp>
+#include <miopen/ramdb.hpp>
+#include <miopen/tmp_dir.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_DB_WRITE_BEHIND)
+
+namespace {
+
+struct TestValue
+{
+    int value = 0;
+
+    void Serialize(std::ostream& stream) const { stream << value; }
+
+    bool Deserialize(const std::string& str)
+    {
+        value = std::stoi(str);
+        return true;
+    }
+};
+
+std::string ReadFile(const miopen::fs::path& path)
+{
+    auto file = std::ifstream{path};
+    auto ss   = std::ostringstream{};
+    ss << file.rdbuf();
+    return ss.str();
+}
+
+} // namespace
+
+TEST(CPU_RamDb_NONE, SeesChangesFromOtherInstance)
+{
+    const auto dir  = miopen::TmpDir{"ramdb"};
+    const auto path = dir / "test.udb.txt";
+
+    auto writer = miopen::RamDb{miopen::DbKinds::PerfDb, path};
+    auto reader = miopen::RamDb{miopen::DbKinds::PerfDb, path};
+
+    EXPECT_FALSE(reader.FindRecord(std::string{"key"}));
+
+    for(auto i = 1; i <= 3; ++i)
+    {
+        ASSERT_TRUE(writer.Update(std::string{"key"}, "id", TestValue{i}));
+
+        auto value = TestValue{};
+        ASSERT_TRUE(reader.Load(std::string{"key"}, "id", value));
+        EXPECT_EQ(value.value, i);
+    }
+
+    ASSERT_TRUE(writer.RemoveRecord(std::string{"key"}));
+    EXPECT_FALSE(reader.FindRecord(std::string{"key"}));
+}
+
+TEST(CPU_RamDb_NONE, ConcurrentReadsAndWrites)
+{
+    const auto dir = miopen::TmpDir{"ramdb"};
+    auto db        = miopen::RamDb{miopen::DbKinds::PerfDb, dir / "test.udb.txt"};
+
+    constexpr auto num_keys    = 16;
+    constexpr auto num_readers = 4;
+    constexpr auto num_writes  = 8;
+
+    for(auto i = 0; i < num_keys; ++i)
+        ASSERT_TRUE(db.Update(std::to_string(i), "id", TestValue{0}));
+
+    auto done     = std::atomic<bool>{false};
+    auto failures = std::atomic<int>{0};
+    auto readers  = std::vector<std::thread>{};
+
+    for(auto t = 0; t < num_readers; ++t)
+    {
+        readers.emplace_back([&]() {
+            while(!done)
+            {
+                for(auto i = 0; i < num_keys; ++i)
+                {
+                    auto value = TestValue{-1};
+                    if(!db.Load(std::to_string(i), "id", value) || value.value < 0 ||
+                       value.value > num_writes)
+                        ++failures;
+                }
+            }
+        });
+    }
+
+    for(auto n = 1; n <= num_writes; ++n)
+        EXPECT_TRUE(db.Update(std::to_string(n % num_keys), "id", TestValue{n}));
+
+    done = true;
+    for(auto& reader : readers)
+        reader.join();
+
+    EXPECT_EQ(failures, 0);
+
+    auto value = TestValue{};
+    ASSERT_TRUE(db.Load(std::to_string(num_writes % num_keys), "id", value));
+    EXPECT_EQ(value.value, num_writes);
+}
+
+TEST(CPU_RamDb_NONE, WriteBehind)
+{
+    const auto dir  = miopen::TmpDir{"ramdb"};
+    const auto path = dir / "test.udb.txt";
+
+    {
+        auto file = std::ofstream{path};
+        file << "key0=id:0\n"
+                "key1=id:1\n"
+                "key3=id:3\n";
+    }
+
+    auto reader = miopen::RamDb{miopen::DbKinds::PerfDb, path};
+    ASSERT_FALSE(reader.IsWriteBehind());
+
+    miopen::env::update(MIOPEN_DEBUG_DB_WRITE_BEHIND, true);
+    auto writer = miopen::RamDb{miopen::DbKinds::PerfDb, path};
+    miopen::env::clear(MIOPEN_DEBUG_DB_WRITE_BEHIND);
+    ASSERT_TRUE(writer.IsWriteBehind());
+
+    const auto original = ReadFile(path);
+
+    // Coalesced into one change per key.
+    ASSERT_TRUE(writer.Update(std::string{"key0"}, "id2", TestValue{1}));
+    ASSERT_TRUE(writer.Update(std::string{"key0"}, "id2", TestValue{2}));
+    ASSERT_TRUE(writer.Update(std::string{"key2"}, "id", TestValue{2}));
+    ASSERT_TRUE(writer.RemoveRecord(std::string{"key1"}));
+    ASSERT_TRUE(writer.Remove(std::string{"key3"}, "id"));
+
+    // Visible to the writer immediately, but nothing is written yet.
+    auto value = TestValue{};
+    EXPECT_TRUE(writer.Load(std::string{"key0"}, "id", value));
+    EXPECT_EQ(value.value, 0);
+    EXPECT_TRUE(writer.Load(std::string{"key0"}, "id2", value));
+    EXPECT_EQ(value.value, 2);
+    EXPECT_FALSE(writer.FindRecord(std::string{"key1"}));
+    EXPECT_FALSE(writer.FindRecord(std::string{"key3"}));
+    EXPECT_EQ(ReadFile(path), original);
+    EXPECT_FALSE(reader.FindRecord(std::string{"key2"}));
+
+    // Changes made meanwhile by others are merged on flush and are seen by the writer.
+    ASSERT_TRUE(reader.Update(std::string{"key2"}, "other", TestValue{3}));
+    EXPECT_TRUE(writer.Load(std::string{"key2"}, "other", value));
+    EXPECT_EQ(value.value, 3);
+    EXPECT_TRUE(writer.Load(std::string{"key2"}, "id", value));
+    EXPECT_EQ(value.value, 2);
+
+    ASSERT_TRUE(writer.Flush());
+
+    auto other      = miopen::RamDb{miopen::DbKinds::PerfDb, path};
+    const auto key0 = other.FindRecord(std::string{"key0"});
+    const auto key2 = other.FindRecord(std::string{"key2"});
+    ASSERT_TRUE(key0 && key2);
+    EXPECT_EQ(key0->GetSize(), 2);
+    EXPECT_EQ(key2->GetSize(), 2);
+    EXPECT_TRUE(key0->GetValues("id2", value));
+    EXPECT_EQ(value.value, 2);
+    EXPECT_TRUE(key2->GetValues("other", value));
+    EXPECT_EQ(value.value, 3);
+    EXPECT_FALSE(other.FindRecord(std::string{"key1"}));
+    EXPECT_FALSE(other.FindRecord(std::string{"key3"}));
+    EXPECT_TRUE(reader.Load(std::string{"key0"}, "id2", value));
+    EXPECT_EQ(value.value, 2);
+
+    // Nothing to write.
+    ASSERT_TRUE(writer.Flush());
+}
+
+TEST(CPU_RamDb_NONE, NearestSeesChanges)
+{
+    const auto dir = miopen::TmpDir{"ramdb"};
+    auto db        = miopen::RamDb{miopen::DbKinds::PerfDb, dir / "test.udb.txt"};
+
+    const auto nearest = [&]() {
+        return miopen::FindNearestValues(db, "64x56x56x32xNCHWxF", "ConvSolver", 1);
+    };
+
+    ASSERT_TRUE(db.Update(std::string{"64x56x56x16xNCHWxF"}, "ConvSolver", TestValue{16}));
+    EXPECT_EQ(nearest(), std::vector<std::string>{"16"});
+
+    // The index is rebuilt once the db changes.
+    ASSERT_TRUE(db.Update(std::string{"64x56x56x30xNCHWxF"}, "ConvSolver", TestValue{30}));
+    EXPECT_EQ(nearest(), std::vector<std::string>{"30"});
+    ASSERT_TRUE(db.RemoveRecord(std::string{"64x56x56x30xNCHWxF"}));
+    EXPECT_EQ(nearest(), std::vector<std::string>{"16"});
+}
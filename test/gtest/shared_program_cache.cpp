@@ -0,0 +1,108 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/shared_program_cache.hpp>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <tuple>
+
+namespace {
+
+// Stands in for a program: copies share the code object, like HIPOCProgram does.
+using MockProgram = std::shared_ptr<int>;
+using Cache       = miopen::SharedProgramCache<MockProgram>;
+
+Cache MakeCache(std::size_t limit)
+{
+    return Cache{limit, [](const MockProgram& program) { return program.use_count() > 1; }};
+}
+
+} // namespace
+
+TEST(CPU_SharedProgramCache_NONE, FindInsert)
+{
+    auto cache = MakeCache(100);
+    EXPECT_FALSE(cache.Find("a").has_value());
+
+    cache.Insert("a", std::make_shared<int>(1), 10);
+    const auto a = cache.Find("a");
+    ASSERT_TRUE(a.has_value());
+    EXPECT_EQ(**a, 1);
+
+    cache.Insert("a", std::make_shared<int>(2), 20);
+    EXPECT_EQ(**cache.Find("a"), 2);
+
+    const auto stats = cache.GetStats();
+    EXPECT_EQ(stats.hits, 2u);
+    EXPECT_EQ(stats.misses, 1u);
+    EXPECT_EQ(stats.entries, 1u);
+    EXPECT_EQ(stats.bytes, 20u);
+}
+
+TEST(CPU_SharedProgramCache_NONE, EvictsLeastRecentlyUsed)
+{
+    auto cache = MakeCache(30);
+    cache.Insert("a", std::make_shared<int>(1), 10);
+    cache.Insert("b", std::make_shared<int>(2), 10);
+    cache.Insert("c", std::make_shared<int>(3), 10);
+    std::ignore = cache.Find("a");
+
+    cache.Insert("d", std::make_shared<int>(4), 10); // Evicts "b".
+    EXPECT_TRUE(cache.Find("a").has_value());
+    EXPECT_FALSE(cache.Find("b").has_value());
+    EXPECT_TRUE(cache.Find("c").has_value());
+    EXPECT_TRUE(cache.Find("d").has_value());
+    EXPECT_EQ(cache.GetStats().evictions, 1u);
+    EXPECT_EQ(cache.GetStats().bytes, 30u);
+}
+
+TEST(CPU_SharedProgramCache_NONE, KeepsProgramsInUse)
+{
+    auto cache = MakeCache(20);
+    cache.Insert("a", std::make_shared<int>(1), 10);
+    cache.Insert("b", std::make_shared<int>(2), 10);
+
+    {
+        // A handle holds "a", so "b" is evicted although it was used more recently.
+        const auto a = cache.Find("a");
+        std::ignore  = cache.Find("b");
+        cache.Insert("c", std::make_shared<int>(3), 10);
+        EXPECT_TRUE(cache.Find("a").has_value());
+        EXPECT_FALSE(cache.Find("b").has_value());
+
+        // All the other programs are in use, so the cache stays over the limit.
+        const auto c = cache.Find("c");
+        cache.Insert("d", std::make_shared<int>(4), 10);
+        EXPECT_EQ(cache.GetStats().bytes, 30u);
+    }
+
+    // Released programs are evicted by the next insertion.
+    cache.Insert("e", std::make_shared<int>(5), 10);
+    EXPECT_LE(cache.GetStats().bytes, 20u);
+    EXPECT_TRUE(cache.Find("e").has_value());
+}
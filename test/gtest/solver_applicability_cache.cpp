@@ -0,0 +1,154 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/env.hpp>
+#include <miopen/execution_context.hpp>
+#include <miopen/solver_applicability_cache.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <tuple>
+
+using miopen::solver::ApplicabilityCache;
+using miopen::solver::ApplicabilityRecord;
+using miopen::solver::Id;
+
+namespace {
+
+struct FakeProblem
+{
+};
+
+struct FakeSolver
+{
+    bool applicable     = true;
+    mutable int n_calls = 0;
+
+    bool IsApplicable(const miopen::ExecutionContext&, const FakeProblem&) const
+    {
+        ++n_calls;
+        return applicable;
+    }
+
+    std::size_t GetWorkspaceSize(const miopen::ExecutionContext&, const FakeProblem&) const
+    {
+        ++n_calls;
+        return 1024;
+    }
+
+    float GetWti(const miopen::ExecutionContext&, const FakeProblem&) const
+    {
+        ++n_calls;
+        return 0.5f;
+    }
+};
+
+} // namespace
+
+TEST(CPU_SolverApplicabilityCache_NONE, Record)
+{
+    auto record  = ApplicabilityRecord{};
+    const auto a = Id{miopen::ForceInit{}, 3};
+    const auto b = Id{miopen::ForceInit{}, 200};
+
+    EXPECT_FALSE(record.IsApplicable(a).has_value());
+    record.SetApplicable(b, false);
+    record.SetApplicable(a, true);
+    EXPECT_EQ(record.IsApplicable(a), true);
+    EXPECT_EQ(record.IsApplicable(b), false);
+    EXPECT_FALSE(record.IsApplicable(Id{miopen::ForceInit{}, 100}).has_value());
+
+    EXPECT_FALSE(record.GetWorkspaceSize(a).has_value());
+    record.SetWorkspaceSize(a, 42);
+    EXPECT_EQ(record.GetWorkspaceSize(a), 42);
+    EXPECT_FALSE(record.GetWti(a).has_value());
+    record.SetWti(a, 0.25f);
+    EXPECT_EQ(record.GetWti(a), 0.25f);
+}
+
+TEST(CPU_SolverApplicabilityCache_NONE, Lru)
+{
+    auto cache = ApplicabilityCache{2};
+
+    const auto a = cache.Get("a");
+    ASSERT_NE(a, nullptr);
+    EXPECT_EQ(cache.Get("a"), a);
+    const auto b = cache.Get("b");
+    std::ignore  = cache.Get("c"); // Evicts "a".
+    EXPECT_EQ(cache.Get("b"), b);
+    EXPECT_NE(cache.Get("a"), a); // Evicts "c".
+
+    const auto stats = cache.GetStats();
+    EXPECT_EQ(stats.hits, 2);
+    EXPECT_EQ(stats.misses, 4);
+    EXPECT_EQ(stats.evictions, 2);
+    EXPECT_EQ(stats.entries, 2);
+
+    cache.ResetStats();
+    cache.Clear();
+    EXPECT_EQ(cache.GetStats().hits, 0);
+    EXPECT_EQ(cache.GetStats().entries, 0);
+
+    EXPECT_EQ(ApplicabilityCache{0}.Get("a"), nullptr);
+}
+
+TEST(CPU_SolverApplicabilityCache_NONE, EnvironmentChange)
+{
+    auto cache   = ApplicabilityCache{2};
+    const auto a = cache.Get("a");
+
+    miopen::env::setEnvironmentVariable("MIOPEN_DEBUG_APPLICABILITY_CACHE_TEST", "1");
+    EXPECT_NE(cache.Get("a"), a);
+    miopen::env::clearEnvironmentVariable("MIOPEN_DEBUG_APPLICABILITY_CACHE_TEST");
+
+    EXPECT_EQ(cache.GetStats().misses, 2);
+    EXPECT_EQ(cache.GetStats().entries, 1);
+}
+
+TEST(CPU_SolverApplicabilityCache_NONE, CachedCalls)
+{
+    const auto ctx     = miopen::ExecutionContext{};
+    const auto problem = FakeProblem{};
+    const auto id      = Id{miopen::ForceInit{}, 7};
+    auto record        = ApplicabilityRecord{};
+    auto solver        = FakeSolver{};
+
+    for(auto i = 0; i < 3; ++i)
+    {
+        EXPECT_TRUE(miopen::solver::CachedIsApplicable(&record, id, solver, ctx, problem));
+        EXPECT_EQ(miopen::solver::CachedGetWorkspaceSize(&record, id, solver, ctx, problem), 1024);
+        EXPECT_EQ(miopen::solver::CachedGetWti(&record, id, solver, ctx, problem), 0.5f);
+    }
+    EXPECT_EQ(solver.n_calls, 3);
+
+    // Without a record (cache disabled) the solver is called each time.
+    solver.applicable = false;
+    EXPECT_FALSE(miopen::solver::CachedIsApplicable(nullptr, id, solver, ctx, problem));
+    EXPECT_FALSE(miopen::solver::CachedIsApplicable(nullptr, id, solver, ctx, problem));
+    EXPECT_EQ(solver.n_calls, 5);
+    EXPECT_TRUE(miopen::solver::CachedIsApplicable(&record, id, solver, ctx, problem));
+}
@@ -1,4 +1,5 @@
 #include <gtest/ai_heuristics.hpp>
+#include <miopen/anyramdb.hpp>
 #include <miopen/conv/heuristics/ai_heuristics.hpp>
 #include "../tensor_holder.hpp"
 #include "get_handle.hpp"
@@ -69,6 +70,28 @@ std::vector<TunaNetTestCase> GetGfx90aBF16TestCases()
              "gfx90a"}};
 }
 
+template <typename G>
+miopen::conv::ProblemDescription MakeProblem(const TunaNetTestCase& test_case)
+{
+    tensor<G> input_tensor   = tensor<G>(test_case.layout, test_case.conv.GetInput());
+    tensor<G> weights_tensor = tensor<G>(test_case.layout, test_case.conv.GetWeights());
+    auto conv_desc           = test_case.conv.GetConv();
+    miopen::TensorDescriptor output_desc = conv_desc.GetForwardOutputTensor(
+        input_tensor.desc, weights_tensor.desc, test_case.data_type);
+
+    return (test_case.direction == miopen::conv::Direction::Forward)
+               ? miopen::conv::ProblemDescription(input_tensor.desc,
+                                                  weights_tensor.desc,
+                                                  output_desc,
+                                                  conv_desc,
+                                                  test_case.direction)
+               : miopen::conv::ProblemDescription(output_desc,
+                                                  weights_tensor.desc,
+                                                  input_tensor.desc,
+                                                  conv_desc,
+                                                  test_case.direction);
+}
+
 template <typename G>
 struct TunaNetTest : public ::testing::TestWithParam<TunaNetTestCase>
 {
@@ -76,25 +99,8 @@ protected:
     void SetUp() override
     {
 #if MIOPEN_ENABLE_AI_IMMED_MODE_FALLBACK
-        auto test_case           = GetParam();
-        tensor<G> input_tensor   = tensor<G>(test_case.layout, test_case.conv.GetInput());
-        tensor<G> weights_tensor = tensor<G>(test_case.layout, test_case.conv.GetWeights());
-        auto conv_desc           = test_case.conv.GetConv();
-        miopen::TensorDescriptor output_desc = conv_desc.GetForwardOutputTensor(
-            input_tensor.desc, weights_tensor.desc, test_case.data_type);
-
-        problem = (test_case.direction == miopen::conv::Direction::Forward)
-                      ? miopen::conv::ProblemDescription(input_tensor.desc,
-                                                         weights_tensor.desc,
-                                                         output_desc,
-                                                         conv_desc,
-                                                         test_case.direction)
-                      : miopen::conv::ProblemDescription(output_desc,
-                                                         weights_tensor.desc,
-                                                         input_tensor.desc,
-                                                         conv_desc,
-                                                         test_case.direction);
-
+        auto test_case      = GetParam();
+        problem             = MakeProblem<G>(test_case);
         expected_solver     = test_case.expected_solver;
         device_architecture = test_case.device_architecture;
 #else
@@ -158,6 +164,61 @@ TEST_P(GPU_TunaNetTest_BFP16, TestSolverPredictionModelBF16)
     TestSolverPredictionModel(problem, expected_solver, device_architecture);
 }
 
+TEST(GPU_TunaNetBatch_FP32, PredictSolversMatchesPredictSolver)
+{
+#if MIOPEN_ENABLE_AI_IMMED_MODE_FALLBACK
+    auto&& handle      = get_handle();
+    std::string device = handle.GetDeviceName();
+    miopen::ExecutionContext ctx;
+    ctx.SetStream(&handle);
+
+    std::vector<miopen::conv::ProblemDescription> problems;
+    for(const auto& test_case : GetGfx908FloatTestCases())
+        problems.push_back(MakeProblem<float>(test_case));
+    for(const auto& test_case : GetGfx90aFloatTestCases())
+        problems.push_back(MakeProblem<float>(test_case));
+
+    // Both PredictSolver() and PredictSolvers() answer from the results they have cached for the
+    // device. Drop them before each pass, so that both evaluate the model.
+    auto& cache       = miopen::AnyRamDb::GetCached(":memory:" + device);
+    const auto forget = [&]() {
+        for(const auto& problem : problems)
+            cache.RemoveRecord(problem);
+    };
+
+    forget();
+    std::vector<std::vector<uint64_t>> singles;
+    for(const auto& problem : problems)
+        singles.push_back(miopen::ai::immed_mode::PredictSolver(problem, ctx, device));
+
+    forget();
+    const auto batch = miopen::ai::immed_mode::PredictSolvers(problems, ctx, device);
+    ASSERT_EQ(batch.size(), problems.size());
+    for(std::size_t i = 0; i < problems.size(); ++i)
+        EXPECT_EQ(batch[i], singles[i]);
+#else
+    GTEST_SKIP();
+#endif
+}
+
+TEST(GPU_TunaNetModels_FP32, ModelPerArchitecture)
+{
+#if MIOPEN_ENABLE_AI_IMMED_MODE_FALLBACK
+    using miopen::ai::immed_mode::GetModelMetadata;
+
+    const auto& gfx908 = GetModelMetadata("gfx908");
+    const auto& gfx90a = GetModelMetadata("gfx90a");
+    EXPECT_NE(&gfx908, &gfx90a);
+    EXPECT_NE(gfx908.solver_map, gfx90a.solver_map);
+
+    // Loaded once per architecture, and architectures without a model of their own use gfx908.
+    EXPECT_EQ(&GetModelMetadata("gfx90a"), &gfx90a);
+    EXPECT_EQ(&GetModelMetadata("gfx1030"), &gfx908);
+#else
+    GTEST_SKIP();
+#endif
+}
+
 INSTANTIATE_TEST_SUITE_P(SmokeGfx908,
                          GPU_TunaNetTest_FP32,
                          testing::ValuesIn(GetGfx908FloatTestCases()));
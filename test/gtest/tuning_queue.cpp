@@ -0,0 +1,241 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include "tuning_queue.hpp"
+
+#include <miopen/conv/problem_description.hpp>
+#include <miopen/conv/tuning_work.hpp>
+#include <miopen/db.hpp>
+#include <miopen/problem.hpp>
+#include <miopen/process.hpp>
+#include <miopen/tmp_dir.hpp>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+using miopen::solver::TuningQueue;
+using miopen::solver::TuningResult;
+using miopen::solver::TuningWorkItem;
+using miopen::tests::tuning_queue::BestConfig;
+
+namespace {
+
+struct TestValue
+{
+    std::string value;
+
+    void Serialize(std::ostream& stream) const { stream << value; }
+
+    bool Deserialize(const std::string& str)
+    {
+        value = str;
+        return true;
+    }
+};
+
+/// The text db is keyed by the strings.
+std::string GetKey(const TuningWorkItem& item) { return item.key; }
+
+std::string LoadValue(miopen::PlainTextDb& db, const std::string& problem, const std::string& id)
+{
+    const auto record = db.FindRecord(problem);
+    auto value        = TestValue{};
+    if(!record || !record->GetValues(id, value))
+        return {};
+    return value.value;
+}
+
+} // namespace
+
+TEST(CPU_TuningQueue_NONE, Scheduling)
+{
+    const auto dir = miopen::TmpDir{"tuning_queue"};
+    auto queue     = TuningQueue{dir / "queue.txt"};
+
+    queue.Post(miopen::solver::ShardTuningWork({"1x2x3", "ConvSolver", R"({"x": [1, 2]})"}, 2));
+    queue.Post({{"4x5x6", "ConvSolver"}});
+
+    const auto first  = queue.Claim("a");
+    const auto second = queue.Claim("b");
+    const auto third  = queue.Claim("a");
+    ASSERT_TRUE(first && second && third);
+    EXPECT_FALSE(queue.Claim("b"));
+    EXPECT_EQ(first->item.shard, 0);
+    EXPECT_EQ(second->item.shard, 1);
+    EXPECT_EQ(second->item.n_shards, 2);
+    EXPECT_EQ(second->item.problem, R"({"x": [1, 2]})");
+    EXPECT_EQ(third->item.key, "4x5x6");
+    EXPECT_EQ(third->item.problem, "");
+    EXPECT_EQ(third->id, 2);
+
+    EXPECT_TRUE(queue.Renew(second->id, "b"));
+    EXPECT_FALSE(queue.Renew(second->id, "a"));
+
+    EXPECT_TRUE(queue.Complete(first->id, TuningResult{"16,4", 2.5f}));
+    EXPECT_FALSE(queue.Complete(first->id, TuningResult{"8,4", 1.0f}));
+    EXPECT_TRUE(queue.Complete(second->id, TuningResult{"32,4", 1.5f}));
+    EXPECT_FALSE(queue.Reclaim().IsFinished());
+    EXPECT_TRUE(queue.Complete(third->id, std::nullopt));
+
+    const auto counts = queue.Reclaim();
+    EXPECT_TRUE(counts.IsFinished());
+    EXPECT_EQ(counts.done, 3);
+
+    // The fastest shard wins, and the problem without a result is skipped.
+    auto db = miopen::PlainTextDb{miopen::DbKinds::PerfDb, dir / "test.udb.txt"};
+    EXPECT_EQ(miopen::solver::MergeTuningResults(queue, db, GetKey), 1);
+    EXPECT_EQ(LoadValue(db, "1x2x3", "ConvSolver"), "32,4");
+    EXPECT_EQ(LoadValue(db, "4x5x6", "ConvSolver"), "");
+}
+
+TEST(CPU_TuningQueue_NONE, LeaseExpiry)
+{
+    const auto dir = miopen::TmpDir{"tuning_queue"};
+    auto queue     = TuningQueue{dir / "queue.txt", std::chrono::milliseconds{50}, 2};
+    queue.Post({{"1x2x3", "ConvSolver"}});
+
+    const auto first = queue.Claim("a");
+    ASSERT_TRUE(first);
+    EXPECT_FALSE(queue.Claim("b"));
+
+    // The worker has died.
+    std::this_thread::sleep_for(std::chrono::milliseconds{100});
+    const auto second = queue.Claim("b");
+    ASSERT_TRUE(second);
+    EXPECT_EQ(second->id, first->id);
+    EXPECT_EQ(second->attempts, 2);
+    EXPECT_FALSE(queue.Renew(first->id, "a"));
+
+    // Out of attempts.
+    std::this_thread::sleep_for(std::chrono::milliseconds{100});
+    const auto counts = queue.Reclaim();
+    EXPECT_TRUE(counts.IsFinished());
+    EXPECT_EQ(counts.failed, 1);
+    EXPECT_FALSE(queue.Claim("c"));
+}
+
+TEST(CPU_TuningQueue_NONE, Abandon)
+{
+    const auto dir = miopen::TmpDir{"tuning_queue"};
+    auto queue     = TuningQueue{dir / "queue.txt"};
+    queue.Post({{"1x2x3", "ConvSolver"}});
+
+    const auto n_tuned = miopen::solver::RunTuningWorker(
+        queue,
+        "a",
+        [&](const TuningWorkItem&) -> std::optional<TuningResult> {
+            throw std::runtime_error{"No GPU"};
+        },
+        std::chrono::milliseconds{10});
+    EXPECT_EQ(n_tuned, 0);
+
+    const auto entries = queue.GetEntries();
+    ASSERT_EQ(entries.size(), 1);
+    EXPECT_EQ(entries[0].state, TuningQueue::State::Failed);
+    EXPECT_EQ(entries[0].attempts, 3);
+}
+
+TEST(CPU_TuningQueue_NONE, ProblemSerialization)
+{
+    auto problem = miopen::Problem{};
+    problem.SetDirection(miopenProblemDirectionBackward);
+    problem.SetOperatorDescriptor(miopen::ConvolutionDescriptor{{1, 1}, {2, 2}, {1, 1}});
+    problem.RegisterTensorDescriptor(miopenTensorConvolutionX,
+                                     miopen::TensorDescriptor{miopenHalf, {16, 64, 56, 56}});
+    problem.RegisterTensorDescriptor(miopenTensorConvolutionW,
+                                     miopen::TensorDescriptor{miopenHalf, {128, 64, 3, 3}});
+    problem.RegisterTensorDescriptor(miopenTensorConvolutionY,
+                                     miopen::TensorDescriptor{miopenHalf, {16, 128, 28, 28}});
+
+    // It is a field of a line of the queue.
+    const auto serialized = miopen::conv::SerializeTuningProblem(problem);
+    EXPECT_EQ(serialized.find('\n'), std::string::npos);
+
+    const auto deserialized = miopen::conv::DeserializeTuningProblem(serialized);
+    EXPECT_EQ(deserialized.GetDirection(), miopenProblemDirectionBackward);
+    EXPECT_EQ(deserialized.AsConvolution().MakeNetworkConfig().ToString(),
+              problem.AsConvolution().MakeNetworkConfig().ToString());
+
+    EXPECT_ANY_THROW(std::ignore = miopen::conv::DeserializeTuningProblem("{"));
+
+    auto activation = miopen::Problem{};
+    activation.SetOperatorDescriptor(miopen::ActivationDescriptor{});
+    EXPECT_ANY_THROW(std::ignore = miopen::conv::SerializeTuningProblem(activation));
+}
+
+#ifdef MIOPEN_TUNING_QUEUE_WORKER
+TEST(CPU_TuningQueue_NONE, Workers)
+{
+    const auto worker_path = miopen::fs::path{MIOPEN_TUNING_QUEUE_WORKER};
+    if(!miopen::fs::exists(worker_path))
+        GTEST_SKIP() << worker_path << " is not found";
+
+    constexpr int n_workers = 4;
+    const auto dir          = miopen::TmpDir{"tuning_queue"};
+    const auto problems     = std::vector<std::string>{"1x2x3", "4x5x6", "7x8x9"};
+    const auto lease        = std::chrono::milliseconds{200};
+    const auto poll         = std::chrono::milliseconds{10};
+
+    auto items = std::vector<TuningWorkItem>{};
+    for(const auto& problem : problems)
+    {
+        const auto shards = miopen::solver::ShardTuningWork({problem, "ConvSolver"}, 5);
+        items.insert(items.end(), shards.begin(), shards.end());
+    }
+    auto queue = TuningQueue{dir / "queue.txt", lease};
+    queue.Post(items);
+
+    auto workers = std::vector<miopen::ProcessAsync>{};
+    for(int i = 0; i < n_workers; ++i)
+    {
+        auto args = (dir / "queue.txt").string() + " worker" + std::to_string(i) + " " +
+                    std::to_string(lease.count()) + " " + std::to_string(poll.count());
+        // The first worker dies in the middle of its first item.
+        if(i == 0)
+            args += " die";
+        workers.emplace_back(worker_path, args);
+    }
+
+    auto db = miopen::PlainTextDb{miopen::DbKinds::PerfDb, dir / "test.udb.txt"};
+    EXPECT_TRUE(miopen::solver::WaitForTuning(queue, std::chrono::seconds{60}, poll));
+    EXPECT_EQ(miopen::solver::MergeTuningResults(queue, db, GetKey), problems.size());
+
+    EXPECT_EQ(workers[0].Wait(), 3);
+    for(int i = 1; i < n_workers; ++i)
+        EXPECT_NE(workers[i].Wait(), 1) << i;
+
+    const auto entries = queue.GetEntries();
+    ASSERT_EQ(entries.size(), items.size());
+    for(const auto& entry : entries)
+        EXPECT_EQ(entry.state, TuningQueue::State::Done) << entry.id;
+
+    for(const auto& problem : problems)
+        EXPECT_EQ(LoadValue(db, problem, "ConvSolver"), BestConfig(problem)) << problem;
+}
+#endif
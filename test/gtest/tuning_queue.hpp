@@ -0,0 +1,74 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#pragma once
+
+#include <miopen/tuning_queue.hpp>
+
+#include <functional>
+#include <optional>
+#include <string>
+
+namespace miopen {
+namespace tests {
+namespace tuning_queue {
+
+constexpr int n_configs = 100;
+
+/// Stands for the time of a config of the problem, the fastest one is problem-specific.
+inline float SyntheticTime(const std::string& problem, int config)
+{
+    const auto offset = static_cast<int>(std::hash<std::string>{}(problem) % n_configs);
+    return 1.0f + static_cast<float>((config * 37 + offset) % n_configs) / n_configs;
+}
+
+/// Searches the configs of the shard on the CPU.
+inline std::optional<solver::TuningResult> SyntheticTune(const solver::TuningWorkItem& item)
+{
+    auto best = std::optional<solver::TuningResult>{};
+    for(auto config = static_cast<int>(item.shard); config < n_configs;
+        config += static_cast<int>(item.n_shards))
+    {
+        const auto time = SyntheticTime(item.key, config);
+        if(!best || time < best->time)
+            best = solver::TuningResult{std::to_string(config), time};
+    }
+    return best;
+}
+
+inline std::string BestConfig(const std::string& problem)
+{
+    auto best = 0;
+    for(auto config = 1; config < n_configs; ++config)
+    {
+        if(SyntheticTime(problem, config) < SyntheticTime(problem, best))
+            best = config;
+    }
+    return std::to_string(best);
+}
+
+} // namespace tuning_queue
+} // namespace tests
+} // namespace miopen
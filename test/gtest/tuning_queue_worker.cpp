@@ -0,0 +1,62 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+/// Tuning worker process started by the CPU_TuningQueue_NONE.Workers test. Tunes the items of
+/// the queue on the CPU with the synthetic cost of tuning_queue.hpp.
+
+#include "tuning_queue.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <thread>
+
+int main(int argc, char** argv)
+{
+    if(argc < 5 || argc > 6)
+    {
+        std::cerr << "Usage:" << std::endl;
+        std::cerr << argv[0] << " queue_path worker lease_ms poll_ms [die]" << std::endl;
+        std::cerr << "die - exit in the middle of the first item, leaving it claimed." << std::endl;
+        return 1;
+    }
+
+    const auto die   = argc == 6 && std::string_view{argv[5]} == "die";
+    const auto lease = std::chrono::milliseconds{std::stoi(argv[3])};
+    const auto poll  = std::chrono::milliseconds{std::stoi(argv[4])};
+    auto queue       = miopen::solver::TuningQueue{argv[1], lease};
+
+    const auto tune = [&](const miopen::solver::TuningWorkItem& item) {
+        if(die)
+            std::_Exit(3);
+        std::this_thread::sleep_for(std::chrono::milliseconds{5});
+        return miopen::tests::tuning_queue::SyntheticTune(item);
+    };
+
+    return miopen::solver::RunTuningWorker(queue, argv[2], tune, poll) > 0 ? 0 : 2;
+}
@@ -663,3 +663,26 @@ INSTANTIATE_TEST_SUITE_P(Full,
 INSTANTIATE_TEST_SUITE_P(Full,
                          CPU_TensorTestCheckDimsFitIntoInt_NONE,
                          testing::ValuesIn(TestCheckDimsFitIntoInt::GetTestCases()));
+
+TEST(CPU_TensorTestCopy_NONE, SharesShape)
+{
+    const auto desc = miopen::TensorDescriptor{miopenHalf, {2, 32, 8, 8}, {2048, 1, 256, 32}};
+    EXPECT_EQ(desc.GetLayout_str(), "NHWC");
+
+    const auto copy = desc; // NOLINT (performance-unnecessary-copy-initialization)
+    EXPECT_EQ(copy.GetLengths().data(), desc.GetLengths().data());
+    EXPECT_EQ(copy.GetStrides().data(), desc.GetStrides().data());
+    EXPECT_EQ(copy.GetLayout_str(), "NHWC");
+    EXPECT_EQ(copy.GetLayout("NCHW"), "NHWC");
+    EXPECT_EQ(copy, desc);
+
+    // An equal descriptor which is not a copy.
+    const auto other = miopen::TensorDescriptor{miopenHalf, {2, 32, 8, 8}, {2048, 1, 256, 32}};
+    EXPECT_EQ(other, desc);
+    EXPECT_NE(other.GetLengths().data(), desc.GetLengths().data());
+
+    auto moved_from = miopen::TensorDescriptor{miopenHalf, {2, 32, 8, 8}};
+    const auto moved_to = std::move(moved_from);
+    EXPECT_EQ(moved_to.GetLengths(), (std::vector<std::size_t>{2, 32, 8, 8}));
+    EXPECT_TRUE(moved_from.GetLengths().empty()); // NOLINT (bugprone-use-after-move)
+}
@@ -0,0 +1,78 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/worker_pool.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+using miopen::WorkerPool;
+
+TEST(CPU_WorkerPool_NONE, AllIterations)
+{
+    for(const auto n_threads : {0, 1, 4})
+    {
+        auto pool   = WorkerPool{static_cast<std::size_t>(n_threads)};
+        auto values = std::vector<int>(1000, 0);
+        pool.ParallelFor(values.size(), [&](std::size_t i) { values[i] += static_cast<int>(i); });
+
+        for(auto i = std::size_t{0}; i < values.size(); ++i)
+            EXPECT_EQ(values[i], static_cast<int>(i));
+    }
+}
+
+TEST(CPU_WorkerPool_NONE, Exception)
+{
+    auto pool    = WorkerPool{4};
+    auto n_calls = std::atomic<int>{0};
+    EXPECT_THROW(pool.ParallelFor(100,
+                                  [&](std::size_t i) {
+                                      ++n_calls;
+                                      if(i % 10 == 0)
+                                          throw std::runtime_error("failed");
+                                  }),
+                 std::runtime_error);
+    EXPECT_EQ(n_calls, 100);
+
+    // The pool stays usable.
+    n_calls = 0;
+    pool.ParallelFor(100, [&](std::size_t) { ++n_calls; });
+    EXPECT_EQ(n_calls, 100);
+}
+
+TEST(CPU_WorkerPool_NONE, Nested)
+{
+    auto pool = WorkerPool{2};
+    auto sum  = std::atomic<std::size_t>{0};
+    pool.ParallelFor(8, [&](std::size_t i) {
+        pool.ParallelFor(8, [&](std::size_t j) { sum += i * 8 + j; });
+    });
+    EXPECT_EQ(sum, std::size_t{64 * 63 / 2});
+}
@@ -0,0 +1,31 @@
+#include <miopen/db_binary.hpp>
+
+#include <iostream>
+#include <string>
+
+int main(int argn, char** args)
+{
+    if(argn < 2 || argn > 3)
+    {
+        std::cerr << "Usage:" << std::endl;
+        std::cerr << args[0] << " input_path [output_path]" << std::endl;
+        std::cerr << "input_path - path to the input file, expected to be a text find-db or "
+                     "perf-db."
+                  << std::endl;
+        std::cerr << "output_path - optional path to the output file. Existing file would be "
+                     "replaced. Defaults to the input_path, converting it in place."
+                  << std::endl;
+        return 1;
+    }
+
+    const std::string in_filename  = args[1];
+    const std::string out_filename = argn > 2 ? args[2] : in_filename;
+
+    if(miopen::DbBinary::IsBinary(in_filename))
+    {
+        std::cerr << in_filename << " is already a binary db." << std::endl;
+        return 1;
+    }
+
+    return miopen::DbBinary::Convert(in_filename, out_filename) ? 0 : 1;
+}
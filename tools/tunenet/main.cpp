@@ -0,0 +1,199 @@
+#include <miopen/conv/tuning_work.hpp>
+#include <miopen/filesystem.hpp>
+#include <miopen/handle.hpp>
+#include <miopen/problem.hpp>
+#include <miopen/process.hpp>
+#include <miopen/tuning_queue.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace fs = miopen::fs;
+
+namespace {
+
+struct Options
+{
+    fs::path problems;
+    fs::path queue;
+    std::size_t workers = 1;
+    std::size_t shards  = 0;
+    std::vector<std::string> gpus;
+    std::string worker; // Set for the worker processes.
+};
+
+void PrintUsage(const char* name)
+{
+    std::cerr << "Usage:" << std::endl;
+    std::cerr << name << " [--workers N] [--shards N] [--gpus LIST] [--queue PATH] problems_path"
+              << std::endl;
+    std::cerr << "Tunes the convolution problems in parallel worker processes and stores the "
+                 "fastest configs in the user perf-db."
+              << std::endl;
+    std::cerr << "problems_path - text file with a convolution problem per line, serialized as "
+                 "JSON by MIOpen."
+              << std::endl;
+    std::cerr << "--workers N - number of the worker processes (Default=1)." << std::endl;
+    std::cerr << "--shards N - number of the slices of the configs of each solver, which are "
+                 "tuned separately (Default=the number of the workers)."
+              << std::endl;
+    std::cerr << "--gpus LIST - comma-separated indices of the GPUs to spread the workers over "
+                 "(Default=the default GPU)."
+              << std::endl;
+    std::cerr << "--queue PATH - tuning queue file (Default=problems_path.queue). An unfinished "
+                 "queue is resumed instead of tuning the problems from the start."
+              << std::endl;
+}
+
+bool ParseOptions(int argn, char** args, Options& options)
+{
+    for(auto i = 1; i < argn; ++i)
+    {
+        const auto arg = std::string_view{args[i]};
+        if(arg.substr(0, 2) != "--")
+        {
+            if(!options.problems.empty())
+                return false;
+            options.problems = args[i];
+            continue;
+        }
+        if(i + 1 == argn)
+            return false;
+
+        const auto value = std::string{args[++i]};
+        if(arg == "--workers")
+            options.workers = std::stoul(value);
+        else if(arg == "--shards")
+            options.shards = std::stoul(value);
+        else if(arg == "--queue")
+            options.queue = value;
+        else if(arg == "--worker")
+            options.worker = value;
+        else if(arg == "--gpus")
+        {
+            auto in  = std::istringstream{value};
+            auto gpu = std::string{};
+            while(std::getline(in, gpu, ','))
+                options.gpus.push_back(gpu);
+        }
+        else
+            return false;
+    }
+
+    if(!options.worker.empty())
+        return !options.queue.empty();
+    if(options.problems.empty() || options.workers == 0)
+        return false;
+    if(options.queue.empty())
+        options.queue = options.problems.string() + ".queue";
+    if(options.shards == 0)
+        options.shards = options.workers;
+    return true;
+}
+
+int RunWorker(const Options& options)
+{
+    auto handle = miopen::Handle{};
+    auto queue  = miopen::solver::TuningQueue{options.queue};
+    const auto n_tuned =
+        miopen::solver::RunTuningWorker(queue, options.worker, [&](const auto& item) {
+            return miopen::conv::Tune(handle, item);
+        });
+    std::cout << options.worker << ": " << n_tuned << " items tuned" << std::endl;
+    return 0;
+}
+
+int RunCoordinator(const char* self, const Options& options)
+{
+    auto handle = miopen::Handle{};
+    auto queue  = miopen::solver::TuningQueue{options.queue};
+
+    if(fs::exists(options.queue))
+    {
+        std::cout << "Resuming " << options.queue << std::endl;
+    }
+    else
+    {
+        auto in = std::ifstream{options.problems};
+        if(!in)
+        {
+            std::cerr << "Failed to open " << options.problems << std::endl;
+            return 1;
+        }
+
+        auto items      = std::vector<miopen::solver::TuningWorkItem>{};
+        auto n_problems = 0;
+        auto line       = std::string{};
+        while(std::getline(in, line))
+        {
+            if(line.empty())
+                continue;
+            const auto problem = miopen::conv::DeserializeTuningProblem(line);
+            const auto work    = miopen::conv::MakeTuningWork(handle, problem, options.shards);
+            items.insert(items.end(), work.begin(), work.end());
+            ++n_problems;
+        }
+        queue.Post(items);
+        std::cout << n_problems << " problems, " << items.size() << " tuning items" << std::endl;
+    }
+
+    // Names differ between the runs, so that the items of the workers of an interrupted run are
+    // not taken for the ones of this run.
+    const auto run = std::chrono::duration_cast<std::chrono::milliseconds>(
+                         std::chrono::system_clock::now().time_since_epoch())
+                         .count();
+    auto workers = std::vector<miopen::ProcessAsync>{};
+    for(std::size_t i = 0; i < options.workers; ++i)
+    {
+        const auto args = "--worker w" + std::to_string(run) + "." + std::to_string(i) +
+                          " --queue \"" + options.queue.string() + "\"";
+        auto env = miopen::ProcessEnvironmentMap{};
+        if(!options.gpus.empty())
+            env["HIP_VISIBLE_DEVICES"] = options.gpus[i % options.gpus.size()];
+        workers.emplace_back(self, args, "", nullptr, env);
+    }
+    for(auto& worker : workers)
+        worker.Wait();
+
+    const auto counts = queue.Reclaim();
+    if(!counts.IsFinished())
+    {
+        std::cerr << "Tuning is unfinished: " << counts.pending << " items pending, "
+                  << counts.claimed << " in progress. Run again to resume." << std::endl;
+        return 1;
+    }
+
+    const auto n_updated = miopen::conv::MergeTuningResults(handle, queue);
+    std::cout << n_updated << " perf-db records updated, " << counts.failed << " items failed"
+              << std::endl;
+    fs::remove(options.queue);
+    return counts.failed == 0 ? 0 : 1;
+}
+
+} // namespace
+
+int main(int argn, char** args)
+{
+    auto options = Options{};
+    try
+    {
+        if(!ParseOptions(argn, args, options))
+        {
+            PrintUsage(args[0]);
+            return 1;
+        }
+        return options.worker.empty() ? RunCoordinator(args[0], options) : RunWorker(options);
+    }
+    catch(const std::exception& ex)
+    {
+        std::cerr << ex.what() << std::endl;
+        return 1;
+    }
+}